@@ -0,0 +1,13 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/Benchmark.h>
+
+#include <vector>
+
+namespace GB::Benchmarks
+{
+	/// @brief Times updating many AnimatedSprites, and the same animations through an AnimationSystem.
+	/// @param options The options that apply to every benchmark.
+	/// @return The result of every benchmark that was run.
+	std::vector<BenchmarkResult> runAnimatedSpriteBenchmarks(const BenchmarkOptions& options);
+}
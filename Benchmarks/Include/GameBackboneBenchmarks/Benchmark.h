@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GB::Benchmarks
+{
+	/// @brief The timing of a single benchmark.
+	struct BenchmarkResult
+	{
+		/// @brief The name of the benchmark.
+		std::string name;
+
+		/// @brief The number of elements the benchmark operated on per iteration.
+		std::size_t elementCount;
+
+		/// @brief The number of timed iterations.
+		std::size_t iterations;
+
+		/// @brief The average wall time of one iteration in nanoseconds.
+		double nanosecondsPerIteration;
+	};
+
+	/// @brief The element counts that benchmarks of hot paths are run at to show how they scale.
+	inline constexpr std::array<std::size_t, 4> SCALING_ELEMENT_COUNTS{ 1000, 10000, 100000, 1000000 };
+
+	/// @brief Options that apply to every benchmark.
+	struct BenchmarkOptions
+	{
+		/// @brief Benchmarks that operate on more elements than this are skipped.
+		std::size_t maxElementCount = SCALING_ELEMENT_COUNTS.back();
+	};
+
+	/// @brief Returns how many iterations to run so that every element count does about the same total work.
+	/// @param elementCount The number of elements each iteration operates on.
+	/// @param totalElementOperations The number of element operations to spread over the iterations.
+	/// @return The number of iterations. Always at least 1.
+	inline std::size_t getIterationCount(std::size_t elementCount, std::size_t totalElementOperations)
+	{
+		return std::max<std::size_t>(1, totalElementOperations / std::max<std::size_t>(1, elementCount));
+	}
+
+	/// @brief Times a function over several iterations. The function is called once before timing starts.
+	/// @tparam Func A function that takes no arguments.
+	/// @param name The name of the benchmark.
+	/// @param elementCount The number of elements the function operates on.
+	/// @param iterations The number of times to call the function while timing.
+	/// @param func The function to time.
+	/// @return The timing of the function.
+	template <class Func>
+	BenchmarkResult runBenchmark(std::string name, std::size_t elementCount, std::size_t iterations, Func&& func)
+	{
+		// Warm up caches and lazily built state
+		func();
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t ii = 0; ii < iterations; ++ii)
+		{
+			func();
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		const std::chrono::duration<double, std::nano> elapsed = end - start;
+		return BenchmarkResult{ std::move(name), elementCount, iterations, elapsed.count() / static_cast<double>(iterations) };
+	}
+
+	/// @brief Writes the CSV header matching writeBenchmarkResult.
+	/// @param out The stream to write to.
+	inline void writeBenchmarkHeader(std::ostream& out)
+	{
+		out << "name,elements,iterations,ns_per_iteration\n";
+	}
+
+	/// @brief Writes a result as one CSV row.
+	/// @param out The stream to write to.
+	/// @param result The result to write.
+	inline void writeBenchmarkResult(std::ostream& out, const BenchmarkResult& result)
+	{
+		out << result.name << ','
+			<< result.elementCount << ','
+			<< result.iterations << ','
+			<< result.nanosecondsPerIteration << '\n';
+	}
+
+	/// @brief Writes results as a JSON array of objects with the same fields as the CSV columns.
+	/// @param out The stream to write to.
+	/// @param results The results to write.
+	inline void writeBenchmarkResultsJson(std::ostream& out, const std::vector<BenchmarkResult>& results)
+	{
+		out << "[";
+		for (std::size_t ii = 0; ii < results.size(); ++ii)
+		{
+			const BenchmarkResult& result = results[ii];
+			out << (ii == 0 ? "\n" : ",\n")
+				<< "  {\"name\":\"" << result.name << "\","
+				<< "\"elements\":" << result.elementCount << ','
+				<< "\"iterations\":" << result.iterations << ','
+				<< "\"ns_per_iteration\":" << result.nanosecondsPerIteration << '}';
+		}
+		out << "\n]\n";
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/Benchmark.h>
+
+#include <vector>
+
+namespace GB::Benchmarks
+{
+	/// @brief Times matching events against many gestures with a ButtonGestureHandler and a GestureTrieHandler.
+	/// @param options The options that apply to every benchmark.
+	/// @return The result of every benchmark that was run.
+	std::vector<BenchmarkResult> runButtonGestureHandlerBenchmarks(const BenchmarkOptions& options);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/Benchmark.h>
+
+#include <vector>
+
+namespace GB::Benchmarks
+{
+	/// @brief Compares transform propagation of CompoundSprite and FlatCompoundSprite. Times updating and drawing large CompoundSprites.
+	/// @param options The options that apply to every benchmark.
+	/// @return The result of every benchmark that was run.
+	std::vector<BenchmarkResult> runCompoundSpriteBenchmarks(const BenchmarkOptions& options);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/Benchmark.h>
+
+#include <vector>
+
+namespace GB::Benchmarks
+{
+	/// @brief Times drawing a GameRegion with and without culling and the spatial index, and picking points with the spatial index.
+	/// @param options The options that apply to every benchmark.
+	/// @return The result of every benchmark that was run.
+	std::vector<BenchmarkResult> runGameRegionBenchmarks(const BenchmarkOptions& options);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace GB::Benchmarks
+{
+	/// @brief A render target without a window or an OpenGL context.
+	///		Drawables still build their vertices and traverse their children, but sf::RenderTarget skips the OpenGL calls
+	///		because the target can never be activated. Lets benchmarks time the CPU side of drawing on machines without a display.
+	class NullRenderTarget final : public sf::RenderTarget
+	{
+	public:
+		/// @brief Initializes a NullRenderTarget with the size of its default view.
+		/// @param size The size of the target in pixels.
+		explicit NullRenderTarget(sf::Vector2u size) : m_size(size)
+		{
+			initialize();
+		}
+
+		/// @brief Returns the size of the target in pixels.
+		sf::Vector2u getSize() const override
+		{
+			return m_size;
+		}
+
+		/// @brief Never activates the target, so that nothing is sent to OpenGL.
+		/// @return Always false.
+		bool setActive(bool /*active*/ = true) override
+		{
+			return false;
+		}
+
+	private:
+		sf::Vector2u m_size;
+	};
+}
@@ -0,0 +1,99 @@
+#include <GameBackboneBenchmarks/AnimatedSpriteBenchmarks.h>
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/AnimationSystem.h>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of sprite updates per benchmark. Keeps the run time similar for every sprite count.
+	constexpr std::size_t UPDATES_PER_BENCHMARK = 10000000;
+
+	// The time passed to each update
+	constexpr sf::Int64 UPDATE_ELAPSED_TIME = 16667;
+
+	/// @brief Returns the AnimationSet shared by every benchmarked sprite.
+	AnimationSet::Ptr makeAnimations()
+	{
+		return std::make_shared<AnimationSet>(std::vector<Animation>{
+			Animation{ { 0, 0, 16, 16 }, { 16, 0, 16, 16 }, { 32, 0, 16, 16 }, { 48, 0, 16, 16 } },
+			Animation{ { 0, 16, 16, 16 }, { 16, 16, 16, 16 } }
+		});
+	}
+
+	/// @brief Returns the end type of the sprite at index. Alternates between looping and reversing.
+	ANIMATION_END_TYPE getEndType(std::size_t index)
+	{
+		return index % 4 < 2 ? ANIMATION_END_TYPE::ANIMATION_LOOP : ANIMATION_END_TYPE::ANIMATION_REVERSE;
+	}
+
+	/// @brief Times updating spriteCount animated sprites that share an AnimationSet.
+	/// @param animationDelay The delay between frames. Shorter than the elapsed time to change frames on every update.
+	BenchmarkResult benchmarkUpdate(const std::string& name, std::size_t spriteCount, sf::Int64 animationDelay)
+	{
+		sf::Texture texture{};
+		std::vector<AnimatedSprite> sprites(spriteCount, AnimatedSprite{ texture, makeAnimations() });
+		for (std::size_t ii = 0; ii < sprites.size(); ++ii)
+		{
+			sprites[ii].setAnimationDelay(sf::microseconds(animationDelay));
+			sprites[ii].runAnimation(static_cast<unsigned int>(ii % 2), getEndType(ii));
+		}
+
+		return runBenchmark(name, spriteCount, getIterationCount(spriteCount, UPDATES_PER_BENCHMARK),
+			[&sprites]() {
+				for (AnimatedSprite& sprite : sprites)
+				{
+					sprite.update(UPDATE_ELAPSED_TIME);
+				}
+			});
+	}
+
+	/// @brief Times updating the same sprites as benchmarkUpdate through an AnimationSystem.
+	BenchmarkResult benchmarkSystemUpdate(const std::string& name, std::size_t spriteCount, sf::Int64 animationDelay)
+	{
+		sf::Texture texture{};
+		const AnimationSet::Ptr animations = makeAnimations();
+		std::vector<sf::Sprite> sprites(spriteCount, sf::Sprite{ texture });
+
+		AnimationSystem system{};
+		for (std::size_t ii = 0; ii < sprites.size(); ++ii)
+		{
+			system.addSprite(sprites[ii], animations);
+			system.setAnimationDelay(sprites[ii], sf::microseconds(animationDelay));
+			system.runAnimation(sprites[ii], static_cast<unsigned int>(ii % 2), getEndType(ii));
+		}
+
+		return runBenchmark(name, spriteCount, getIterationCount(spriteCount, UPDATES_PER_BENCHMARK),
+			[&system]() {
+				system.update(UPDATE_ELAPSED_TIME);
+			});
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runAnimatedSpriteBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t spriteCount : SCALING_ELEMENT_COUNTS)
+	{
+		if (spriteCount > options.maxElementCount)
+		{
+			break;
+		}
+		results.push_back(benchmarkUpdate("AnimatedSprite_Update", spriteCount, UPDATE_ELAPSED_TIME / 2));
+		results.push_back(benchmarkUpdate("AnimatedSprite_UpdateWithoutFrameChange", spriteCount, UPDATE_ELAPSED_TIME * 1000));
+		results.push_back(benchmarkSystemUpdate("AnimationSystem_Update", spriteCount, UPDATE_ELAPSED_TIME / 2));
+		results.push_back(benchmarkSystemUpdate("AnimationSystem_UpdateWithoutFrameChange", spriteCount, UPDATE_ELAPSED_TIME * 1000));
+	}
+	return results;
+}
@@ -0,0 +1,236 @@
+#include <GameBackboneBenchmarks/ButtonGestureHandlerBenchmarks.h>
+
+#include <GameBackbone/UserInput/ButtonGestureHandler.h>
+#include <GameBackbone/UserInput/GestureTrieHandler.h>
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of signalers offered an event per benchmark. Keeps the run time similar for every signaler count.
+	constexpr std::size_t SIGNALER_EVENTS_PER_BENCHMARK = 20000000;
+
+	// Total number of signalers copied per copy benchmark
+	constexpr std::size_t SIGNALER_COPIES_PER_BENCHMARK = 2000000;
+
+	// addMatchSignaler resets every signaler, so building larger handlers takes quadratic time
+	constexpr std::array<std::size_t, 4> SIGNALER_COUNTS{ 10, 100, 1000, 10000 };
+
+	// The pointer open set erases in the middle of a vector, so it is only timed at the smaller counts
+	constexpr std::size_t POINTER_OPEN_SET_MAX_SIGNALER_COUNT = 1000;
+
+	// The number of keys that gestures and events are made of
+	constexpr int KEY_COUNT = 26;
+
+	// The number of keys in each gesture
+	constexpr std::size_t GESTURE_LENGTH = 3;
+
+	// The number of pregenerated events that the benchmark cycles through
+	constexpr std::size_t EVENT_COUNT = 256;
+
+	/// @brief The open set management that ButtonGestureHandler used before it kept a bitset, kept to compare against.
+	/// @details Open gestures are held as pointers into the whole set. Gestures that drop out are erased from the middle of the
+	///		vector, and a reset rebuilds the vector from the whole set.
+	class PointerOpenSetGestureHandler
+	{
+	public:
+		void addMatchSignaler(KeyDownMatchSignaler matchSignaler)
+		{
+			m_wholeSet.emplace_back(std::move(matchSignaler));
+			reset();
+		}
+
+		bool handleEvent(sf::Int64 elapsedTime, const sf::Event& event)
+		{
+			bool eventConsumed = applyEventToOpenSet(elapsedTime, event);
+			if (!eventConsumed)
+			{
+				reset();
+				eventConsumed = applyEventToOpenSet(0, event);
+			}
+			return eventConsumed;
+		}
+
+	private:
+		void reset()
+		{
+			m_openSetGestures.clear();
+			for (KeyDownMatchSignaler& bind : m_wholeSet)
+			{
+				bind.reset();
+				m_openSetGestures.push_back(&bind);
+			}
+		}
+
+		bool applyEventToOpenSet(sf::Int64 elapsedTime, const sf::Event& event)
+		{
+			bool eventConsumed = false;
+			for (std::size_t ii = 0; ii < m_openSetGestures.size(); ++ii)
+			{
+				auto result = m_openSetGestures[ii]->processEvent(elapsedTime, event);
+				if (!result.isReadyForInput)
+				{
+					m_openSetGestures.erase(m_openSetGestures.begin() + static_cast<std::ptrdiff_t>(ii));
+					--ii;
+				}
+				if (result.inputConsumed)
+				{
+					eventConsumed = true;
+				}
+			}
+			return eventConsumed;
+		}
+
+		std::vector<KeyDownMatchSignaler*> m_openSetGestures;
+		std::vector<KeyDownMatchSignaler> m_wholeSet;
+	};
+
+	/// @brief An action stored inline in the signaler instead of in a std::function.
+	struct CountAction
+	{
+		std::size_t* count;
+
+		void operator()() const
+		{
+			++*count;
+		}
+	};
+
+	/// @brief A KeyDownMatchSignaler whose action is a CountAction.
+	using CountActionMatchSignaler = GestureMatchSignaler<KeyEventComparator, KeyDownEventFilter, CountAction>;
+
+	/// @brief A CountActionMatchSignaler that stores its gesture as a CompactGesture.
+	using CompactCountActionMatchSignaler = CompactKeyDownMatchSignaler<CountAction>;
+
+	/// @brief Returns a key pressed event for the key.
+	sf::Event makeKeyPressedEvent(int key)
+	{
+		sf::Event event{};
+		event.type = sf::Event::KeyPressed;
+		event.key.code = static_cast<sf::Keyboard::Key>(sf::Keyboard::A + key);
+		return event;
+	}
+
+	/// @brief Times handling random key presses with a handler holding signalerCount random three key gestures.
+	/// @tparam Handler The type of handler to time.
+	/// @tparam Signaler The type of signaler the handler holds.
+	template <class Handler, class Signaler = KeyDownMatchSignaler>
+	BenchmarkResult benchmarkHandleEvent(const std::string& name, std::size_t signalerCount)
+	{
+		std::mt19937 generator{ 0 };
+		std::uniform_int_distribution<int> keyDistribution{ 0, KEY_COUNT - 1 };
+
+		std::size_t fireCount = 0;
+		Handler handler{};
+		for (std::size_t ii = 0; ii < signalerCount; ++ii)
+		{
+			std::vector<sf::Event> gesture;
+			for (std::size_t jj = 0; jj < GESTURE_LENGTH; ++jj)
+			{
+				gesture.push_back(makeKeyPressedEvent(keyDistribution(generator)));
+			}
+			handler.addMatchSignaler(Signaler{ std::move(gesture), [&fireCount]() { ++fireCount; }, GestureMatchBehavior::Reset });
+		}
+
+		std::vector<sf::Event> events;
+		for (std::size_t ii = 0; ii < EVENT_COUNT; ++ii)
+		{
+			events.push_back(makeKeyPressedEvent(keyDistribution(generator)));
+		}
+
+		// Each iteration handles one event. Matching restarts from the whole set whenever no open gesture matches.
+		std::size_t eventIndex = 0;
+		BenchmarkResult result = runBenchmark(name, signalerCount, getIterationCount(signalerCount, SIGNALER_EVENTS_PER_BENCHMARK),
+			[&handler, &events, &eventIndex]() {
+				handler.handleEvent(1, events[eventIndex]);
+				eventIndex = (eventIndex + 1) % events.size();
+			});
+
+		// Observe the result so the matching cannot be optimized away
+		volatile std::size_t sink = fireCount;
+		static_cast<void>(sink);
+
+		return result;
+	}
+
+	/// @brief Times copying a handler holding signalerCount random three key gestures, as when each player gets its own handler.
+	/// @tparam Signaler The type of signaler whose action cost is measured.
+	/// @param makeAction Returns the action of each signaler.
+	template <class Signaler, class MakeAction>
+	BenchmarkResult benchmarkCopy(const std::string& name, std::size_t signalerCount, MakeAction makeAction)
+	{
+		std::mt19937 generator{ 0 };
+		std::uniform_int_distribution<int> keyDistribution{ 0, KEY_COUNT - 1 };
+
+		ButtonGestureHandler<Signaler> handler{};
+		for (std::size_t ii = 0; ii < signalerCount; ++ii)
+		{
+			std::vector<sf::Event> gesture;
+			for (std::size_t jj = 0; jj < GESTURE_LENGTH; ++jj)
+			{
+				gesture.push_back(makeKeyPressedEvent(keyDistribution(generator)));
+			}
+			handler.addMatchSignaler(Signaler{ std::move(gesture), makeAction() });
+		}
+
+		std::size_t copiedCount = 0;
+		BenchmarkResult result = runBenchmark(name, signalerCount, getIterationCount(signalerCount, SIGNALER_COPIES_PER_BENCHMARK),
+			[&handler, &copiedCount]() {
+				ButtonGestureHandler<Signaler> copy = handler;
+				copiedCount += copy.getMatchSignalerCount();
+			});
+
+		volatile std::size_t sink = copiedCount;
+		static_cast<void>(sink);
+
+		return result;
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runButtonGestureHandlerBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t signalerCount : SIGNALER_COUNTS)
+	{
+		if (signalerCount > options.maxElementCount)
+		{
+			break;
+		}
+		if (signalerCount <= POINTER_OPEN_SET_MAX_SIGNALER_COUNT)
+		{
+			results.push_back(benchmarkHandleEvent<PointerOpenSetGestureHandler>("PointerOpenSet_HandleEvent", signalerCount));
+		}
+		results.push_back(benchmarkHandleEvent<KeyboardGestureHandler>("ButtonGestureHandler_HandleEvent", signalerCount));
+		results.push_back(benchmarkHandleEvent<ButtonGestureHandler<CompactKeyDownMatchSignaler<>>, CompactKeyDownMatchSignaler<>>(
+			"ButtonGestureHandler_HandleEvent_CompactGesture", signalerCount));
+		results.push_back(benchmarkHandleEvent<KeyboardGestureTrieHandler>("GestureTrieHandler_HandleEvent", signalerCount));
+	}
+
+	std::size_t fireCount = 0;
+	for (std::size_t signalerCount : SIGNALER_COUNTS)
+	{
+		if (signalerCount > options.maxElementCount)
+		{
+			break;
+		}
+		results.push_back(benchmarkCopy<KeyDownMatchSignaler>("ButtonGestureHandler_Copy_StdFunction", signalerCount,
+			[&fireCount]() { return std::function<void()>{ [&fireCount]() { ++fireCount; } }; }));
+		results.push_back(benchmarkCopy<CountActionMatchSignaler>("ButtonGestureHandler_Copy_FunctionObject", signalerCount,
+			[&fireCount]() { return CountAction{ &fireCount }; }));
+		results.push_back(benchmarkCopy<CompactCountActionMatchSignaler>("ButtonGestureHandler_Copy_CompactGesture", signalerCount,
+			[&fireCount]() { return CountAction{ &fireCount }; }));
+	}
+	return results;
+}
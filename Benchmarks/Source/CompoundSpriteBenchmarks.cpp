@@ -0,0 +1,142 @@
+#include <GameBackboneBenchmarks/CompoundSpriteBenchmarks.h>
+
+#include <GameBackboneBenchmarks/NullRenderTarget.h>
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/CompoundSprite.h>
+#include <GameBackbone/Core/FlatCompoundSprite.h>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of component transforms per benchmark. Keeps the run time similar for every component count.
+	constexpr std::size_t TRANSFORMS_PER_BENCHMARK = 2000000;
+
+	// Total number of components updated or drawn per benchmark of large compound sprites
+	constexpr std::size_t COMPONENTS_PER_BENCHMARK = 4000000;
+
+	// The time passed to each update. Longer than the animation delay so that every update changes frames.
+	constexpr sf::Int64 UPDATE_ELAPSED_TIME = 16667;
+
+	/// @brief Moves and rotates the compound sprite once. Each call touches every component twice.
+	template <class CompoundSpriteType>
+	void propagateTransform(CompoundSpriteType& compoundSprite)
+	{
+		compoundSprite.move(0.5f, -0.5f);
+		compoundSprite.rotate(1.0f);
+	}
+
+	/// @brief Times transform propagation for a compound sprite holding componentCount sprites.
+	/// @param isDeferred True to defer the transforms of a CompoundSprite and apply them once per iteration, as a draw would.
+	template <class CompoundSpriteType>
+	BenchmarkResult benchmarkTransformPropagation(const std::string& name, std::size_t componentCount, bool isDeferred = false)
+	{
+		CompoundSpriteType compoundSprite{};
+		if constexpr (std::is_same_v<CompoundSpriteType, CompoundSprite>)
+		{
+			compoundSprite.setDeferredTransformsEnabled(isDeferred);
+		}
+		for (std::size_t ii = 0; ii < componentCount; ++ii)
+		{
+			sf::Sprite sprite{};
+			sprite.setPosition(static_cast<float>(ii), static_cast<float>(ii));
+			compoundSprite.addComponent(0, sprite);
+		}
+
+		BenchmarkResult result = runBenchmark(name, componentCount, TRANSFORMS_PER_BENCHMARK / componentCount,
+			[&compoundSprite]() {
+				propagateTransform(compoundSprite);
+				if constexpr (std::is_same_v<CompoundSpriteType, CompoundSprite>)
+				{
+					compoundSprite.applyDeferredTransforms();
+				}
+			});
+
+		// Observe the result so the transforms cannot be optimized away
+		volatile float sink = compoundSprite.getPosition().x;
+		static_cast<void>(sink);
+
+		return result;
+	}
+
+	/// @brief Times updating a compound sprite holding componentCount animated sprites.
+	BenchmarkResult benchmarkUpdate(std::size_t componentCount)
+	{
+		sf::Texture texture{};
+		auto animations = std::make_shared<AnimationSet>(std::vector<Animation>{
+			Animation{ { 0, 0, 16, 16 }, { 16, 0, 16, 16 }, { 32, 0, 16, 16 }, { 48, 0, 16, 16 } }
+		});
+
+		CompoundSprite compoundSprite{};
+		for (std::size_t ii = 0; ii < componentCount; ++ii)
+		{
+			AnimatedSprite sprite{ texture, animations };
+			sprite.setAnimationDelay(sf::microseconds(UPDATE_ELAPSED_TIME / 2));
+			sprite.runAnimation(0);
+			compoundSprite.addComponent(0, std::move(sprite));
+		}
+
+		return runBenchmark("CompoundSprite_Update", componentCount, getIterationCount(componentCount, COMPONENTS_PER_BENCHMARK),
+			[&compoundSprite]() {
+				compoundSprite.update(UPDATE_ELAPSED_TIME);
+			});
+	}
+
+	/// @brief Times drawing a compound sprite holding componentCount sprites.
+	/// @param isBatched True to enable batch drawing.
+	BenchmarkResult benchmarkDraw(const std::string& name, std::size_t componentCount, bool isBatched)
+	{
+		sf::Texture texture{};
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(isBatched);
+		for (std::size_t ii = 0; ii < componentCount; ++ii)
+		{
+			sf::Sprite sprite{ texture, sf::IntRect{ 0, 0, 16, 16 } };
+			sprite.setPosition(static_cast<float>(ii % 1000) * 16.f, static_cast<float>(ii / 1000) * 16.f);
+			compoundSprite.addComponent(0, sprite);
+		}
+
+		NullRenderTarget target{ sf::Vector2u{ 1000, 1000 } };
+		return runBenchmark(name, componentCount, getIterationCount(componentCount, COMPONENTS_PER_BENCHMARK),
+			[&compoundSprite, &target]() {
+				target.draw(compoundSprite);
+			});
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runCompoundSpriteBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t componentCount : std::array<std::size_t, 3>{ 1, 10, 100 })
+	{
+		results.push_back(benchmarkTransformPropagation<CompoundSprite>("CompoundSprite_TransformPropagation", componentCount));
+		results.push_back(benchmarkTransformPropagation<CompoundSprite>("CompoundSprite_DeferredTransformPropagation", componentCount, true));
+		results.push_back(benchmarkTransformPropagation<FlatCompoundSprite<sf::Sprite>>("FlatCompoundSprite_TransformPropagation", componentCount));
+	}
+
+	for (std::size_t componentCount : SCALING_ELEMENT_COUNTS)
+	{
+		if (componentCount > options.maxElementCount)
+		{
+			break;
+		}
+		results.push_back(benchmarkUpdate(componentCount));
+		results.push_back(benchmarkDraw("CompoundSprite_Draw", componentCount, false));
+		results.push_back(benchmarkDraw("CompoundSprite_BatchedDraw", componentCount, true));
+	}
+	return results;
+}
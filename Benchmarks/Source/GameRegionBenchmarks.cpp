@@ -0,0 +1,138 @@
+#include <GameBackboneBenchmarks/GameRegionBenchmarks.h>
+#include <GameBackboneBenchmarks/NullRenderTarget.h>
+
+#include <GameBackbone/Core/GameRegion.h>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of drawables drawn per benchmark. Keeps the run time similar for every drawable count.
+	constexpr std::size_t DRAWABLES_PER_BENCHMARK = 4000000;
+
+	// The width and height of the view and of each sprite
+	constexpr float VIEW_SIZE = 1000.f;
+	constexpr int SPRITE_SIZE = 16;
+
+	// The world grows with the drawable count so that the same number of drawables are near the view
+	constexpr float WORLD_AREA_PER_DRAWABLE = 64.f * 64.f;
+
+	// Every pick iteration moves a few drawables and then picks many points, like a frame of mouse or collision queries
+	constexpr std::size_t PICKS_PER_ITERATION = 1000;
+	constexpr std::size_t MOVES_PER_ITERATION = 16;
+	constexpr std::size_t PICK_ITERATIONS = 200;
+
+	/// @brief How a benchmarked GameRegion decides what to draw.
+	enum class DrawMode
+	{
+		Everything,
+		Culled,
+		SpatialIndex
+	};
+
+	/// @brief GameRegion that exposes adding drawables to the benchmarks.
+	class BenchmarkRegion final : public GameRegion
+	{
+	public:
+		using GameRegion::addDrawable;
+		using GameRegion::markDrawableMoved;
+	};
+
+	/// @brief Times drawing a GameRegion holding drawableCount sprites scattered around the view.
+	BenchmarkResult benchmarkDraw(const std::string& name, std::size_t drawableCount, DrawMode mode)
+	{
+		const float worldSize = std::sqrt(WORLD_AREA_PER_DRAWABLE * static_cast<float>(drawableCount));
+		std::mt19937 generator{ 0 };
+		std::uniform_real_distribution<float> positionDistribution{ -worldSize / 2.f, worldSize / 2.f };
+		std::uniform_int_distribution<int> priorityDistribution{ 0, 7 };
+
+		sf::Texture texture{};
+		std::vector<sf::Sprite> sprites(drawableCount, sf::Sprite{ texture, sf::IntRect{ 0, 0, SPRITE_SIZE, SPRITE_SIZE } });
+
+		BenchmarkRegion region{};
+		region.setCullingEnabled(mode != DrawMode::Everything);
+		if (mode == DrawMode::SpatialIndex)
+		{
+			region.enableSpatialIndex(128.f);
+		}
+		for (sf::Sprite& sprite : sprites)
+		{
+			sprite.setPosition(positionDistribution(generator), positionDistribution(generator));
+			region.addDrawable(priorityDistribution(generator), sprite);
+		}
+
+		NullRenderTarget target{ sf::Vector2u{ static_cast<unsigned int>(VIEW_SIZE), static_cast<unsigned int>(VIEW_SIZE) } };
+		target.setView(sf::View{ sf::Vector2f{ 0.f, 0.f }, sf::Vector2f{ VIEW_SIZE, VIEW_SIZE } });
+
+		return runBenchmark(name, drawableCount, getIterationCount(drawableCount, DRAWABLES_PER_BENCHMARK),
+			[&region, &target]() {
+				target.draw(region);
+			});
+	}
+
+	/// @brief Times picking points within the view of a spatially indexed GameRegion holding drawableCount sprites while some of them move.
+	///		Each iteration does the same work at every drawable count, so the time should not grow with it.
+	BenchmarkResult benchmarkPick(const std::string& name, std::size_t drawableCount)
+	{
+		const float worldSize = std::sqrt(WORLD_AREA_PER_DRAWABLE * static_cast<float>(drawableCount));
+		std::mt19937 generator{ 0 };
+		std::uniform_real_distribution<float> positionDistribution{ -worldSize / 2.f, worldSize / 2.f };
+		std::uniform_real_distribution<float> pickDistribution{ -VIEW_SIZE / 2.f, VIEW_SIZE / 2.f };
+		std::uniform_int_distribution<std::size_t> spriteDistribution{ 0, drawableCount - 1 };
+
+		sf::Texture texture{};
+		std::vector<sf::Sprite> sprites(drawableCount, sf::Sprite{ texture, sf::IntRect{ 0, 0, SPRITE_SIZE, SPRITE_SIZE } });
+
+		BenchmarkRegion region{};
+		region.enableSpatialIndex(128.f);
+		for (sf::Sprite& sprite : sprites)
+		{
+			sprite.setPosition(positionDistribution(generator), positionDistribution(generator));
+			region.addDrawable(0, sprite);
+		}
+
+		std::vector<const sf::Drawable*> results;
+		return runBenchmark(name, drawableCount, PICK_ITERATIONS,
+			[&]() {
+				for (std::size_t ii = 0; ii < MOVES_PER_ITERATION; ++ii)
+				{
+					sf::Sprite& sprite = sprites[spriteDistribution(generator)];
+					sprite.setPosition(positionDistribution(generator), positionDistribution(generator));
+					region.markDrawableMoved(sprite);
+				}
+				for (std::size_t ii = 0; ii < PICKS_PER_ITERATION; ++ii)
+				{
+					results.clear();
+					region.getDrawablesAtPoint(sf::Vector2f{ pickDistribution(generator), pickDistribution(generator) }, results);
+				}
+			});
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runGameRegionBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t drawableCount : SCALING_ELEMENT_COUNTS)
+	{
+		if (drawableCount > options.maxElementCount)
+		{
+			break;
+		}
+		results.push_back(benchmarkDraw("GameRegion_Draw", drawableCount, DrawMode::Everything));
+		results.push_back(benchmarkDraw("GameRegion_CulledDraw", drawableCount, DrawMode::Culled));
+		results.push_back(benchmarkDraw("GameRegion_SpatialIndexDraw", drawableCount, DrawMode::SpatialIndex));
+		results.push_back(benchmarkPick("GameRegion_SpatialIndexPick", drawableCount));
+	}
+	return results;
+}
@@ -0,0 +1,190 @@
+#include <GameBackboneBenchmarks/InputRouterBenchmarks.h>
+
+#include <GameBackbone/UserInput/ButtonGestureHandler.h>
+#include <GameBackbone/UserInput/InputHandler.h>
+#include <GameBackbone/UserInput/InputRouter.h>
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of events or signalers handled per benchmark. Keeps the run time similar for every element count.
+	constexpr std::size_t OPERATIONS_PER_BENCHMARK = 20000000;
+
+	// addMatchSignaler resets every signaler, so building larger gesture handlers takes quadratic time
+	constexpr std::array<std::size_t, 2> SIGNALER_COUNTS{ 1000, 10000 };
+
+	/// @brief InputHandler that only handles one type of event.
+	class EventTypeHandler final : public InputHandler
+	{
+	public:
+		explicit EventTypeHandler(sf::Event::EventType type) : m_type(type) {}
+
+		bool handleEvent(sf::Int64 /*elapsedTime*/, const sf::Event& event) override
+		{
+			return event.type == m_type;
+		}
+
+	private:
+		sf::Event::EventType m_type;
+	};
+
+	/// @brief Returns a key pressed event for the key.
+	sf::Event makeKeyPressedEvent(sf::Keyboard::Key key)
+	{
+		sf::Event event{};
+		event.type = sf::Event::KeyPressed;
+		event.key.code = key;
+		return event;
+	}
+
+	/// @brief Returns a mouse button pressed event for the button.
+	sf::Event makeMouseButtonPressedEvent(sf::Mouse::Button button)
+	{
+		sf::Event event{};
+		event.type = sf::Event::MouseButtonPressed;
+		event.mouseButton.button = button;
+		return event;
+	}
+
+	/// @brief Times routing eventCount events of mixed types through a router of handlers that each handle one type.
+	BenchmarkResult benchmarkDispatch(const std::string& name, std::size_t eventCount)
+	{
+		InputRouter router{
+			EventTypeHandler{ sf::Event::MouseButtonPressed },
+			EventTypeHandler{ sf::Event::MouseMoved },
+			EventTypeHandler{ sf::Event::JoystickButtonPressed },
+			EventTypeHandler{ sf::Event::KeyPressed }
+		};
+
+		std::vector<sf::Event> events;
+		for (std::size_t ii = 0; ii < eventCount; ++ii)
+		{
+			events.push_back(ii % 2 == 0 ? makeKeyPressedEvent(sf::Keyboard::A) : makeMouseButtonPressedEvent(sf::Mouse::Left));
+		}
+
+		std::size_t handledCount = 0;
+		BenchmarkResult result = runBenchmark(name, eventCount, getIterationCount(eventCount, OPERATIONS_PER_BENCHMARK),
+			[&router, &events, &handledCount]() {
+				for (const sf::Event& event : events)
+				{
+					handledCount += router.handleEvent(1, event) ? 1u : 0u;
+				}
+			});
+
+		// Observe the result so the routing cannot be optimized away
+		volatile std::size_t sink = handledCount;
+		static_cast<void>(sink);
+
+		return result;
+	}
+
+	/// @brief Returns a joystick button pressed event for the button.
+	sf::Event makeJoystickButtonPressedEvent(unsigned int button)
+	{
+		sf::Event event{};
+		event.type = sf::Event::JoystickButtonPressed;
+		event.joystickButton.button = button;
+		return event;
+	}
+
+	/// @brief Returns a gesture handler holding signalerCount one event gestures.
+	/// @param makeGestureEvent Returns the event of the gesture with the index passed to it.
+	template <class Handler, class MakeGestureEvent>
+	Handler makeGestureHandler(std::size_t signalerCount, MakeGestureEvent makeGestureEvent)
+	{
+		Handler handler{};
+		for (std::size_t ii = 0; ii < signalerCount; ++ii)
+		{
+			handler.addMatchSignaler(typename Handler::GestureMatchSignalerType{ { makeGestureEvent(ii) }, []() {} });
+		}
+		return handler;
+	}
+
+	/// @brief Times routing events past a mouse, a joystick, and a keyboard gesture handler that each hold a third of signalerCount gestures.
+	/// @param makeRouter Returns the router of the three handlers.
+	/// @param event The event that is routed.
+	template <class MakeRouter>
+	BenchmarkResult benchmarkGestureDispatch(const std::string& name, std::size_t signalerCount, MakeRouter makeRouter, const sf::Event& event)
+	{
+		const std::size_t signalersPerHandler = signalerCount / 3;
+		auto router = makeRouter(
+			makeGestureHandler<MouseButtonGestureHandler>(signalersPerHandler,
+				[](std::size_t) { return makeMouseButtonPressedEvent(sf::Mouse::Left); }),
+			makeGestureHandler<JoystickButtonGestureHandler>(signalersPerHandler,
+				[](std::size_t ii) { return makeJoystickButtonPressedEvent(static_cast<unsigned int>(ii % 32)); }),
+			makeGestureHandler<KeyboardGestureHandler>(signalersPerHandler,
+				[](std::size_t) { return makeKeyPressedEvent(sf::Keyboard::Z); }));
+
+		std::size_t handledCount = 0;
+		BenchmarkResult result = runBenchmark(name, signalerCount, getIterationCount(signalerCount, OPERATIONS_PER_BENCHMARK),
+			[&router, &event, &handledCount]() {
+				handledCount += router.handleEvent(1, event) ? 1u : 0u;
+			});
+
+		// Observe the result so the routing cannot be optimized away
+		volatile std::size_t sink = handledCount;
+		static_cast<void>(sink);
+
+		return result;
+	}
+
+	/// @brief Returns a router that offers every event to every handler.
+	auto makeRouter(MouseButtonGestureHandler mouseHandler, JoystickButtonGestureHandler joystickHandler, KeyboardGestureHandler keyboardHandler)
+	{
+		return InputRouter{ std::move(mouseHandler), std::move(joystickHandler), std::move(keyboardHandler) };
+	}
+
+	/// @brief Returns a router that only offers each handler the events that pass the filter of its gestures.
+	auto makeFilteredRouter(MouseButtonGestureHandler mouseHandler, JoystickButtonGestureHandler joystickHandler, KeyboardGestureHandler keyboardHandler)
+	{
+		return InputRouter{
+			FilteredInputHandler<MouseButtonDownEventFilter, MouseButtonGestureHandler>{ std::move(mouseHandler) },
+			FilteredInputHandler<JoystickButtonDownEventFilter, JoystickButtonGestureHandler>{ std::move(joystickHandler) },
+			FilteredInputHandler<KeyDownEventFilter, KeyboardGestureHandler>{ std::move(keyboardHandler) }
+		};
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runInputRouterBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t eventCount : SCALING_ELEMENT_COUNTS)
+	{
+		if (eventCount > options.maxElementCount)
+		{
+			break;
+		}
+		results.push_back(benchmarkDispatch("InputRouter_Dispatch", eventCount));
+	}
+
+	for (std::size_t signalerCount : SIGNALER_COUNTS)
+	{
+		if (signalerCount > options.maxElementCount)
+		{
+			break;
+		}
+		// Key presses pass the mouse and joystick handlers before reaching the keyboard handler
+		results.push_back(benchmarkGestureDispatch("InputRouter_GestureDispatch", signalerCount, makeRouter,
+			makeKeyPressedEvent(sf::Keyboard::A)));
+		results.push_back(benchmarkGestureDispatch("InputRouter_GestureDispatch_Filtered", signalerCount, makeFilteredRouter,
+			makeKeyPressedEvent(sf::Keyboard::A)));
+
+		// Mouse movement is not part of any gesture
+		sf::Event mouseMoved{};
+		mouseMoved.type = sf::Event::MouseMoved;
+		results.push_back(benchmarkGestureDispatch("InputRouter_MouseMoveFlood", signalerCount, makeRouter, mouseMoved));
+		results.push_back(benchmarkGestureDispatch("InputRouter_MouseMoveFlood_Filtered", signalerCount, makeFilteredRouter, mouseMoved));
+	}
+	return results;
+}
@@ -0,0 +1,120 @@
+#include <GameBackboneBenchmarks/UpdateSchedulerBenchmarks.h>
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/Updatable.h>
+#include <GameBackbone/Core/UpdateScheduler.h>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GB;
+using namespace GB::Benchmarks;
+
+namespace
+{
+	// Total number of updates per benchmark. Keeps the run time similar for every element count.
+	constexpr std::size_t UPDATES_PER_BENCHMARK = 2000000;
+
+	// The time passed to each update
+	constexpr sf::Int64 UPDATE_ELAPSED_TIME = 16667;
+
+	/// @brief Updatable that does enough work per update for the work to dominate the cost of scheduling it.
+	class SimulatedBody : public Updatable
+	{
+	public:
+		void update(sf::Int64 elapsedTime) override
+		{
+			const float step = static_cast<float>(elapsedTime) * 1e-6f;
+			for (int ii = 0; ii < 16; ++ii)
+			{
+				velocity += (std::sin(position) - 0.1f * velocity) * step;
+				position += velocity * step;
+			}
+		}
+
+		float position = 1.f;
+		float velocity = 0.f;
+	};
+
+	/// @brief Times updating the Updatables one after another on this thread.
+	BenchmarkResult benchmarkSerialUpdate(const std::string& name, std::vector<Updatable*>& updatables)
+	{
+		return runBenchmark(name, updatables.size(), getIterationCount(updatables.size(), UPDATES_PER_BENCHMARK),
+			[&updatables]() {
+				for (Updatable* updatable : updatables)
+				{
+					updatable->update(UPDATE_ELAPSED_TIME);
+				}
+			});
+	}
+
+	/// @brief Times updating the Updatables through an UpdateScheduler.
+	BenchmarkResult benchmarkScheduledUpdate(const std::string& name, std::vector<Updatable*>& updatables, std::size_t threadCount)
+	{
+		UpdateScheduler scheduler{ threadCount };
+		for (Updatable* updatable : updatables)
+		{
+			scheduler.addUpdatable(*updatable);
+		}
+
+		return runBenchmark(name + "_" + std::to_string(scheduler.getThreadCount()) + "Threads", updatables.size(),
+			getIterationCount(updatables.size(), UPDATES_PER_BENCHMARK),
+			[&scheduler]() {
+				scheduler.update(UPDATE_ELAPSED_TIME);
+			});
+	}
+
+	/// @brief Times every way of updating the Updatables.
+	void benchmarkUpdatables(std::vector<BenchmarkResult>& results, const std::string& name, std::vector<Updatable*>& updatables)
+	{
+		results.push_back(benchmarkSerialUpdate(name + "_Serial", updatables));
+		results.push_back(benchmarkScheduledUpdate(name + "_Scheduled", updatables, 1));
+		const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+		if (hardwareThreads > 1)
+		{
+			results.push_back(benchmarkScheduledUpdate(name + "_Scheduled", updatables, hardwareThreads));
+		}
+	}
+}
+
+std::vector<BenchmarkResult> GB::Benchmarks::runUpdateSchedulerBenchmarks(const BenchmarkOptions& options)
+{
+	std::vector<BenchmarkResult> results;
+	for (std::size_t elementCount : SCALING_ELEMENT_COUNTS)
+	{
+		if (elementCount > options.maxElementCount)
+		{
+			break;
+		}
+
+		std::vector<SimulatedBody> bodies(elementCount);
+		std::vector<Updatable*> bodyUpdatables;
+		for (SimulatedBody& body : bodies)
+		{
+			bodyUpdatables.push_back(&body);
+		}
+		benchmarkUpdatables(results, "UpdateScheduler_SimulatedBodies", bodyUpdatables);
+
+		sf::Texture texture{};
+		const auto animations = std::make_shared<AnimationSet>(std::vector<Animation>{
+			Animation{ { 0, 0, 16, 16 }, { 16, 0, 16, 16 }, { 32, 0, 16, 16 }, { 48, 0, 16, 16 } }
+		});
+		std::vector<AnimatedSprite> sprites(elementCount, AnimatedSprite{ texture, animations });
+		std::vector<Updatable*> spriteUpdatables;
+		for (AnimatedSprite& sprite : sprites)
+		{
+			sprite.setAnimationDelay(sf::microseconds(UPDATE_ELAPSED_TIME / 2));
+			sprite.runAnimation(0);
+			spriteUpdatables.push_back(&sprite);
+		}
+		benchmarkUpdatables(results, "UpdateScheduler_AnimatedSprites", spriteUpdatables);
+	}
+	return results;
+}
@@ -0,0 +1,110 @@
+#include <GameBackboneBenchmarks/AnimatedSpriteBenchmarks.h>
+#include <GameBackboneBenchmarks/Benchmark.h>
+#include <GameBackboneBenchmarks/ButtonGestureHandlerBenchmarks.h>
+#include <GameBackboneBenchmarks/CompoundSpriteBenchmarks.h>
+#include <GameBackboneBenchmarks/GameRegionBenchmarks.h>
+#include <GameBackboneBenchmarks/InputRouterBenchmarks.h>
+#include <GameBackboneBenchmarks/UpdateSchedulerBenchmarks.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace GB::Benchmarks;
+
+namespace
+{
+	/// @brief A named set of benchmarks that can be selected from the command line.
+	struct BenchmarkGroup
+	{
+		const char* name;
+		std::vector<BenchmarkResult>(*run)(const BenchmarkOptions&);
+	};
+
+	const BenchmarkGroup BENCHMARK_GROUPS[] = {
+		{ "AnimatedSprite", runAnimatedSpriteBenchmarks },
+		{ "ButtonGestureHandler", runButtonGestureHandlerBenchmarks },
+		{ "CompoundSprite", runCompoundSpriteBenchmarks },
+		{ "GameRegion", runGameRegionBenchmarks },
+		{ "InputRouter", runInputRouterBenchmarks },
+		{ "UpdateScheduler", runUpdateSchedulerBenchmarks }
+	};
+
+	void printUsage()
+	{
+		std::cerr << "Usage: GameBackboneBenchmarks [--format csv|json] [--max-elements N] [--filter GROUP]\n"
+			<< "  --format        Output format. Defaults to csv.\n"
+			<< "  --max-elements  Skip benchmarks that operate on more than N elements. Defaults to 1000000.\n"
+			<< "  --filter        Only run groups whose name contains GROUP.\n"
+			<< "Groups:";
+		for (const BenchmarkGroup& group : BENCHMARK_GROUPS)
+		{
+			std::cerr << ' ' << group.name;
+		}
+		std::cerr << '\n';
+	}
+}
+
+int main(int argc, char* argv[]) {
+	BenchmarkOptions options{};
+	std::string format = "csv";
+	std::string filter;
+
+	for (int ii = 1; ii < argc; ++ii)
+	{
+		const std::string argument = argv[ii];
+		const bool hasValue = ii + 1 < argc;
+		if (argument == "--format" && hasValue)
+		{
+			format = argv[++ii];
+		}
+		else if (argument == "--max-elements" && hasValue)
+		{
+			options.maxElementCount = static_cast<std::size_t>(std::stoull(argv[++ii]));
+		}
+		else if (argument == "--filter" && hasValue)
+		{
+			filter = argv[++ii];
+		}
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+	if (format != "csv" && format != "json")
+	{
+		printUsage();
+		return 1;
+	}
+
+	// Progress goes to stderr so that stdout only holds the results
+	std::vector<BenchmarkResult> results;
+	for (const BenchmarkGroup& group : BENCHMARK_GROUPS)
+	{
+		if (std::string{ group.name }.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+		std::cerr << "Running " << group.name << " benchmarks\n";
+		for (BenchmarkResult& result : group.run(options))
+		{
+			results.push_back(std::move(result));
+		}
+	}
+
+	if (format == "json")
+	{
+		writeBenchmarkResultsJson(std::cout, results);
+	}
+	else
+	{
+		writeBenchmarkHeader(std::cout);
+		for (const BenchmarkResult& result : results)
+		{
+			writeBenchmarkResult(std::cout, result);
+		}
+	}
+	return 0;
+}
@@ -4,9 +4,11 @@
 #include <GameBackbone/Core/Updatable.h>
 #include <GameBackbone/Util/DllUtil.h>
 
+#include <SFML/Config.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace GB {
@@ -19,6 +21,25 @@ namespace GB {
 		ANIMATION_STOP
 	};
 
+	/// @brief Consumes the time of every frame that is due and returns how many frames that is.
+	///		Without frame skipping one frame is due and all of the time is consumed.
+	///		With frame skipping every full delay is one frame, and the time left over is kept for the next frame.
+	/// @param timeSinceLastFrame In: the time (in microseconds) since the last frame. Must be greater than delay.
+	///		Out: the time that is left over.
+	/// @param delay The minimum time (in microseconds) between two frames.
+	/// @param isFrameSkipping True if more than one frame may be due.
+	/// @return The number of frames to advance. Always at least one.
+	libGameBackbone std::uint64_t consumeAnimationTime(sf::Int64& timeSinceLastFrame, sf::Int64 delay, bool isFrameSkipping);
+
+	/// @brief Returns the frame an animation shows after advancing by frameCount frames. Runs in constant time.
+	///		Advancing by n frames is the same as advancing by one frame n times.
+	/// @param currentFrame The frame the animation is showing.
+	/// @param animationSize The number of frames in the animation.
+	/// @param endType What happens when the animation reaches the end.
+	/// @param frameCount The number of frames to advance.
+	/// @param isReverse In: true if an ANIMATION_REVERSE animation is moving backward. Out: the direction after advancing.
+	libGameBackbone unsigned int advanceAnimationFrame(unsigned int currentFrame, std::size_t animationSize, ANIMATION_END_TYPE endType, std::uint64_t frameCount, bool& isReverse);
+
 	/// @brief Sprite with the ability to display several animation states.
 	class libGameBackbone AnimatedSprite : public sf::Sprite, public Updatable {
 	public:
@@ -36,7 +57,7 @@ namespace GB {
 		/// @brief Initializes a new instance of the <see cref="AnimatedSprite"/> class. Initializes texture to first frame of first animation.
 		/// @param texture A texture representing the animation sheet.
 		/// @param animations The animations.
-		AnimatedSprite(const sf::Texture& texture, AnimationSet::Ptr animations);
+		AnimatedSprite(const sf::Texture& texture, AnimationSet::ConstPtr animations);
 
 		/// @brief Copy construct an AnimatedSprite
 		/// @param other The AnimatedSprite to copy
@@ -73,22 +94,32 @@ namespace GB {
 		///		The current frame of the sprite is set to the first frame of the AnimationSet's first Animation
 		///		If the provided AnimationSet is empty an out_of_bounds exception is thrown.
 		/// @param animations The new AnimationSet to use.
-		void setAnimations(AnimationSet::Ptr animations);
+		void setAnimations(AnimationSet::ConstPtr animations);
 
 		/// @brief Sets the minimum time (as sf::Time) between two animation frames.
 		/// @param delay Minimum time (as sf::Time) between two animation frames.
 		void setAnimationDelay(sf::Time delay);
 
+		/// @brief Enables or disables frame skipping. Disabled by default.
+		///		Without frame skipping, an update advances at most one frame and drops any extra time.
+		///		With frame skipping, an update advances one frame for every delay that has elapsed and keeps the time left over,
+		///		so the animation keeps its speed when updates are slower than the animation delay.
+		/// @param frameSkipping True if updates may advance more than one frame. False otherwise.
+		void setFrameSkippingEnabled(bool frameSkipping);
+
+		/// @brief Returns true if an update may advance more than one frame. False otherwise.
+		bool isFrameSkippingEnabled() const;
+
 		/// @brief Returns the current frame of the current animation
 		unsigned int getCurrentFrame() const;
 
-		/// @brief Returns the current animation set on this instance.
-		///		Returns nullptr if no animation has been set.
-		std::size_t getCurrentAnimationId() const;
-
 		/// @brief Returns the ID of the current animation
 		/// @return ID of the current animation.
-		const Animation* getCurrentAnimation() const;
+		std::size_t getCurrentAnimationId() const;
+
+		/// @brief Returns the frames of the current animation.
+		///		Returns nullptr if no animation has been set.
+		const AnimationView* getCurrentAnimation() const;
 
 		/// @brief Returns the minimum time (as sf::Time ) between two animation frames.
 		/// @return The minimum time (as sf::Time) between two animation frames.
@@ -124,13 +155,19 @@ namespace GB {
 		/// @throws std::out_of_range exception if the requested animation is empty.
 		void runAnimation(unsigned int animationId);
 
-		/// @brief Moves the next frame of the active animation if the sprite is animating
+		/// @brief Moves the next frame of the active animation if the sprite is animating.
+		///		Moves one frame for every elapsed delay if frame skipping is enabled.
 		/// @param elapsedTime The elapsed time.
 		void update(sf::Int64 elapsedTime) override;
 
 	protected:
+		/// @brief Shows a frame of the current animation without checking that it exists.
+		/// @param frame The frame. Must be less than the size of the current animation.
+		void showFrame(unsigned int frame);
+
 		bool animating;
 		bool isReverse;
+		bool frameSkippingEnabled;
 		ANIMATION_END_TYPE animationEnd;
 		sf::Time animationDelay;
 		sf::Time timeSinceLastUpdate;
@@ -138,7 +175,7 @@ namespace GB {
 		unsigned int currentFrame;
 		unsigned int framesSpentInCurrentAnimation;
 		std::size_t currentAnimationId;
-		const Animation* currentAnimation;
-		AnimationSet::Ptr animations;
+		AnimationView currentAnimation;
+		AnimationSet::ConstPtr animations;
 	};
 }
\ No newline at end of file
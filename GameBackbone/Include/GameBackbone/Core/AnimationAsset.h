@@ -0,0 +1,219 @@
+#pragma once
+
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Util/MappedFile.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GB {
+
+	/// @brief A read only animation asset in the binary format, used in place without parsing.
+	///		An asset holds animations and atlas regions. Loading checks the header and the bounds of every animation and region once;
+	///		after that the frames are read straight out of the file. Nothing is allocated per frame.
+	///
+	///		Binary layout (native byte order, every field 4 byte aligned). The byte order mark lets a reader reject a file
+	///		written on a machine with the other byte order:
+	///		- Header: "GBAN", byte order mark 0x01020304, version, animation count, frame count, region count, string bytes, reserved.
+	///		- Animation ranges: (offset, size) into the frames for every animation.
+	///		- Frames: (left, top, width, height) as 32 bit signed integers, stored exactly like sf::IntRect.
+	///		- Regions: (name offset, name size, page, reserved, left, top, width, height), sorted by name.
+	///		- Strings: the region names, back to back and padded to a multiple of 4 bytes.
+	///
+	///		Assets are written by AnimationAssetBuilder.
+	class libGameBackbone AnimationAsset {
+	public:
+		/// @brief The newest version of the binary format. Older versions are read, newer versions are rejected.
+		static constexpr std::uint32_t FormatVersion = 1;
+
+		/// @brief A named region of an atlas page.
+		struct Region {
+			/// @brief The name of the region. Points into the asset.
+			std::string_view name;
+			/// @brief The index of the atlas page holding the region.
+			std::size_t page;
+			/// @brief The bounds of the region in the page.
+			sf::IntRect bounds;
+		};
+
+		/// @brief Construct an empty AnimationAsset.
+		AnimationAsset() = default;
+		AnimationAsset(const AnimationAsset&) = delete;
+		AnimationAsset& operator=(const AnimationAsset&) = delete;
+		AnimationAsset(AnimationAsset&& other) noexcept;
+		AnimationAsset& operator=(AnimationAsset&& other) noexcept;
+		~AnimationAsset() = default;
+
+		/// @brief Maps a binary asset file into memory.
+		/// @param path The path of the file.
+		/// @throws std::runtime_error if the file could not be mapped or is not a valid asset.
+		static AnimationAsset loadFromFile(const std::string& path);
+
+		/// @brief Takes ownership of a binary asset that is already in memory.
+		/// @param data The bytes of the asset.
+		/// @throws std::runtime_error if the bytes are not a valid asset.
+		static AnimationAsset loadFromMemory(std::vector<char> data);
+
+		/// @brief Returns the number of animations in the asset.
+		[[nodiscard]]
+		std::size_t getAnimationCount() const noexcept;
+
+		/// @brief Returns the number of frames in the asset across every animation.
+		[[nodiscard]]
+		std::size_t getFrameCount() const noexcept;
+
+		/// @brief Returns the frames of an animation. The view points into the asset.
+		/// @param animationIndex The index of the animation.
+		/// @note Does no runtime safety checks
+		AnimationView operator[](std::size_t animationIndex) const noexcept {
+			const AnimationRange& range = m_ranges[animationIndex];
+			return AnimationView(m_frames + range.offset, range.size);
+		}
+
+		/// @brief Returns the frames of an animation. The view points into the asset.
+		/// @param animationIndex The index of the animation.
+		/// @throws std::out_of_range if the animation does not exist.
+		AnimationView at(std::size_t animationIndex) const;
+
+		/// @brief Returns the number of regions in the asset.
+		[[nodiscard]]
+		std::size_t getRegionCount() const noexcept;
+
+		/// @brief Returns a region. Regions are sorted by name.
+		/// @param regionIndex The index of the region.
+		/// @throws std::out_of_range if the region does not exist.
+		Region getRegion(std::size_t regionIndex) const;
+
+		/// @brief Returns the region with the name.
+		/// @param name The name of the region.
+		/// @throws std::out_of_range if there is no region with the name.
+		Region getRegion(std::string_view name) const;
+
+		/// @brief True if the asset has a region with the name. False otherwise.
+		/// @param name The name of the region.
+		[[nodiscard]]
+		bool containsRegion(std::string_view name) const;
+
+		/// @brief Copies the animations into a new AnimationSet, which can outlive the asset.
+		///		The frames are copied in one pass without allocating per frame.
+		AnimationSet::Ptr makeAnimationSet() const;
+
+	private:
+		friend class AnimationAssetBuilder;
+
+		struct FileHeader {
+			char magic[4];
+			std::uint32_t byteOrder;
+			std::uint32_t version;
+			std::uint32_t animationCount;
+			std::uint32_t frameCount;
+			std::uint32_t regionCount;
+			std::uint32_t stringSize;
+			std::uint32_t reserved;
+		};
+
+		struct AnimationRange {
+			std::uint32_t offset;
+			std::uint32_t size;
+		};
+
+		struct RegionRecord {
+			std::uint32_t nameOffset;
+			std::uint32_t nameSize;
+			std::uint32_t page;
+			std::uint32_t reserved;
+			std::int32_t left;
+			std::int32_t top;
+			std::int32_t width;
+			std::int32_t height;
+		};
+
+		void bind(const char* data, std::size_t size);
+		std::string_view getRegionName(const RegionRecord& region) const noexcept;
+
+		MappedFile m_file;
+		std::vector<char> m_buffer;
+		const FileHeader* m_header = nullptr;
+		const AnimationRange* m_ranges = nullptr;
+		const sf::IntRect* m_frames = nullptr;
+		const RegionRecord* m_regions = nullptr;
+		const char* m_strings = nullptr;
+	};
+
+	/// @brief Collects animations and atlas regions and writes them as an AnimationAsset.
+	///		Also reads and writes the text form of an asset, which is meant to be written by hand:
+	///		@code
+	///		# Comments start with '#'
+	///		version 1
+	///		frameSize 32 32          # The frame size used by cell
+	///		animation                # Starts a new animation
+	///		frame 0 0 32 32          # left top width height
+	///		cell 1 0                 # The frame at column 1, row 0 of frameSize frames
+	///		region hero 0 0 0 64 32  # name page left top width height
+	///		@endcode
+	class libGameBackbone AnimationAssetBuilder {
+	public:
+		/// @brief Construct an empty AnimationAssetBuilder.
+		AnimationAssetBuilder() = default;
+
+		/// @brief Construct an AnimationAssetBuilder holding the contents of an asset, for example to convert it to text.
+		/// @param asset The asset to copy.
+		explicit AnimationAssetBuilder(const AnimationAsset& asset);
+
+		/// @brief Reads the text form of an asset.
+		/// @param input The text.
+		/// @throws std::runtime_error naming the line if the text is not valid.
+		static AnimationAssetBuilder readText(std::istream& input);
+
+		/// @brief Adds an animation.
+		/// @param animation The frames of the animation.
+		void addAnimation(const Animation& animation);
+
+		/// @brief Adds a named atlas region.
+		/// @param name The name of the region. Must not be empty or contain whitespace.
+		/// @param page The index of the atlas page holding the region.
+		/// @param bounds The bounds of the region in the page.
+		/// @throws std::invalid_argument if the name is not valid or was already added.
+		void addRegion(std::string name, std::size_t page, sf::IntRect bounds);
+
+		/// @brief Returns the animations added so far.
+		[[nodiscard]]
+		const AnimationSet& getAnimations() const noexcept;
+
+		/// @brief Returns the number of regions added so far.
+		[[nodiscard]]
+		std::size_t getRegionCount() const noexcept;
+
+		/// @brief Writes the asset in the binary format.
+		/// @param output The stream to write to. Should be opened in binary mode.
+		/// @throws std::length_error if the asset is too large for the format.
+		void writeBinary(std::ostream& output) const;
+
+		/// @brief Returns the asset in the binary format.
+		/// @throws std::length_error if the asset is too large for the format.
+		std::vector<char> toBinary() const;
+
+		/// @brief Writes the text form of the asset. Every frame is written as a frame line.
+		/// @param output The stream to write to.
+		void writeText(std::ostream& output) const;
+
+	private:
+		struct RegionEntry {
+			std::string name;
+			std::size_t page;
+			sf::IntRect bounds;
+		};
+
+		AnimationSet m_animations;
+		// Kept sorted by name so that the asset can binary search them
+		std::vector<RegionEntry> m_regions;
+	};
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/UniformAnimationSet.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// @brief Interns AnimationSets so that identical animations are only stored once.
+	///		Asking for the same animations twice returns the same shared AnimationSet. The returned AnimationSets are const,
+	///		so one user cannot change the animations of another.
+	///
+	///		Sets are identified by their frames. Two uniform definitions that produce the same frames share one AnimationSet.
+	///		All member functions are thread safe.
+	class libGameBackbone AnimationRegistry {
+	public:
+		/// @brief Construct an empty AnimationRegistry.
+		AnimationRegistry() = default;
+		AnimationRegistry(const AnimationRegistry&) = delete;
+		AnimationRegistry& operator=(const AnimationRegistry&) = delete;
+		AnimationRegistry(AnimationRegistry&&) = delete;
+		AnimationRegistry& operator=(AnimationRegistry&&) = delete;
+		~AnimationRegistry() = default;
+
+		/// @brief Returns the AnimationRegistry shared by the whole process.
+		static AnimationRegistry& getGlobal();
+
+		/// @brief Returns the shared AnimationSet holding the provided animations.
+		///		The AnimationSet is created the first time these animations are requested.
+		/// @param animations The animations of the AnimationSet.
+		AnimationSet::ConstPtr getAnimationSet(const std::vector<Animation>& animations);
+
+		/// @brief Returns the shared AnimationSet holding the provided uniform animations.
+		///		The frames are built like UniformAnimationSet builds them.
+		///		The AnimationSet is created the first time these frames are requested.
+		/// @param frameSize The size of every frame.
+		/// @param animations The animations as (x, y) coordinates into the texture's frames.
+		AnimationSet::ConstPtr getUniformAnimationSet(sf::Vector2i frameSize, const std::vector<UniformAnimation>& animations);
+
+		/// @brief Returns the number of distinct AnimationSets held by the registry.
+		[[nodiscard]]
+		std::size_t getSetCount() const;
+
+		/// @brief Returns the number of frames held by the registry across every AnimationSet.
+		[[nodiscard]]
+		std::size_t getFrameCount() const;
+
+		/// @brief Returns the approximate number of bytes used by the AnimationSets held by the registry.
+		[[nodiscard]]
+		std::size_t getMemoryUsage() const;
+
+		/// @brief Returns the approximate number of bytes that sharing has saved.
+		///		That is the memory every user outside the registry would use if each had built its own copy of its AnimationSet.
+		[[nodiscard]]
+		std::size_t getMemorySaved() const;
+
+		/// @brief Releases the AnimationSets that are no longer used outside of the registry.
+		/// @return The number of AnimationSets released.
+		std::size_t removeUnused();
+
+		/// @brief Releases every AnimationSet. AnimationSets still in use stay valid for their users, but are no longer shared.
+		void clear();
+
+	private:
+		mutable std::mutex m_mutex;
+		// Keyed by a hash of the frames. Sets with colliding hashes share a bucket and are told apart by comparing frames.
+		std::unordered_multimap<std::size_t, AnimationSet::ConstPtr> m_sets;
+	};
+}
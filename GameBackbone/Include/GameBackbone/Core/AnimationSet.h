@@ -6,6 +6,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -14,28 +15,164 @@ namespace GB {
     /// @brief Collection of texture subsections
     using Animation = std::vector<sf::IntRect>;
 
+    /// @brief Read only view of the frames of one animation. Cheap to copy.
+    ///     Views into an AnimationSet stay valid until animations are added to or erased from that AnimationSet.
+    class libGameBackbone AnimationView {
+    public:
+        using value_type = sf::IntRect;
+        using size_type = std::size_t;
+        using const_iterator = const sf::IntRect*;
+        using iterator = const_iterator;
+
+        /// @brief Construct an empty AnimationView
+        constexpr AnimationView() noexcept : m_frames(nullptr), m_size(0) {}
+
+        /// @brief Construct a view of size frames starting at frames.
+        /// @param frames The first frame.
+        /// @param size The number of frames.
+        constexpr AnimationView(const sf::IntRect* frames, std::size_t size) noexcept : m_frames(frames), m_size(size) {}
+
+        /// @brief Construct a view of the frames of an Animation.
+        /// @param animation The Animation to view.
+        AnimationView(const Animation& animation) noexcept : m_frames(animation.data()), m_size(animation.size()) {}
+
+        /// @brief Access the frame at the given index.
+        /// @note Does no runtime safety checks
+        constexpr const sf::IntRect& operator[](std::size_t frameIndex) const noexcept {
+            return m_frames[frameIndex];
+        }
+
+        /// @brief Access the frame at the given index.
+        /// @throws Throws out_of_range exception if the provided index is not less than the number of frames.
+        const sf::IntRect& at(std::size_t frameIndex) const;
+
+        /// @brief Returns the first frame. The view must not be empty.
+        constexpr const sf::IntRect& front() const noexcept {
+            return m_frames[0];
+        }
+
+        /// @brief Returns the last frame. The view must not be empty.
+        constexpr const sf::IntRect& back() const noexcept {
+            return m_frames[m_size - 1];
+        }
+
+        /// @brief Returns a pointer to the first frame.
+        constexpr const sf::IntRect* data() const noexcept {
+            return m_frames;
+        }
+
+        /// @brief Returns the number of frames.
+        constexpr std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// @brief Returns true if there are no frames. Returns false otherwise.
+        constexpr bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        /// @brief Iterator to the first frame.
+        constexpr const_iterator begin() const noexcept {
+            return m_frames;
+        }
+
+        /// @brief Iterator past the last frame.
+        constexpr const_iterator end() const noexcept {
+            return m_frames + m_size;
+        }
+
+    private:
+        const sf::IntRect* m_frames;
+        std::size_t m_size;
+    };
+
+    /// @brief True if both views hold the same frames in the same order.
+    libGameBackbone bool operator==(const AnimationView& left, const AnimationView& right) noexcept;
+
+    /// @brief True if the views do not hold the same frames in the same order.
+    libGameBackbone bool operator!=(const AnimationView& left, const AnimationView& right) noexcept;
+
     /// @brief Creates and owns a collection of animations.
+    ///     The frames of every animation are stored back to back in one buffer. Each animation is an offset and a length into that buffer.
     class libGameBackbone AnimationSet {
     private:
-        using InternalContainer = std::vector<Animation>;
+        /// @brief Where the frames of one animation are in the frame buffer.
+        struct AnimationRange {
+            std::size_t offset;
+            std::size_t size;
+        };
 
     public:
-        // Iterator types
-        using iterator = InternalContainer::iterator;
-        using const_iterator = InternalContainer::const_iterator;
-        using reverse_iterator = InternalContainer::reverse_iterator;
-        using const_reverse_iterator = InternalContainer::const_reverse_iterator;
+        /// @brief Random access iterator over the animations of an AnimationSet. Dereferences to an AnimationView.
+        class const_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = AnimationView;
+            using difference_type = std::ptrdiff_t;
+            using reference = AnimationView;
+
+            /// @brief Lets it->size() work on an iterator that produces its views by value.
+            class pointer {
+            public:
+                explicit pointer(AnimationView view) noexcept : m_view(view) {}
+                const AnimationView* operator->() const noexcept { return &m_view; }
+            private:
+                AnimationView m_view;
+            };
+
+            const_iterator() noexcept = default;
+            const_iterator(const AnimationSet* animationSet, std::size_t index) noexcept : m_animationSet(animationSet), m_index(index) {}
+
+            AnimationView operator*() const noexcept { return (*m_animationSet)[m_index]; }
+            pointer operator->() const noexcept { return pointer(**this); }
+            AnimationView operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+            const_iterator& operator++() noexcept { ++m_index; return *this; }
+            const_iterator operator++(int) noexcept { const_iterator old = *this; ++m_index; return old; }
+            const_iterator& operator--() noexcept { --m_index; return *this; }
+            const_iterator operator--(int) noexcept { const_iterator old = *this; --m_index; return old; }
+            const_iterator& operator+=(difference_type offset) noexcept { m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + offset); return *this; }
+            const_iterator& operator-=(difference_type offset) noexcept { return *this += -offset; }
+            friend const_iterator operator+(const_iterator iter, difference_type offset) noexcept { return iter += offset; }
+            friend const_iterator operator+(difference_type offset, const_iterator iter) noexcept { return iter += offset; }
+            friend const_iterator operator-(const_iterator iter, difference_type offset) noexcept { return iter -= offset; }
+            friend difference_type operator-(const const_iterator& left, const const_iterator& right) noexcept {
+                return static_cast<difference_type>(left.m_index) - static_cast<difference_type>(right.m_index);
+            }
+
+            friend bool operator==(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index == right.m_index; }
+            friend bool operator!=(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index != right.m_index; }
+            friend bool operator<(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index < right.m_index; }
+            friend bool operator>(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index > right.m_index; }
+            friend bool operator<=(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index <= right.m_index; }
+            friend bool operator>=(const const_iterator& left, const const_iterator& right) noexcept { return left.m_index >= right.m_index; }
+
+            /// @brief Returns the index of the animation the iterator points to.
+            std::size_t getIndex() const noexcept { return m_index; }
+
+        private:
+            const AnimationSet* m_animationSet = nullptr;
+            std::size_t m_index = 0;
+        };
+
+        // Iterator types. Animations can only be changed through the AnimationSet, so every iterator is const.
+        using iterator = const_iterator;
+        using reverse_iterator = std::reverse_iterator<const_iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
         /// @brief shared_ptr to AnimationSet.
         using Ptr = std::shared_ptr<AnimationSet>;
 
+        /// @brief shared_ptr to an AnimationSet that cannot be changed. Used for AnimationSets that are shared between many users.
+        using ConstPtr = std::shared_ptr<const AnimationSet>;
+
         /// @brief Construct an empty AnimationSet
         AnimationSet() = default;
 
         /// @brief Construct a new AnimationSet object.
         ///     The provided animations will all be added to the animation set.
         /// @param animations The animations to add.
-        AnimationSet(std::vector<Animation> animations);
+        AnimationSet(const std::vector<Animation>& animations);
 
         /// @brief Copy construct an AnimationSet
         /// @param  The AnimationSet to copy
@@ -60,7 +197,18 @@ namespace GB {
 
         /// @brief Adds the animation to the AnimationSet.
         /// @param animation The animation to add.
-        void addAnimation(Animation animation);
+        void addAnimation(const Animation& animation);
+
+        /// @brief Adds the frames in [first, last) to the AnimationSet as one animation.
+        ///     Does not allocate anything besides the room for the frames.
+        /// @param first The first frame of the animation.
+        /// @param last One past the last frame of the animation.
+        template <class InputIterator>
+        void addAnimation(InputIterator first, InputIterator last) {
+            const std::size_t offset = m_frames.size();
+            m_frames.insert(m_frames.end(), first, last);
+            m_ranges.push_back(AnimationRange{ offset, m_frames.size() - offset });
+        }
 
         /// @brief Removes an animation from the AnimationSet.
         /// @param animation The animation to remove.
@@ -74,62 +222,65 @@ namespace GB {
         /// @brief Remove all animations from the AnimationSet.
         void clearAnimations();
 
+        /// @brief Reserves room for more animations and frames so that adding them does not reallocate.
+        /// @param animationCount The total number of animations to make room for.
+        /// @param frameCount The total number of frames to make room for.
+        void reserve(std::size_t animationCount, std::size_t frameCount);
+
         /// @brief Access the animation at the given index.
         /// @param animationIndex The index of the animation to return.
         /// @return The animation at the provided index.
         /// @note Does no runtime safety checks
-        const Animation& operator[](std::size_t animationIndex) const noexcept;
+        AnimationView operator[](std::size_t animationIndex) const noexcept {
+            const AnimationRange& range = m_ranges[animationIndex];
+            return AnimationView(m_frames.data() + range.offset, range.size);
+        }
 
         /// @brief Access the animation at the given index.
         /// @param animationIndex The index of the animation to return. 
         /// @return The animation at the provided index. 
         /// @throws Throws out_of_range exception if the provided index is greater than the
         ///     number of animations stored by the AnimationSet.
-        const Animation& at(std::size_t animationIndex) const;
+        AnimationView at(std::size_t animationIndex) const;
 
         /// @brief Returns the number of Animations stored by the AnimationSet.
         std::size_t getSize() const;
 
+        /// @brief Returns the number of frames stored by the AnimationSet across every animation.
+        std::size_t getFrameCount() const noexcept;
+
+        /// @brief Returns the approximate number of bytes used by the AnimationSet.
+        std::size_t getMemoryUsage() const noexcept;
+
         /// @brief Returns true if the AnimationSet holds no animations. Returns false otherwise.
         bool isEmpty() const;
 
         /// @brief Iterator to the beginning of the AnimationSet.
-        iterator begin();
-
-        /// @brief Const iterator to the beginning of the AnimationSet.
         const_iterator begin() const noexcept;
 
         /// @brief Const iterator to the beginning of the AnimationSet.
         const_iterator cbegin() const noexcept;
 
         /// @brief Iterator to the end of the AnimationSet.
-        iterator end();
-
-        /// @brief Const iterator to the end of the AnimationSet.
         const_iterator end() const noexcept;
 
         /// @brief Const iterator to the end of the AnimationSet.
         const_iterator cend() const noexcept;
 
         /// @brief Reverse iterator to the beginning of the AnimationSet.
-        reverse_iterator rbegin();
-
-        /// @brief Reverse const iterator to the beginning of the AnimationSet.
         const_reverse_iterator rbegin() const noexcept;
 
         /// @brief Reverse const iterator to the beginning of the AnimationSet.
         const_reverse_iterator crbegin() const noexcept;
 
         /// @brief Reverse iterator to the end of the AnimationSet.
-        reverse_iterator rend();
-
-        /// @brief Reverse const iterator to the end of the AnimationSet.
         const_reverse_iterator rend() const noexcept;
 
         /// @brief Reverse const iterator to the end of the AnimationSet.
         const_reverse_iterator crend() const noexcept;
 
     private:
-        InternalContainer animations;
+        std::vector<sf::IntRect> m_frames;
+        std::vector<AnimationRange> m_ranges;
     };
 }
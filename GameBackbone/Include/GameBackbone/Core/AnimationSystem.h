@@ -0,0 +1,145 @@
+#pragma once
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/Updatable.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// @brief Animates many sprites in one update.
+	///		Behaves like giving each sprite the state of an AnimatedSprite, but stores each piece of that state in its own array.
+	///		Each update advances every animation in one loop over those arrays, then only sets the texture rect of the sprites whose frame changed.
+	///
+	///		Sprites are referenced, not owned. A sprite must stay at the same address until it is removed.
+	class libGameBackbone AnimationSystem : public Updatable {
+	public:
+		AnimationSystem() = default;
+		AnimationSystem(const AnimationSystem&) = delete;
+		AnimationSystem& operator=(const AnimationSystem&) = delete;
+		AnimationSystem(AnimationSystem&&) noexcept = default;
+		AnimationSystem& operator=(AnimationSystem&&) noexcept = default;
+		~AnimationSystem() override = default;
+
+		/// @brief Starts animating a sprite with the provided animations. The sprite shows the first frame of the first animation.
+		///		The sprite does not animate until runAnimation is called. If the sprite was already added, its animations are replaced
+		///		and its animation state is reset.
+		/// @param sprite The sprite to animate.
+		/// @param animations The animations of the sprite.
+		/// @throws std::out_of_range if animations is nullptr, is empty, or its first animation is empty.
+		void addSprite(sf::Sprite& sprite, AnimationSet::ConstPtr animations);
+
+		/// @brief Stops animating a sprite. The sprite keeps its current texture rect. Does nothing if the sprite was not added.
+		/// @param sprite The sprite to remove.
+		void removeSprite(const sf::Sprite& sprite);
+
+		/// @brief Stops animating every sprite.
+		void clearSprites();
+
+		/// @brief True if the sprite was added. False otherwise.
+		/// @param sprite The sprite to look for.
+		[[nodiscard]]
+		bool containsSprite(const sf::Sprite& sprite) const;
+
+		/// @brief Returns the number of sprites being animated.
+		[[nodiscard]]
+		std::size_t getSpriteCount() const noexcept;
+
+		/// @brief Begins an animation from its first frame and shows that frame immediately.
+		/// @param sprite The sprite to animate.
+		/// @param animationId The index of the animation in the sprite's AnimationSet.
+		/// @param endStyle What happens when the animation reaches the end.
+		/// @throws std::out_of_range if the sprite was not added or the requested animation does not exist or is empty.
+		void runAnimation(const sf::Sprite& sprite, unsigned int animationId, ANIMATION_END_TYPE endStyle = ANIMATION_END_TYPE::ANIMATION_LOOP);
+
+		/// @brief Pauses or resumes the animation of a sprite.
+		/// @param sprite The sprite.
+		/// @param animating True if the sprite should animate. False otherwise.
+		/// @throws std::out_of_range if the sprite was not added.
+		void setAnimating(const sf::Sprite& sprite, bool animating);
+
+		/// @brief Sets the minimum time between two frames of a sprite's animation.
+		/// @param sprite The sprite.
+		/// @param delay The minimum time between two frames.
+		/// @throws std::out_of_range if the sprite was not added.
+		void setAnimationDelay(const sf::Sprite& sprite, sf::Time delay);
+
+		/// @brief True if the sprite is animating. False otherwise.
+		/// @throws std::out_of_range if the sprite was not added.
+		[[nodiscard]]
+		bool isAnimating(const sf::Sprite& sprite) const;
+
+		/// @brief Returns the minimum time between two frames of a sprite's animation.
+		/// @throws std::out_of_range if the sprite was not added.
+		[[nodiscard]]
+		sf::Time getAnimationDelay(const sf::Sprite& sprite) const;
+
+		/// @brief Returns the index of the animation a sprite is running.
+		/// @throws std::out_of_range if the sprite was not added.
+		[[nodiscard]]
+		unsigned int getCurrentAnimationId(const sf::Sprite& sprite) const;
+
+		/// @brief Returns the current frame of a sprite's animation.
+		/// @throws std::out_of_range if the sprite was not added.
+		[[nodiscard]]
+		unsigned int getCurrentFrame(const sf::Sprite& sprite) const;
+
+		/// @brief Returns the number of frames that have been displayed since a sprite's animation started.
+		/// @throws std::out_of_range if the sprite was not added.
+		[[nodiscard]]
+		unsigned int getFramesSpentInCurrentAnimation(const sf::Sprite& sprite) const;
+
+		/// @brief Enables or disables frame skipping for every sprite. Disabled by default.
+		///		See AnimatedSprite::setFrameSkippingEnabled.
+		/// @param frameSkipping True if updates may advance more than one frame. False otherwise.
+		void setFrameSkippingEnabled(bool frameSkipping) noexcept;
+
+		/// @brief Returns true if an update may advance more than one frame. False otherwise.
+		[[nodiscard]]
+		bool isFrameSkippingEnabled() const noexcept;
+
+		/// @brief Returns the number of sprites whose texture rect was set by the last update.
+		[[nodiscard]]
+		std::size_t getLastChangedCount() const noexcept;
+
+		/// @brief Advances the animation of every animating sprite.
+		///		Follows the same rules as AnimatedSprite::update.
+		/// @param elapsedTime The time since the last update in microseconds.
+		void update(sf::Int64 elapsedTime) override;
+
+	private:
+		std::size_t getIndex(const sf::Sprite& sprite) const;
+		void startAnimation(std::size_t index, unsigned int animationId, ANIMATION_END_TYPE endStyle);
+
+		// Reverse index from each sprite to its place in the arrays
+		std::unordered_map<const sf::Sprite*, std::size_t> m_indices;
+
+		// The state of every sprite. The same index in each array belongs to the same sprite.
+		std::vector<sf::Sprite*> m_sprites;
+		std::vector<AnimationSet::ConstPtr> m_animationSets;
+		std::vector<const sf::IntRect*> m_frameRects;
+		std::vector<unsigned int> m_frameCounts;
+		std::vector<unsigned int> m_currentAnimationIds;
+		std::vector<unsigned int> m_currentFrames;
+		std::vector<unsigned int> m_framesSpent;
+		std::vector<sf::Int64> m_timers;
+		std::vector<sf::Int64> m_delays;
+		std::vector<ANIMATION_END_TYPE> m_endTypes;
+		std::vector<std::uint8_t> m_isReverse;
+		// Read by the timer loop, so stored as 32 bits rather than as bool or char. Char stores may alias every other array.
+		std::vector<std::uint32_t> m_isAnimating;
+		std::vector<std::uint32_t> m_isDue;
+
+		bool m_isFrameSkippingEnabled = false;
+		std::size_t m_lastChangedCount = 0;
+	};
+}
@@ -6,10 +6,38 @@
 
 #include <SFML/Graphics/Drawable.hpp>
 
+#include <atomic>
 #include <functional>
+#include <future>
 #include <memory>
 
 namespace GB {
+
+	/// @brief Where a region is in its lifecycle. Tracked by the CoreEventController and stored on the region.
+	///		Regions move from Unloaded to Preloading to Ready, then between Ready and Active as they are swapped in and out,
+	///		and back to Unloaded when they are unloaded.
+	enum class RegionState
+	{
+		Unloaded,
+		Preloading,
+		Ready,
+		Active
+	};
+
+	/// @brief Lets a region report how much of its preload is done. Safe to use from any thread.
+	class libGameBackbone PreloadProgress {
+	public:
+		/// @brief Sets how much of the preload is done.
+		/// @param progress From 0 to 1. Values outside of that range are clamped.
+		void setProgress(float progress) noexcept;
+
+		/// @brief Returns how much of the preload is done, from 0 to 1.
+		[[nodiscard]]
+		float getProgress() const noexcept;
+
+	private:
+		std::atomic<float> m_progress{ 0.f };
+	};
 	
 	/// @brief Abstract class providing an interface to control game logic and actors for a specific time or space in game.
 	class libGameBackbone BasicGameRegion : public sf::Drawable, public Updatable, public InputHandler{
@@ -54,7 +82,54 @@ namespace GB {
 		/// @param nextRegion The region that should become active.
 		void setNextRegion(BasicGameRegion& nextRegion);
 
+		/// @brief Called before each draw while the CoreEventController updates in fixed timesteps.
+		///		Override to draw moving objects between where they were at the last two updates. Does nothing by default.
+		/// @param alpha How far the frame is between the last update and the next one, from 0 to 1.
+		virtual void interpolate([[maybe_unused]] float alpha) {}
+
+		/// @brief Called between updates while the CoreEventController runs updating and drawing on separate threads.
+		///		Override to copy the state that draw needs into a snapshot that the update never changes.
+		///		Draw must only use the snapshot, since the region is updated while it is drawn. Does nothing by default.
+		virtual void publishRenderState() {}
+
+		/// @brief Does the expensive setup of the region before it becomes active, such as building a level or loading its resources.
+		///		Called once by the CoreEventController before the region is first activated, and again after the region is unloaded.
+		///		If the region is preloaded with CoreEventController::preloadRegion this runs on a background thread while another region
+		///		is active, so it must not touch anything the active region uses. Does nothing by default.
+		/// @param progress Where to report how much of the preload is done.
+		virtual void preload([[maybe_unused]] PreloadProgress& progress) {}
+
+		/// @brief Called on the window thread when the region becomes the active region. Does nothing by default.
+		virtual void activate() {}
+
+		/// @brief Called on the window thread when the region stops being the active region. Does nothing by default.
+		virtual void deactivate() {}
+
+		/// @brief Releases what preload set up. Called by CoreEventController::unloadRegion. Does nothing by default.
+		virtual void unload() {}
+
 	private:
+		friend class CoreEventController;
+
+		/// @brief Where the region is in its lifecycle. Kept on the region so that it ends with the region.
+		///		It belongs to the object rather than to its contents: copies and moves start Unloaded, and assignment keeps the lifecycle of the target.
+		struct Lifecycle
+		{
+			Lifecycle() = default;
+			Lifecycle(const Lifecycle&) noexcept {}
+			Lifecycle(Lifecycle&&) noexcept {}
+			Lifecycle& operator=(const Lifecycle&) noexcept { return *this; }
+			Lifecycle& operator=(Lifecycle&&) noexcept { return *this; }
+			~Lifecycle() = default;
+
+			RegionState state = RegionState::Unloaded;
+			// Created by the first preload. Shared with the preload so that it can report progress from a background thread.
+			std::shared_ptr<PreloadProgress> progress;
+			// Valid while the region is preloading on a background thread
+			std::future<void> preload;
+		};
+
 		std::reference_wrapper<BasicGameRegion> m_nextRegion;
+		Lifecycle m_lifecycle;
 	};
 }
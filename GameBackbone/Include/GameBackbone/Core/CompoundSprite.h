@@ -4,13 +4,20 @@
 #include <GameBackbone/Core/Updatable.h>
 #include <GameBackbone/Util/DllUtil.h>
 
+#include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <set>
 #include <utility>
 #include <vector>
@@ -139,7 +146,7 @@ namespace GB
 		/// @brief Returns a vector of all prioties within the CompoundSprite
 		std::vector<int> getComponentPriorties();
 
-		/// @brief Returns all Components for a given priority
+		/// @brief Returns all Components for a given priority.
 		/// @param priority The priority of the Components to get
 		std::vector<ComponentWrapper*> getComponentsWithPriorty(int priority);
 
@@ -169,6 +176,9 @@ namespace GB
 			std::enable_if_t<is_component_v<Component>, bool> = true
 		>
 		Component& addComponent(int priority, Component component) {
+			// Deferred transforms only apply to the components that existed when they were made.
+			applyPendingTransform();
+
 			/* Moving the origin moves the drawn entity in the opposite direction.
 			 * Move the origin of the component to the current position of the CompoundSprite
 			 * and offset it by the origin of the CompoundSprite (this keeps things in the right place
@@ -185,6 +195,7 @@ namespace GB
 			// Add the component to the prioritizedComponents
 			auto it = m_prioritizedComponents.emplace(priority, std::make_unique<ComponentAdapter<Component>>(std::move(component)));
 			std::unique_ptr<ComponentWrapper>& returnValue = it->second;
+			invalidateBatch();
 		
 			// Return the place in the components vector that the new component was placed.
 			return static_cast<Component&>(returnValue->getDataAsDrawable());
@@ -202,7 +213,7 @@ namespace GB
 		{
 			// Find the drawable inside of the internal map.
 			auto it = std::find_if(m_prioritizedComponents.begin(), m_prioritizedComponents.end(),
-				[&componentToRemove](const std::pair<int, std::unique_ptr<ComponentWrapper>>& possibleRemoval) -> bool {
+				[&componentToRemove](const std::pair<const int, std::unique_ptr<ComponentWrapper>>& possibleRemoval) -> bool {
 					sf::Drawable& underlyingData = possibleRemoval.second->getDataAsDrawable();
 					return &(underlyingData) == &componentToRemove;
 				});
@@ -211,12 +222,44 @@ namespace GB
 			if (it != m_prioritizedComponents.end())
 			{
 				m_prioritizedComponents.erase(it);
+				invalidateBatch();
 			}
 		}
 
 		/// @brief Removes all components from the compound sprite
 		void clearComponents();
 
+		// Batched drawing
+
+		/// @brief Enables or disables batched drawing.
+		///		While enabled, sf::Sprite components of the same priority that share a texture are drawn with a single draw call.
+		///		All other components are drawn individually. Within a priority, every sprite of a texture is drawn at the
+		///		position of the first sprite of that texture.
+		/// @param enabled True to batch sprites by texture. False to draw every component individually.
+		void setBatchDrawingEnabled(bool enabled);
+
+		/// @brief True if batched drawing is enabled. False otherwise.
+		bool isBatchDrawingEnabled() const;
+
+		/// @brief Returns the number of draw calls issued by one batched draw of this CompoundSprite.
+		std::size_t getBatchedDrawCount() const;
+
+		// Deferred transforms
+
+		/// @brief Enables or disables deferred transforms.
+		///		While enabled, moving, rotating, scaling, or setting the origin of the CompoundSprite only records the change.
+		///		The change is applied to every component at once the next time the CompoundSprite is drawn or its components
+		///		are accessed through the CompoundSprite. References to components may be out of date until then.
+		///		Disabling deferred transforms applies any recorded change immediately.
+		/// @param enabled True to defer transforms. False to apply every transform to the components immediately.
+		void setDeferredTransformsEnabled(bool enabled);
+
+		/// @brief True if deferred transforms are enabled. False otherwise.
+		bool isDeferredTransformsEnabled() const;
+
+		/// @brief Applies any recorded transform change to the components.
+		void applyDeferredTransforms();
+
 		// Transformable API
 
 		/// @brief Sets the position.
@@ -289,6 +332,26 @@ namespace GB
 		virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 	private:
+		/// @brief Marks the cached batch as out of date. It is rebuilt on the next batched draw.
+		void invalidateBatch();
+
+		/// @brief True if the cached batch was built from the components as they are now.
+		///		Compares every sprite with how it looked when the batch was built, so sprites changed through references
+		///		to the components are found too.
+		bool isBatchCurrent() const;
+
+		/// @brief Rebuilds the cached batch from the current state of the components.
+		void rebuildBatch() const;
+
+		/// @brief Draw all the components using the cached batch.
+		/// @param target The render target to be drawn to. 
+		/// @param states Current render states.
+		void drawBatched(sf::RenderTarget& target, sf::RenderStates states) const;
+
+		/// @brief Applies the recorded transform change to the components and clears it.
+		///		Const so that it can be called from draw.
+		void applyPendingTransform() const;
+
 		/// @brief Helper Class used by ComponentWrapper to virtually forward calls from sf::Transformables
 		///  to ComponentAdapter which will then forward the calls nonvirtually to the type erased data. 
 		class VirtualTransformable : public sf::Transformable {
@@ -346,6 +409,10 @@ namespace GB
 			/// @brief Returns the data stored within the ComponentWrapper as an sf::Drawable&
 			virtual sf::Drawable& getDataAsDrawable() = 0;
 
+			/// @brief Returns the data stored within the ComponentWrapper as an sf::Sprite*.
+			///		Returns nullptr if the data is not an sf::Sprite.
+			virtual const sf::Sprite* getDataAsSprite() const { return nullptr; }
+
 			/// @brief Returns the data stored within the ComponentWrapper cast to the passed in type.
 			/// @tparam ExpectedComponentType The type of the data within the ComponentWrapper. The type to return the data as.
 			/// @throws BadComponentCast Thrown when the data is not of ExpectedComponentType.
@@ -413,6 +480,18 @@ namespace GB
 				return m_data;
 			}
 
+			const sf::Sprite* getDataAsSprite() const override
+			{
+				if constexpr (std::is_base_of_v<sf::Sprite, Component>)
+				{
+					return &m_data;
+				}
+				else
+				{
+					return nullptr;
+				}
+			}
+
 			// Overrides for the VirtualTransformable API. Forwards to the data.
 			void setPosition(float x, float y) override { m_data.setPosition(x, y); }
 			void setPosition(const sf::Vector2f& position) override { m_data.setPosition(position); }
@@ -437,7 +516,70 @@ namespace GB
 			Component m_data;
 		};
 
+		/// @brief A single draw call of the batched draw path.
+		///		Either a vertex array of sprites that share a texture or a single component that cannot be batched.
+		struct BatchDrawStep
+		{
+			const sf::Texture* texture;
+			sf::VertexArray vertices;
+			const sf::Drawable* drawable;
+		};
+
+		/// @brief Everything about a sprite that the batched vertices are built from.
+		struct BatchedSpriteState
+		{
+			explicit BatchedSpriteState(const sf::Sprite& sprite) :
+				texture(sprite.getTexture()),
+				textureRect(sprite.getTextureRect()),
+				color(sprite.getColor()),
+				transform(sprite.getTransform())
+			{
+			}
+
+			bool operator==(const BatchedSpriteState& other) const
+			{
+				return texture == other.texture && textureRect == other.textureRect && color == other.color &&
+					std::equal(transform.getMatrix(), transform.getMatrix() + 16, other.transform.getMatrix());
+			}
+
+			const sf::Texture* texture;
+			sf::IntRect textureRect;
+			sf::Color color;
+			sf::Transform transform;
+		};
+
+		/// @brief A transform change that has been applied to the CompoundSprite but not yet to its components.
+		///		Each part matches what the eager transform functions do to a component, so applying it gives the same result.
+		struct PendingTransform
+		{
+			/// @brief Added to the position of each component.
+			sf::Vector2f positionOffset{ 0.f, 0.f };
+
+			/// @brief Added to the origin of each component.
+			sf::Vector2f originOffset{ 0.f, 0.f };
+
+			/// @brief Added to the rotation of each component, or its new rotation if isRotationAbsolute.
+			float rotation = 0.f;
+			bool isRotationAbsolute = false;
+
+			/// @brief Multiplied with the scale of each component, or its new scale if isScaleAbsolute.
+			sf::Vector2f scale{ 1.f, 1.f };
+			bool isScaleAbsolute = false;
+		};
+
 		// Internal storage of the Components for CompoundSprite
 		std::multimap<int, std::unique_ptr<ComponentWrapper>> m_prioritizedComponents;
+
+		// Batched drawing
+		bool m_isBatchDrawingEnabled = false;
+		mutable bool m_isBatchDirty = true;
+		mutable std::vector<BatchDrawStep> m_batchDrawSteps;
+		// How each sprite component looked when the batch was built, in component order
+		mutable std::vector<BatchedSpriteState> m_batchedSpriteStates;
+
+		// Deferred transforms
+		bool m_isDeferredTransformsEnabled = false;
+		mutable bool m_hasPendingTransform = false;
+		mutable PendingTransform m_pendingTransform;
 	};
 }
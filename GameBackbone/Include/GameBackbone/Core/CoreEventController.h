@@ -1,10 +1,14 @@
 #pragma once
 
+#include <GameBackbone/Core/FrameProfiler.h>
 #include <GameBackbone/Core/GameRegion.h>
+#include <GameBackbone/Core/TextureLoader.h>
 
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <iostream>
 
@@ -61,9 +65,112 @@ namespace GB {
 		/// @brief Returns the window owned by this CoreEventController.
 		sf::RenderWindow& getWindow();
 
+		/// @brief Updates the active region in fixed steps instead of once per frame.
+		///		Each frame, the elapsed time is added to an accumulator and the region is updated once for every full timestep
+		///		in it. Time left over after maxUpdatesPerFrame updates is dropped so that a slow frame cannot cause a longer one.
+		/// @param timestep The elapsed time passed to each update in microseconds. Must be positive.
+		/// @param maxUpdatesPerFrame The most updates to run in one frame while catching up. Must be positive.
+		/// @throws std::invalid_argument if timestep or maxUpdatesPerFrame is not positive.
+		void setFixedTimestep(sf::Int64 timestep, int maxUpdatesPerFrame = DEFAULT_MAX_UPDATES_PER_FRAME);
+
+		/// @brief Updates the active region once per frame with the time since the last frame. This is the default.
+		void disableFixedTimestep();
+
+		/// @brief True if the active region is updated in fixed steps. False otherwise.
+		bool isFixedTimestepEnabled() const;
+
+		/// @brief Returns the elapsed time passed to each update while the fixed timestep is enabled, in microseconds.
+		sf::Int64 getFixedTimestep() const;
+
+		/// @brief Returns how far the frame being drawn is between the last update and the next one, from 0 to 1.
+		///		Always 0 unless the fixed timestep is enabled.
+		float getInterpolationAlpha() const;
+
+		/// @brief Enables or disables pipelined execution. Only takes effect when runLoop is next called.
+		///		While enabled, runLoop updates the active region on a second thread while the window thread draws the previous frame.
+		///		Between the two, the window thread calls publishRenderState on the active region. The region must only draw the state it
+		///		published, since it is being updated at the same time. The region must provide that snapshot itself. GameRegion does not
+		///		snapshot its draw list or its drawables, so a GameRegion must override draw to draw only what its publishRenderState copied.
+		///
+		///		The execution order of each iteration is 1) wait for the last update, 2) swapRegion, 3) publishRenderState and interpolate,
+		///		4) handleEvent, 5) update on the second thread and draw on the window thread.
+		/// @param enabled True to pipeline updating and drawing. False to run them one after another on the window thread.
+		void setPipelinedExecutionEnabled(bool enabled);
+
+		/// @brief True if pipelined execution is enabled. False otherwise.
+		bool isPipelinedExecutionEnabled() const;
+
+		/// @brief Enables or disables timing each phase of the main loop.
+		///		While enabled, every handleEvents, update, repaint, swapRegion, and whole iteration of runLoop is recorded by the profiler.
+		///		Texture uploads are not part of any phase, only of the whole iteration.
+		///		Must not be called while runLoop is updating on a second thread.
+		/// @param enabled True to time the main loop. False to stop timing it and discard the samples.
+		/// @param capacity The number of samples to keep for each phase. Ignored if enabled is false.
+		/// @throws std::invalid_argument if enabled is true and capacity is 0.
+		void setProfilingEnabled(bool enabled, std::size_t capacity = DEFAULT_PROFILER_CAPACITY);
+
+		/// @brief True if the main loop is being timed. False otherwise.
+		bool isProfilingEnabled() const;
+
+		/// @brief Returns the profiler timing the main loop.
+		/// @return The profiler, or nullptr if profiling is disabled.
+		FrameProfiler* getProfiler();
+
+		/// @brief Returns the profiler timing the main loop.
+		/// @return The profiler, or nullptr if profiling is disabled.
+		const FrameProfiler* getProfiler() const;
+
+		/// @brief Starts preloading a region on a background thread while the active region keeps running.
+		///		When the active region asks to change to a region that is still preloading, the change waits until the preload is done,
+		///		so the window keeps drawing instead of freezing. Regions that are changed to without being preloaded are preloaded
+		///		on the window thread during the change. Does nothing if the region is not Unloaded.
+		///		The region must outlive its preload.
+		/// @param region The region to preload.
+		void preloadRegion(BasicGameRegion& region);
+
+		/// @brief Blocks until a region has finished preloading. Preloads the region on this thread if it was not preloading.
+		///		Does nothing if the region is already Ready or Active.
+		/// @param region The region to wait for.
+		/// @throws Rethrows anything the region's preload threw. The region is then Unloaded again.
+		void waitForPreload(BasicGameRegion& region);
+
+		/// @brief Unloads a region that is not active. Waits for its preload first if it is preloading.
+		///		Does nothing if the region is Unloaded.
+		/// @param region The region to unload.
+		/// @throws std::invalid_argument if the region is active.
+		void unloadRegion(BasicGameRegion& region);
+
+		/// @brief Returns where a region is in its lifecycle.
+		///		A region whose background preload has finished is Ready. If that preload threw, the error is rethrown when the region
+		///		is changed to or waited for.
+		/// @param region The region.
+		RegionState getRegionState(const BasicGameRegion& region) const;
+
+		/// @brief Returns how much of a region's preload is done, from 0 to 1. 1 once the region is Ready or Active.
+		/// @param region The region.
+		float getPreloadProgress(const BasicGameRegion& region) const;
+
+		/// @brief Sets the TextureLoader whose decoded images are uploaded by the main loop.
+		///		Every iteration of runLoop uploads up to uploadBudget bytes before drawing, on the window thread, while the active region
+		///		is not being updated. GameRegions can then request their textures from the loader when they are created instead of
+		///		loading them from disk, so changing regions does not stall a frame.
+		/// @param textureLoader The loader, or nullptr to stop uploading. Must outlive its use by the CoreEventController.
+		/// @param uploadBudget The number of bytes of pixels to upload per iteration.
+		void setTextureLoader(TextureLoader* textureLoader, std::size_t uploadBudget = TextureLoader::DEFAULT_UPLOAD_BUDGET);
+
+		/// @brief Returns the TextureLoader uploaded by the main loop, or nullptr if there is none.
+		TextureLoader* getTextureLoader();
+
+		/// @brief The default most updates to run in one frame while catching up.
+		static constexpr int DEFAULT_MAX_UPDATES_PER_FRAME = 5;
+
+		/// @brief The default number of samples the profiler keeps for each phase.
+		static constexpr std::size_t DEFAULT_PROFILER_CAPACITY = 1024;
+
 	protected:
 
 		/// @brief Set the active region on the CoreEventController.
+		///		Deactivates the previous active region. Preloads the new region if it is not Ready, then activates it.
 		/// @param activeRegion The new active region. This should never be set to nullptr.
 		void setActiveRegion(BasicGameRegion* activeRegion);
 		
@@ -80,16 +187,59 @@ namespace GB {
 
 		/// @brief Changes to the next active region if prompted by the current active region.
 		virtual void swapRegion();
+
+		/// @brief Runs one iteration of the main loop.
+		/// @param elapsedTime The time since the last iteration in microseconds.
+		void runLoopIteration(sf::Int64 elapsedTime);
 		
 	private:
 
 		/// @brief Draws the active region.
 		void repaint();
 
+		/// @brief Updates the active region once per full timestep in the accumulated time.
+		/// @param elapsedTime The time since the last iteration in microseconds.
+		void updateFixed(sf::Int64 elapsedTime);
+
+		/// @brief Passes the interpolation alpha of the last update to the active region before it is drawn.
+		void interpolateActiveRegion();
+
+		/// @brief Updates the active region with or without the fixed timestep.
+		/// @param elapsedTime The time since the last iteration in microseconds.
+		void runUpdate(sf::Int64 elapsedTime);
+
+		/// @brief The main loop while pipelined execution is enabled.
+		void runPipelinedLoop();
+
+		/// @brief Uploads the images decoded by the texture loader, if there is one.
+		void uploadTextures();
+
+		/// @brief True if the region was preloading in the background and that preload is done.
+		static bool isPreloadFinished(const BasicGameRegion& region);
+
+		/// @brief Deactivates the active region and activates the new one. The new region must be Ready.
+		void activateRegion(BasicGameRegion& region);
+
 		BasicGameRegion* m_activeRegion;
 		sf::RenderWindow m_window;
 		sf::Clock m_updateClock;
 		sf::Int64 m_timeSinceLastHandledEvent;
+
+		// Fixed timestep. A timestep of 0 means that the fixed timestep is disabled.
+		sf::Int64 m_fixedTimestep = 0;
+		int m_maxUpdatesPerFrame = DEFAULT_MAX_UPDATES_PER_FRAME;
+		sf::Int64 m_accumulatedTime = 0;
+		float m_interpolationAlpha = 0.f;
+		// The alpha of the frame being drawn. Separate from m_interpolationAlpha so that it can be read while the next update runs.
+		float m_drawInterpolationAlpha = 0.f;
+
+		bool m_isPipelinedExecutionEnabled = false;
+
+		TextureLoader* m_textureLoader = nullptr;
+		std::size_t m_textureUploadBudget = TextureLoader::DEFAULT_UPLOAD_BUDGET;
+
+		// Held by pointer so that the controller stays movable. nullptr while profiling is disabled.
+		std::unique_ptr<FrameProfiler> m_profiler;
 	};
 }
 
@@ -0,0 +1,418 @@
+#pragma once
+
+#include <GameBackbone/Core/CompoundSprite.h>
+#include <GameBackbone/Core/Updatable.h>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GB
+{
+	namespace Detail
+	{
+		/// @brief Provides the index of a type within a list of types as the member constant value.
+		/// @tparam T The type to find.
+		/// @tparam ...Ts The list of types to search.
+		template <class T, class... Ts>
+		struct type_index;
+
+		template <class T, class... Ts>
+		struct type_index<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+		template <class T, class U, class... Ts>
+		struct type_index<T, U, Ts...> : std::integral_constant<std::size_t, 1 + type_index<T, Ts...>::value> {};
+
+		/// @brief True if T is one of the types in Ts. False otherwise.
+		template <class T, class... Ts>
+		inline constexpr bool is_one_of_v = (std::is_same_v<T, Ts> || ...);
+	}
+
+	/// @brief Controls several sf::Drawable and sf::Transformable Components as one logical unit.
+	///		Behaves like GB::CompoundSprite, but the types of the Components are declared up front.
+	///		Components of the same type are stored by value in one contiguous array per type, and the
+	///		draw order is kept in a single priority sorted array. Transforming, updating, and drawing
+	///		the FlatCompoundSprite iterate those arrays directly without any virtual calls.
+	/// @tparam ...Components The types of the Components that can be stored. Each must satisfy is_component_v.
+	template <class... Components>
+	class FlatCompoundSprite : public Updatable, public sf::Drawable, public sf::Transformable
+	{
+		static_assert(sizeof...(Components) > 0, "FlatCompoundSprite requires at least one Component type.");
+		static_assert(are_all_components_v<Components...>, "All Components of a FlatCompoundSprite must be drawable and transformable.");
+
+		template <class Component>
+		static constexpr std::size_t typeIndex = Detail::type_index<Component, Components...>::value;
+
+		template <class Component>
+		static constexpr bool isStorable = Detail::is_one_of_v<Component, Components...>;
+
+	public:
+
+		/// @brief Initializes a new instance of the FlatCompoundSprite. The FlatCompoundSprite has no components and is located at (0,0).
+		FlatCompoundSprite() = default;
+
+		/// @brief Initializes a new instance of the FlatCompoundSprite class. Sets the initial position of the FlatCompoundSprite to the passed value.
+		/// @param position The initial position.
+		explicit FlatCompoundSprite(sf::Vector2f position)
+		{
+			setPosition(position);
+		}
+
+		/// @brief Copy construct a FlatCompoundSprite
+		/// @param other The FlatCompoundSprite to copy
+		FlatCompoundSprite(const FlatCompoundSprite& other) = default;
+
+		/// @brief Copy assign a FlatCompoundSprite
+		/// @param other The FlatCompoundSprite to copy
+		/// @return this
+		FlatCompoundSprite& operator=(const FlatCompoundSprite& other) = default;
+
+		/// @brief Move construct a FlatCompoundSprite
+		/// @param other The FlatCompoundSprite to move
+		FlatCompoundSprite(FlatCompoundSprite&& other) noexcept = default;
+
+		/// @brief Move assign a FlatCompoundSprite
+		/// @param other The FlatCompoundSprite to move
+		/// @return this
+		FlatCompoundSprite& operator=(FlatCompoundSprite&& other) noexcept = default;
+
+		/// @brief Destroy this FlatCompoundSprite
+		~FlatCompoundSprite() override = default;
+
+		// Component Getters
+
+		/// @brief Gets the number of components owned by the FlatCompoundSprite
+		std::size_t getComponentCount() const
+		{
+			return m_drawOrder.size();
+		}
+
+		/// @brief Gets the number of components owned by the FlatCompoundSprite with a given priority.
+		/// @param priority The priority.
+		std::size_t getComponentCount(int priority) const
+		{
+			const auto range = std::equal_range(m_drawOrder.begin(), m_drawOrder.end(), DrawOrderEntry{ priority, 0, 0 }, isLowerPriority);
+			return static_cast<std::size_t>(std::distance(range.first, range.second));
+		}
+
+		/// @brief Gets the number of components of the given type owned by the FlatCompoundSprite.
+		/// @tparam Component The type of the components to count.
+		template <
+			class Component,
+			std::enable_if_t<isStorable<Component>, bool> = true
+		>
+		std::size_t getComponentCountOfType() const
+		{
+			return getStorage<Component>().size();
+		}
+
+		/// @brief Gets the component of the given type at the given index.
+		/// @tparam Component The type of the component.
+		/// @param index The index of the component among all components of the same type, in order of insertion.
+		/// @return The component.
+		/// @throws std::out_of_range if the index is invalid.
+		/// @note The reference is invalidated by any future calls to addComponent or removeComponent.
+		template <
+			class Component,
+			std::enable_if_t<isStorable<Component>, bool> = true
+		>
+		Component& getComponent(std::size_t index)
+		{
+			return getStorage<Component>().at(index);
+		}
+
+		/// @brief Gets the component of the given type at the given index.
+		/// @tparam Component The type of the component.
+		/// @param index The index of the component among all components of the same type, in order of insertion.
+		/// @return The component.
+		/// @throws std::out_of_range if the index is invalid.
+		/// @note The reference is invalidated by any future calls to addComponent or removeComponent.
+		template <
+			class Component,
+			std::enable_if_t<isStorable<Component>, bool> = true
+		>
+		const Component& getComponent(std::size_t index) const
+		{
+			return getStorage<Component>().at(index);
+		}
+
+		/// @brief True if this FlatCompoundSprite holds no components. False otherwise.
+		bool isEmpty() const
+		{
+			return m_drawOrder.empty();
+		}
+
+		/// @brief Adds the passed in Component to the FlatCompoundSprite and returns a reference to it.
+		///		The position stays the same on screen and the origin is set to the FlatCompoundSprite's origin.
+		/// @tparam Component One of the Components of this FlatCompoundSprite.
+		/// @param priority The priority of the added component. Higher priority components will be drawn on top of components with lower priority.
+		/// @param component The component to add.
+		/// @return A reference to the added component.
+		/// @note The reference is invalidated by any future calls to addComponent or removeComponent.
+		template <
+			class Component,
+			std::enable_if_t<isStorable<Component>, bool> = true
+		>
+		Component& addComponent(int priority, Component component)
+		{
+			// Keep the component in the same place on screen, but rotate it around the origin of the FlatCompoundSprite.
+			// See CompoundSprite::addComponent.
+			component.setOrigin(getPosition().x + getOrigin().x - component.getPosition().x, getPosition().y + getOrigin().y - component.getPosition().y);
+			component.setPosition(getPosition().x, getPosition().y);
+
+			auto& storage = getStorage<Component>();
+			const DrawOrderEntry entry{ priority, typeIndex<Component>, storage.size() };
+			Component& addedComponent = storage.emplace_back(std::move(component));
+
+			// Insert after every component of the same or lower priority so that equal priorities draw in insertion order
+			m_drawOrder.insert(std::upper_bound(m_drawOrder.begin(), m_drawOrder.end(), entry, isLowerPriority), entry);
+
+			return addedComponent;
+		}
+
+		/// @brief Removes the component from the FlatCompoundSprite.
+		///		If the component is not owned by this FlatCompoundSprite nothing is done.
+		/// @tparam Component One of the Components of this FlatCompoundSprite.
+		/// @param componentToRemove The component to remove.
+		/// @note Invalidates all references returned by addComponent and getComponent.
+		template <
+			class Component,
+			std::enable_if_t<isStorable<Component>, bool> = true
+		>
+		void removeComponent(const Component& componentToRemove)
+		{
+			auto& storage = getStorage<Component>();
+			auto it = std::find_if(storage.begin(), storage.end(),
+				[&componentToRemove](const Component& possibleRemoval) -> bool {
+					return &possibleRemoval == &componentToRemove;
+				});
+			if (it == storage.end())
+			{
+				return;
+			}
+
+			const std::size_t removedIndex = static_cast<std::size_t>(std::distance(storage.begin(), it));
+			storage.erase(it);
+
+			// Remove the draw order entry and shift the indices of the components of the same type that came after it
+			m_drawOrder.erase(
+				std::remove_if(m_drawOrder.begin(), m_drawOrder.end(),
+					[removedIndex](const DrawOrderEntry& entry) -> bool {
+						return entry.typeIndex == typeIndex<Component> && entry.componentIndex == removedIndex;
+					}),
+				m_drawOrder.end());
+			for (DrawOrderEntry& entry : m_drawOrder)
+			{
+				if (entry.typeIndex == typeIndex<Component> && entry.componentIndex > removedIndex)
+				{
+					--entry.componentIndex;
+				}
+			}
+		}
+
+		/// @brief Removes all components from the FlatCompoundSprite
+		void clearComponents()
+		{
+			std::apply([](auto&... storages) { (storages.clear(), ...); }, m_components);
+			m_drawOrder.clear();
+		}
+
+		// Transformable API
+
+		/// @brief Sets the position of the FlatCompoundSprite and all of its components.
+		/// @param x The new x.
+		/// @param y The new y.
+		void setPosition(float x, float y)
+		{
+			const sf::Vector2f& oldPosition = sf::Transformable::getPosition();
+			move(x - oldPosition.x, y - oldPosition.y);
+		}
+
+		/// @brief Sets the position of the FlatCompoundSprite and all of its components.
+		/// @param position The new position.
+		void setPosition(const sf::Vector2f& position)
+		{
+			setPosition(position.x, position.y);
+		}
+
+		/// @brief Sets the rotation of the FlatCompoundSprite and all of its components.
+		///		The components will rotate about the origin of the FlatCompoundSprite.
+		/// @param angle Angle of rotation, in degrees.
+		void setRotation(float angle)
+		{
+			forEachComponent([angle](auto& component) { component.setRotation(angle); });
+			sf::Transformable::setRotation(angle);
+		}
+
+		/// @brief Sets the scale factor of the FlatCompoundSprite and all of its components.
+		/// @param factorX The scale factor in the x direction.
+		/// @param factorY The scale factor in the y direction.
+		void setScale(float factorX, float factorY)
+		{
+			forEachComponent([factorX, factorY](auto& component) { component.setScale(factorX, factorY); });
+			sf::Transformable::setScale(factorX, factorY);
+		}
+
+		/// @brief Sets the scale factor of the FlatCompoundSprite and all of its components.
+		/// @param factors The new scale.
+		void setScale(const sf::Vector2f& factors)
+		{
+			setScale(factors.x, factors.y);
+		}
+
+		/// @brief Sets the origin of the FlatCompoundSprite.
+		///		Sets the origin of all components relative to the new origin.
+		/// @param x The x coordinate of the new origin.
+		/// @param y The y coordinate of the new origin.
+		void setOrigin(float x, float y)
+		{
+			const float offsetX = x - getOrigin().x;
+			const float offsetY = y - getOrigin().y;
+			forEachComponent([offsetX, offsetY](auto& component) {
+				component.setOrigin(component.getOrigin().x + offsetX, component.getOrigin().y + offsetY);
+			});
+			sf::Transformable::setOrigin(x, y);
+		}
+
+		/// @brief Sets the origin of the FlatCompoundSprite.
+		///		Sets the origin of all components relative to the new origin.
+		/// @param origin The new position of the origin.
+		void setOrigin(const sf::Vector2f& origin)
+		{
+			setOrigin(origin.x, origin.y);
+		}
+
+		/// @brief Moves the FlatCompoundSprite and all of its components by the same offset.
+		/// @param offsetX The offset x.
+		/// @param offsetY The offset y.
+		void move(float offsetX, float offsetY)
+		{
+			forEachComponent([offsetX, offsetY](auto& component) { component.move(offsetX, offsetY); });
+			sf::Transformable::move(offsetX, offsetY);
+		}
+
+		/// @brief Moves the FlatCompoundSprite and all of its components by the same offset.
+		/// @param offset The offset.
+		void move(const sf::Vector2f& offset)
+		{
+			move(offset.x, offset.y);
+		}
+
+		/// @brief Rotates the FlatCompoundSprite and all of its components.
+		///		The components will rotate about the origin of the FlatCompoundSprite.
+		/// @param angle The offset to the current rotation.
+		void rotate(float angle)
+		{
+			forEachComponent([angle](auto& component) { component.rotate(angle); });
+			sf::Transformable::rotate(angle);
+		}
+
+		/// @brief Scales the FlatCompoundSprite and all of its components.
+		/// @param factorX The horizontal scale factor.
+		/// @param factorY The vertical scale factor.
+		void scale(float factorX, float factorY)
+		{
+			forEachComponent([factorX, factorY](auto& component) { component.scale(factorX, factorY); });
+			sf::Transformable::scale(factorX, factorY);
+		}
+
+		/// @brief Scales the FlatCompoundSprite and all of its components.
+		/// @param factor The scale factors.
+		void scale(const sf::Vector2f& factor)
+		{
+			scale(factor.x, factor.y);
+		}
+
+		/// @brief Updates each updatable component of the FlatCompoundSprite.
+		/// @param elapsedTime The elapsed time.
+		void update(sf::Int64 elapsedTime) override
+		{
+			forEachComponent([elapsedTime](auto& component) {
+				if constexpr (is_updatable_v<std::decay_t<decltype(component)>>)
+				{
+					component.update(elapsedTime);
+				}
+			});
+		}
+
+	protected:
+
+		/// @brief Draw all the components of the FlatCompoundSprite in order of priority.
+		/// @param target The render target to be drawn to.
+		/// @param states Current render states.
+		void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+		{
+			for (const DrawOrderEntry& entry : m_drawOrder)
+			{
+				drawFunctions[entry.typeIndex](*this, entry.componentIndex, target, states);
+			}
+		}
+
+	private:
+
+		/// @brief Locates a single component in draw order.
+		struct DrawOrderEntry
+		{
+			int priority;
+			std::size_t typeIndex;
+			std::size_t componentIndex;
+		};
+
+		/// @brief Orders DrawOrderEntry by priority only.
+		static bool isLowerPriority(const DrawOrderEntry& lhs, const DrawOrderEntry& rhs)
+		{
+			return lhs.priority < rhs.priority;
+		}
+
+		template <class Component>
+		std::vector<Component>& getStorage()
+		{
+			return std::get<typeIndex<Component>>(m_components);
+		}
+
+		template <class Component>
+		const std::vector<Component>& getStorage() const
+		{
+			return std::get<typeIndex<Component>>(m_components);
+		}
+
+		/// @brief Apply a function to every component. Components are visited one type at a time.
+		/// @param func The function to apply. Must accept every Component type.
+		template <class Func>
+		void forEachComponent(Func&& func)
+		{
+			std::apply(
+				[&func](auto&... storages) {
+					(std::for_each(storages.begin(), storages.end(), func), ...);
+				},
+				m_components);
+		}
+
+		/// @brief Draws the component of the given type at the given index.
+		template <class Component>
+		static void drawComponent(const FlatCompoundSprite& sprite, std::size_t index, sf::RenderTarget& target, const sf::RenderStates& states)
+		{
+			target.draw(sprite.getStorage<Component>()[index], states);
+		}
+
+		using DrawFunction = void (*)(const FlatCompoundSprite&, std::size_t, sf::RenderTarget&, const sf::RenderStates&);
+
+		// Draw function for each Component type. Indexed by DrawOrderEntry::typeIndex.
+		static constexpr std::array<DrawFunction, sizeof...(Components)> drawFunctions{ &drawComponent<Components>... };
+
+		// Components stored by value. One array per type.
+		std::tuple<std::vector<Components>...> m_components;
+
+		// Every component sorted by priority. Components of equal priority are in insertion order.
+		std::vector<DrawOrderEntry> m_drawOrder;
+	};
+}
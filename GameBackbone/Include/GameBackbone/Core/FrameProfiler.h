@@ -0,0 +1,172 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Config.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace GB
+{
+	/// @brief The phases of one iteration of the CoreEventController main loop.
+	enum class LoopPhase
+	{
+		HandleEvents,
+		Update,
+		Repaint,
+		SwapRegion,
+		Frame
+	};
+
+	/// @brief Timing statistics of the samples recorded for a LoopPhase.
+	struct PhaseStatistics
+	{
+		/// @brief The number of samples the statistics were computed from.
+		std::size_t sampleCount = 0;
+
+		/// @brief The shortest sample in microseconds.
+		sf::Int64 min = 0;
+
+		/// @brief The longest sample in microseconds.
+		sf::Int64 max = 0;
+
+		/// @brief The average sample in microseconds.
+		double average = 0.0;
+
+		/// @brief The 99th percentile sample in microseconds.
+		sf::Int64 p99 = 0;
+	};
+
+	/// @brief A single timing of a LoopPhase.
+	struct PhaseSample
+	{
+		/// @brief The phase that was timed.
+		LoopPhase phase;
+
+		/// @brief When the phase started, in microseconds since the FrameProfiler was created.
+		sf::Int64 start;
+
+		/// @brief How long the phase took in microseconds.
+		sf::Int64 duration;
+	};
+
+	/// @brief Records how long each phase of the main loop takes.
+	///		Each phase keeps its most recent samples in its own fixed size ring buffer. Recording never locks or allocates.
+	///		Each phase may be recorded by one thread at a time. Any thread may read the samples while they are being recorded.
+	class libGameBackbone FrameProfiler
+	{
+	public:
+		/// @brief The number of LoopPhase values.
+		static constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(LoopPhase::Frame) + 1;
+
+		/// @brief Initializes a FrameProfiler with no samples.
+		/// @param capacity The number of samples to keep for each phase. Older samples are overwritten.
+		/// @throws std::invalid_argument if capacity is 0.
+		explicit FrameProfiler(std::size_t capacity);
+
+		FrameProfiler(const FrameProfiler&) = delete;
+		FrameProfiler& operator=(const FrameProfiler&) = delete;
+		FrameProfiler(FrameProfiler&&) = delete;
+		FrameProfiler& operator=(FrameProfiler&&) = delete;
+		~FrameProfiler() = default;
+
+		/// @brief Returns the number of samples kept for each phase.
+		[[nodiscard]]
+		std::size_t getCapacity() const noexcept;
+
+		/// @brief Returns the current time in microseconds since the FrameProfiler was created.
+		[[nodiscard]]
+		sf::Int64 now() const noexcept;
+
+		/// @brief Records a sample, overwriting the oldest one if the ring buffer of the phase is full.
+		/// @param phase The phase that was timed.
+		/// @param start When the phase started, as returned by now.
+		/// @param duration How long the phase took in microseconds.
+		void record(LoopPhase phase, sf::Int64 start, sf::Int64 duration) noexcept;
+
+		/// @brief Returns the samples currently kept for a phase, from oldest to newest.
+		/// @param phase The phase.
+		[[nodiscard]]
+		std::vector<PhaseSample> getSamples(LoopPhase phase) const;
+
+		/// @brief Returns the statistics of the samples currently kept for a phase.
+		/// @param phase The phase.
+		[[nodiscard]]
+		PhaseStatistics getStatistics(LoopPhase phase) const;
+
+		/// @brief Removes all samples.
+		///		Must not be called while a sample is being recorded.
+		void clear() noexcept;
+
+		/// @brief Writes every kept sample as CSV with the columns phase,start_us,duration_us.
+		/// @param out The stream to write to.
+		void writeCsv(std::ostream& out) const;
+
+		/// @brief Writes every kept sample in the Chrome trace event JSON format. Open the output with chrome://tracing.
+		/// @param out The stream to write to.
+		void writeChromeTrace(std::ostream& out) const;
+
+		/// @brief Returns the name of a phase.
+		/// @param phase The phase.
+		[[nodiscard]]
+		static const char* getPhaseName(LoopPhase phase) noexcept;
+
+		/// @brief Times a scope and records it as a sample when the scope ends. Does nothing if the profiler is nullptr.
+		class ScopedTimer
+		{
+		public:
+			/// @brief Starts timing.
+			/// @param profiler The profiler to record to. May be nullptr.
+			/// @param phase The phase being timed.
+			ScopedTimer(FrameProfiler* profiler, LoopPhase phase) noexcept
+				: m_profiler(profiler), m_phase(phase), m_start(profiler ? profiler->now() : 0)
+			{
+			}
+
+			ScopedTimer(const ScopedTimer&) = delete;
+			ScopedTimer& operator=(const ScopedTimer&) = delete;
+			ScopedTimer(ScopedTimer&&) = delete;
+			ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+			/// @brief Records the time since the timer was created.
+			~ScopedTimer()
+			{
+				if (m_profiler != nullptr)
+				{
+					m_profiler->record(m_phase, m_start, m_profiler->now() - m_start);
+				}
+			}
+
+		private:
+			FrameProfiler* m_profiler;
+			LoopPhase m_phase;
+			sf::Int64 m_start;
+		};
+
+	private:
+		/// @brief A sample in a ring buffer. The fields are atomic so that the samples can be read while they are written.
+		struct AtomicSample
+		{
+			std::atomic<sf::Int64> start{ 0 };
+			std::atomic<sf::Int64> duration{ 0 };
+		};
+
+		/// @brief The ring buffer of one phase.
+		struct PhaseBuffer
+		{
+			std::unique_ptr<AtomicSample[]> samples;
+			// The total number of samples ever recorded. The next sample is written at writeCount % capacity.
+			std::atomic<std::size_t> writeCount{ 0 };
+		};
+
+		std::size_t m_capacity;
+		std::chrono::steady_clock::time_point m_creationTime;
+		std::array<PhaseBuffer, PHASE_COUNT> m_buffers;
+	};
+}
@@ -1,23 +1,50 @@
 #pragma once
 
 #include <GameBackbone/Core/BasicGameRegion.h>
+#include <GameBackbone/Core/SpatialGrid.h>
 #include <GameBackbone/Core/Updatable.h>
 #include <GameBackbone/Util/DllUtil.h>
 
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
 
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace GB {
 
-	/// <summary> Base class meant to be inherited. Controls game logic and actors for a specific time or space in game. </summary>
+	/// <summary> Checks if a type has a getGlobalBounds member function that returns an sf::FloatRect. </summary>
+	template <class InType, class = void>
+	struct has_global_bounds : std::false_type {};
+
+	/// <summary> Checks if a type has a getGlobalBounds member function that returns an sf::FloatRect. </summary>
+	template <class InType>
+	struct has_global_bounds<InType, std::enable_if_t<std::is_convertible_v<decltype(std::declval<const InType&>().getGlobalBounds()), sf::FloatRect>>>
+		: std::true_type {};
+
+	/// <summary> Checks if a type has a getGlobalBounds member function that returns an sf::FloatRect. </summary>
+	template <class InType>
+	inline constexpr bool has_global_bounds_v = has_global_bounds<InType>::value;
+
+	/// <summary>
+	/// Base class meant to be inherited. Controls game logic and actors for a specific time or space in game.
+	/// Its draw reads the live draw list and drawables, so it is not safe to draw while pipelined execution updates the region.
+	/// </summary>
 	class libGameBackbone GameRegion : public BasicGameRegion {
 	public:
 		/// <summary>shared_ptr to GameRegion</summary>
 		using Ptr = std::shared_ptr<GameRegion>;
+
+		/// <summary>Returns the global bounds of a drawable. Used to cull drawables that are outside of the view.</summary>
+		using BoundsFunction = sf::FloatRect(*)(const sf::Drawable&);
 		
 		GameRegion() = default;
 		GameRegion(const GameRegion&) = default;
@@ -31,6 +58,24 @@ namespace GB {
 		[[nodiscard]]
 		std::size_t getDrawableCount(int priority) const noexcept;
 
+		// Culling
+		void setCullingEnabled(bool enabled) noexcept;
+		[[nodiscard]]
+		bool isCullingEnabled() const noexcept;
+		[[nodiscard]]
+		std::size_t getLastDrawnCount() const noexcept;
+		[[nodiscard]]
+		std::size_t getLastCulledCount() const noexcept;
+
+		// Spatial index
+		void enableSpatialIndex(float cellSize);
+		void disableSpatialIndex();
+		[[nodiscard]]
+		bool isSpatialIndexEnabled() const noexcept;
+		void getDrawablesInArea(const sf::FloatRect& area, std::vector<const sf::Drawable*>& results) const;
+		void getDrawablesAtPoint(const sf::Vector2f& point, std::vector<const sf::Drawable*>& results) const;
+		void getDrawablesInRadius(const sf::Vector2f& center, float radius, std::vector<const sf::Drawable*>& results) const;
+
 		virtual bool handleEvent(sf::Int64 /*elapsedTime*/, const sf::Event& /*event*/) override { return false; };
 
 		/// <summary>
@@ -43,14 +88,92 @@ namespace GB {
 
 		// Add/Remove/Clear drawables
 		void addDrawable(int priority, sf::Drawable& drawableToAdd);
+		void addDrawable(int priority, sf::Drawable& drawableToAdd, BoundsFunction getBounds);
+
+		/// <summary>
+		/// Add a drawable that has a getGlobalBounds member function.
+		/// While culling is enabled, the drawable is skipped when its global bounds are outside of the view.
+		/// </summary>
+		/// <param name="priority"> The priority of the drawable </param>
+		/// <param name="drawableToAdd"> The drawable that will be added </param>
+		template <class DrawableType,
+			std::enable_if_t<std::is_base_of_v<sf::Drawable, DrawableType> && has_global_bounds_v<DrawableType>, bool> = true
+		>
+		void addDrawable(int priority, DrawableType& drawableToAdd) {
+			addDrawable(priority, drawableToAdd, [](const sf::Drawable& drawable) -> sf::FloatRect {
+				return static_cast<const DrawableType&>(drawable).getGlobalBounds();
+			});
+		}
 		void removeDrawable(sf::Drawable& drawableToRemove);
 		void clearDrawables();
 		void clearDrawables(int priority);
 
+		// Keep the spatial index up to date with moved drawables
+		void markDrawableMoved(const sf::Drawable& movedDrawable);
+		void updateDrawableBounds(const sf::Drawable& movedDrawable);
+		void updateSpatialIndex();
+		void rebuildSpatialIndex();
+
 		// Drawing
 		virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 	private:
-		std::multimap<int, sf::Drawable*> prioritizedDrawables;
+		/// <summary> Where a drawable is stored in the draw list. Sorted by priority, then by the order drawables were added. </summary>
+		struct DrawListKey {
+			int priority;
+			std::uint64_t sequence;
+		};
+
+		/// <summary> A drawable in the draw list. Removed drawables are left as nullptr until the draw list is compacted. </summary>
+		struct DrawListEntry {
+			DrawListKey key;
+			sf::Drawable* drawable;
+			// nullptr if the drawable can not be culled
+			BoundsFunction getBounds;
+		};
+
+		DrawListEntry* findDrawListEntry(const DrawListKey& key);
+		void flushDrawList() const;
+		void applyMovedDrawables() const;
+		void drawIndexed(sf::RenderTarget& target, sf::RenderStates states, const sf::FloatRect& viewBounds) const;
+
+		/// <summary> Calls func with every drawable that has bounds and its bounds function. </summary>
+		template <class Func>
+		void forEachBoundedDrawable(Func&& func) const {
+			for (const std::vector<DrawListEntry>* entries : { &m_drawList, &m_pendingDrawables }) {
+				for (const DrawListEntry& entry : *entries) {
+					if (entry.drawable != nullptr && entry.getBounds != nullptr) {
+						func(*entry.drawable, entry.getBounds);
+					}
+				}
+			}
+		}
+
+		// Drawables sorted by key. Contains removed entries until the next flush.
+		mutable std::vector<DrawListEntry> m_drawList;
+		// Drawables added since the last flush in the order they were added. Always sorted after m_drawList.
+		mutable std::vector<DrawListEntry> m_pendingDrawables;
+		// Reused buffer to merge into when flushing
+		mutable std::vector<DrawListEntry> m_drawListScratch;
+		mutable std::size_t m_removedDrawListEntryCount = 0;
+
+		// Reverse index from each drawable to its place in the draw list
+		std::unordered_map<const sf::Drawable*, DrawListKey> m_drawableKeys;
+		std::map<int, std::size_t> m_priorityCounts;
+		std::uint64_t m_nextSequence = 0;
+
+		// Culling
+		bool m_isCullingEnabled = false;
+		mutable std::size_t m_lastDrawnCount = 0;
+		mutable std::size_t m_lastCulledCount = 0;
+
+		// Spatial index. Drawables without bounds are kept separately so that they can always be drawn.
+		// Mutable so that drawing and the queries can move the drawables marked as moved.
+		mutable std::optional<SpatialGrid> m_spatialIndex;
+		std::unordered_set<const sf::Drawable*> m_unboundedDrawables;
+		// Drawables marked as moved since the last draw or query, with their bounds functions
+		mutable std::unordered_map<const sf::Drawable*, BoundsFunction> m_movedDrawables;
+		mutable std::vector<const sf::Drawable*> m_queryResults;
+		mutable std::vector<std::pair<DrawListKey, const sf::Drawable*>> m_visibleDrawables;
 	};
 }
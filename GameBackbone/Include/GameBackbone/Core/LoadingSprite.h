@@ -0,0 +1,53 @@
+#pragma once
+
+#include <GameBackbone/Core/TextureLoader.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <memory>
+
+namespace GB {
+
+	/// @brief An sf::Sprite that shows a texture requested from a TextureLoader.
+	///		It can be drawn right away. While the texture is loading it shows the placeholder, and once the texture has loaded its
+	///		texture rect is resized to the whole image. A rect set in the meantime, such as an atlas region, is kept.
+	///		Like every sf::Sprite, it must only be used from the thread that draws.
+	class libGameBackbone LoadingSprite : public sf::Sprite {
+	public:
+		/// @brief Construct a LoadingSprite with no texture.
+		LoadingSprite() = default;
+
+		/// @brief Construct a LoadingSprite that shows the texture.
+		/// @param texture The texture to show. It may still be loading.
+		explicit LoadingSprite(TextureHandle texture);
+
+		LoadingSprite(const LoadingSprite& other);
+		LoadingSprite& operator=(const LoadingSprite& other);
+		LoadingSprite(LoadingSprite&& other) noexcept;
+		LoadingSprite& operator=(LoadingSprite&& other) noexcept;
+		~LoadingSprite() = default;
+
+		using sf::Sprite::setTexture;
+
+		/// @brief Shows the texture with a rect covering all of it. The rect is resized once the texture has loaded.
+		/// @param texture The texture to show. It may still be loading.
+		/// @throws std::runtime_error if the handle refers to no texture.
+		void setTexture(TextureHandle texture);
+
+		/// @brief Returns the handle of the texture set with setTexture. It refers to no texture if none was.
+		[[nodiscard]]
+		const TextureHandle& getTextureHandle() const noexcept;
+
+	private:
+		void watchTexture();
+		void onTextureLoaded(const TextureHandle& texture);
+
+		TextureHandle m_textureHandle;
+		// The rect the texture was set with. Only a rect that is still this one is resized.
+		sf::IntRect m_initialTextureRect;
+		// Points to this LoadingSprite. The callbacks given to the texture only hold a weak_ptr, so a destroyed sprite is never touched.
+		std::shared_ptr<LoadingSprite*> m_self;
+	};
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GB
+{
+	/// @brief A uniform grid of square cells that finds drawables by their bounds.
+	///		Each drawable is stored in every cell its bounds overlap, so queries only look at the drawables near the queried area.
+	///		Bounds are stored when a drawable is inserted. They are not updated when the drawable moves.
+	///		Drawables whose bounds are not a number or cover more than MAX_CELLS_PER_DRAWABLE cells are kept in a separate list
+	///		that every query looks at instead.
+	class libGameBackbone SpatialGrid
+	{
+	public:
+		/// @brief The most cells a drawable is stored in. Larger drawables are looked at by every query.
+		static constexpr std::int64_t MAX_CELLS_PER_DRAWABLE = 4096;
+
+		/// @brief Initializes an empty SpatialGrid.
+		/// @param cellSize The width and height of each cell. Should be around the size of a typical drawable.
+		explicit SpatialGrid(float cellSize);
+
+		/// @brief Returns the width and height of each cell.
+		[[nodiscard]]
+		float getCellSize() const noexcept;
+
+		/// @brief Returns the number of drawables in the grid.
+		[[nodiscard]]
+		std::size_t getDrawableCount() const noexcept;
+
+		/// @brief True if the drawable is in the grid. False otherwise.
+		/// @param drawable The drawable to look for.
+		[[nodiscard]]
+		bool contains(const sf::Drawable& drawable) const;
+
+		/// @brief Adds a drawable to the grid. If the drawable is already in the grid its bounds are updated.
+		///		Updating bounds that stay within the same cells does not touch the cells.
+		/// @param drawable The drawable.
+		/// @param bounds The global bounds of the drawable.
+		void insert(const sf::Drawable& drawable, const sf::FloatRect& bounds);
+
+		/// @brief Removes a drawable from the grid. Does nothing if the drawable is not in the grid.
+		/// @param drawable The drawable to remove.
+		void remove(const sf::Drawable& drawable);
+
+		/// @brief Removes all drawables from the grid.
+		void clear();
+
+		/// @brief Appends every drawable whose bounds intersect the area to results. Each drawable is appended once.
+		/// @param area The area to search.
+		/// @param results The vector to append to.
+		void queryArea(const sf::FloatRect& area, std::vector<const sf::Drawable*>& results) const;
+
+		/// @brief Appends every drawable whose bounds contain the point to results.
+		/// @param point The point to search.
+		/// @param results The vector to append to.
+		void queryPoint(const sf::Vector2f& point, std::vector<const sf::Drawable*>& results) const;
+
+		/// @brief Appends every drawable whose bounds are within radius of the point to results. Each drawable is appended once.
+		/// @param center The center of the searched circle.
+		/// @param radius The radius of the searched circle.
+		/// @param results The vector to append to.
+		void queryRadius(const sf::Vector2f& center, float radius, std::vector<const sf::Drawable*>& results) const;
+
+		/// @brief True if any part of the bounds is within radius of the center. False otherwise.
+		/// @param bounds The bounds to check.
+		/// @param center The center of the circle.
+		/// @param radius The radius of the circle.
+		[[nodiscard]]
+		static bool isWithinRadius(const sf::FloatRect& bounds, const sf::Vector2f& center, float radius) noexcept;
+
+	private:
+		/// @brief The cells that a rectangle overlaps. All bounds are inclusive.
+		struct CellRange
+		{
+			int left;
+			int top;
+			int right;
+			int bottom;
+		};
+
+		/// @brief A drawable in the grid.
+		struct Item
+		{
+			const sf::Drawable* drawable;
+			sf::FloatRect bounds;
+			CellRange cells;
+			// The last query that found this item. Used to report items that span several cells only once.
+			mutable std::uint64_t lastQuery;
+		};
+
+		CellRange getCellRange(const sf::FloatRect& bounds) const;
+		int getCellCoordinate(float position) const;
+		static std::int64_t getCellCount(const CellRange& cells) noexcept;
+		static bool isOversized(const CellRange& cells) noexcept;
+		void addToCells(std::size_t itemIndex);
+		void removeFromCells(std::size_t itemIndex);
+
+		/// @brief Calls func with each item in the cells that overlap the area, once per item.
+		template <class Func>
+		void forEachItemInArea(const sf::FloatRect& area, Func&& func) const;
+
+		float m_cellSize;
+		std::vector<Item> m_items;
+		std::unordered_map<const sf::Drawable*, std::size_t> m_itemIndices;
+		std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_cells;
+		// Items that are not stored in any cell because they cover too many cells
+		std::vector<std::size_t> m_oversizedItems;
+		mutable std::uint64_t m_queryCount = 0;
+	};
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/UniformAnimationSet.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// @brief A few large textures holding many images.
+	///		Sprites drawn from the same page share one texture, so they can be drawn without changing textures between them.
+	///		Built by TextureAtlasBuilder.
+	class libGameBackbone TextureAtlas {
+	public:
+		/// @brief Where an image was placed in the atlas.
+		struct Region {
+			/// @brief The index of the page holding the image.
+			std::size_t page;
+			/// @brief The bounds of the image in the page.
+			sf::IntRect bounds;
+		};
+
+		TextureAtlas() = default;
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+		TextureAtlas(TextureAtlas&&) noexcept = default;
+		TextureAtlas& operator=(TextureAtlas&&) noexcept = default;
+		~TextureAtlas() = default;
+
+		/// @brief Returns the number of pages, which is the number of textures.
+		[[nodiscard]]
+		std::size_t getPageCount() const noexcept;
+
+		/// @brief Returns the texture of a page.
+		/// @param page The index of the page.
+		/// @throws std::out_of_range if the page does not exist.
+		[[nodiscard]]
+		const sf::Texture& getTexture(std::size_t page) const;
+
+		/// @brief Returns the pixels of a page, for example to save the atlas offline.
+		/// @param page The index of the page.
+		/// @throws std::out_of_range if the page does not exist or releasePageImages was called.
+		[[nodiscard]]
+		const sf::Image& getPageImage(std::size_t page) const;
+
+		/// @brief Frees the pixels kept for getPageImage. The textures are not affected.
+		void releasePageImages();
+
+		/// @brief True if an image with the name was packed. False otherwise.
+		/// @param name The name the image was added with.
+		[[nodiscard]]
+		bool containsImage(const std::string& name) const;
+
+		/// @brief Returns where an image was placed.
+		/// @param name The name the image was added with.
+		/// @throws std::out_of_range if there is no image with the name.
+		[[nodiscard]]
+		const Region& getRegion(const std::string& name) const;
+
+		/// @brief Returns the texture of the page holding an image.
+		/// @param name The name the image was added with.
+		/// @throws std::out_of_range if there is no image with the name.
+		[[nodiscard]]
+		const sf::Texture& getTexture(const std::string& name) const;
+
+		/// @brief Creates an AnimationSet whose frames point into the atlas.
+		/// @param name The name of the image the animations were made for.
+		/// @param animations Animations with frames relative to the image.
+		/// @throws std::out_of_range if there is no image with the name or a frame is not inside the image.
+		AnimationSet::Ptr makeAnimationSet(const std::string& name, const AnimationSet& animations) const;
+
+		/// @brief Creates a UniformAnimationSet whose frames point into the atlas.
+		///		The frames are the ones UniformAnimationSet would build for the image, moved to where the image is in the atlas.
+		/// @param name The name of the image the animations were made for.
+		/// @param frameSize The size of every frame.
+		/// @param animations The animations as (x, y) coordinates into the image's frames.
+		/// @throws std::out_of_range if there is no image with the name or a frame is not inside the image.
+		UniformAnimationSet::Ptr makeUniformAnimationSet(const std::string& name, sf::Vector2i frameSize, const std::vector<UniformAnimation>& animations) const;
+
+	private:
+		friend class TextureAtlasBuilder;
+
+		std::vector<sf::Texture> m_textures;
+		std::vector<sf::Image> m_pageImages;
+		std::unordered_map<std::string, Region> m_regions;
+	};
+
+	/// @brief Packs many images into the pages of a TextureAtlas.
+	///		Images are placed on shelves, tallest first. A new page is started when an image does not fit on any earlier page.
+	class libGameBackbone TextureAtlasBuilder {
+	public:
+		/// @brief Construct a TextureAtlasBuilder.
+		/// @param maxPageSize The maximum width and height of a page. Defaults to the largest texture the graphics driver supports.
+		/// @param padding The number of empty pixels left between images, so that filtering does not bleed one image into another.
+		explicit TextureAtlasBuilder(unsigned int maxPageSize = sf::Texture::getMaximumSize(), unsigned int padding = 1);
+
+		/// @brief Adds an image to pack.
+		/// @param name The name used to find the image in the atlas.
+		/// @param image The image.
+		/// @throws std::invalid_argument if the name was already added, the image is empty, or the image is larger than a page.
+		void addImage(std::string name, sf::Image image);
+
+		/// @brief Loads an image from a file and adds it to pack.
+		/// @param name The name used to find the image in the atlas.
+		/// @param path The path of the image file.
+		/// @throws std::runtime_error if the file could not be loaded.
+		/// @throws std::invalid_argument for the same reasons as addImage.
+		void addImageFromFile(std::string name, const std::string& path);
+
+		/// @brief Returns the number of images added.
+		[[nodiscard]]
+		std::size_t getImageCount() const noexcept;
+
+		/// @brief Packs every added image and creates the atlas. Each page is only as large as the images on it.
+		///		The builder is left empty.
+		/// @throws std::runtime_error if a page texture could not be created.
+		TextureAtlas build();
+
+	private:
+		struct PendingImage {
+			std::string name;
+			sf::Image image;
+		};
+
+		unsigned int m_maxPageSize;
+		unsigned int m_padding;
+		std::vector<PendingImage> m_images;
+	};
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// @brief The progress of a texture requested from a TextureLoader.
+	enum class TextureLoadState
+	{
+		Loading,
+		Loaded,
+		Failed
+	};
+
+	/// @brief Shared handle to a texture requested from a TextureLoader.
+	///		The texture can be used right away. It shows the loader's placeholder until the image is loaded, then it is replaced in place,
+	///		so anything drawn with it keeps pointing at the right texture. If loading fails, the placeholder stays.
+	///
+	///		Replacing the texture does not change texture rects. A plain sf::Sprite given the texture before it loaded keeps a rect the size
+	///		of the placeholder. Use a GB::LoadingSprite instead, which resizes its rect once the texture loads.
+	///		Sprites with an explicit rect, such as atlas regions and animation frames, need nothing.
+	///
+	///		The texture lives as long as any handle to it does.
+	class libGameBackbone TextureHandle {
+	public:
+		/// @brief Construct a TextureHandle that refers to no texture.
+		TextureHandle() = default;
+
+		/// @brief Returns the texture. It is the placeholder until the state is Loaded.
+		/// @throws std::runtime_error if the handle refers to no texture.
+		[[nodiscard]]
+		const sf::Texture& getTexture() const;
+
+		/// @brief Returns the progress of the texture.
+		/// @throws std::runtime_error if the handle refers to no texture.
+		[[nodiscard]]
+		TextureLoadState getState() const;
+
+		/// @brief Returns the path the texture is loaded from.
+		/// @throws std::runtime_error if the handle refers to no texture.
+		[[nodiscard]]
+		const std::string& getPath() const;
+
+		/// @brief True if the handle refers to a texture. False otherwise.
+		explicit operator bool() const noexcept;
+
+		/// @brief Calls onLoaded once the texture has finished loading or has failed to load.
+		///		Called immediately if the texture already has. Must be called from the thread that draws.
+		/// @param onLoaded The function to call. Called on the thread that draws.
+		/// @throws std::runtime_error if the handle refers to no texture.
+		void addLoadedCallback(std::function<void(const TextureHandle&)> onLoaded) const;
+
+	private:
+		friend class TextureLoader;
+
+		struct Entry;
+		explicit TextureHandle(std::shared_ptr<Entry> entry);
+
+		std::shared_ptr<Entry> m_entry;
+	};
+
+	/// @brief Loads textures without blocking the thread that draws.
+	///		Images are decoded from their files on a pool of worker threads. The decoded pixels are then copied to the graphics card
+	///		by uploadPending, a few rows at a time, on the thread that draws. Both steps are spread across frames so that
+	///		loading many textures, for example when a GameRegion is created, does not stall a frame.
+	///
+	///		load, uploadPending, and finishLoading must be called from the thread that draws.
+	class libGameBackbone TextureLoader {
+	public:
+		/// @brief Called on the thread that draws once a texture has finished loading or has failed to load.
+		using LoadedCallback = std::function<void(const TextureHandle&)>;
+
+		/// @brief Construct a TextureLoader with a transparent placeholder.
+		/// @param workerCount The number of threads that decode images. 0 picks one less than the number of hardware threads.
+		explicit TextureLoader(std::size_t workerCount = 0);
+
+		/// @brief Construct a TextureLoader.
+		/// @param workerCount The number of threads that decode images. 0 picks one less than the number of hardware threads.
+		/// @param placeholder The image shown by textures that have not loaded yet.
+		TextureLoader(std::size_t workerCount, const sf::Image& placeholder);
+
+		TextureLoader(const TextureLoader&) = delete;
+		TextureLoader& operator=(const TextureLoader&) = delete;
+		TextureLoader(TextureLoader&&) = delete;
+		TextureLoader& operator=(TextureLoader&&) = delete;
+
+		/// @brief Stops the worker threads. Textures that have not loaded keep showing the placeholder.
+		~TextureLoader();
+
+		/// @brief Starts loading a texture and returns immediately.
+		///		Requesting a path that is still in use returns the same texture.
+		/// @param path The path of the image file.
+		/// @param onLoaded Called once the texture has finished loading or has failed to load.
+		///		Called immediately if the texture already has.
+		/// @return A handle whose texture shows the placeholder until the image is loaded.
+		TextureHandle load(const std::string& path, LoadedCallback onLoaded = {});
+
+		/// @brief Copies decoded images to their textures on the graphics card.
+		///		Call once per frame. Large images are copied in bands of rows across several calls, so at most about uploadBudget
+		///		bytes are copied per call. At least one row is copied if any image is waiting so that loading always makes progress.
+		/// @param uploadBudget The number of bytes of pixels to copy.
+		/// @return The number of bytes of pixels copied.
+		std::size_t uploadPending(std::size_t uploadBudget = DEFAULT_UPLOAD_BUDGET);
+
+		/// @brief Blocks until every requested texture has loaded or failed. Useful behind a loading screen.
+		void finishLoading();
+
+		/// @brief Returns the number of textures that have been requested and have not finished loading.
+		[[nodiscard]]
+		std::size_t getPendingCount() const;
+
+		/// @brief Returns the number of worker threads.
+		[[nodiscard]]
+		std::size_t getWorkerCount() const noexcept;
+
+		/// @brief The default number of bytes copied to the graphics card by each call to uploadPending. 4 MB.
+		static constexpr std::size_t DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+	private:
+		/// @brief An image decoded by a worker, waiting to be uploaded.
+		struct DecodedImage {
+			std::shared_ptr<TextureHandle::Entry> entry;
+			sf::Image image;
+			bool isValid;
+		};
+
+		/// @brief An image being copied to the graphics card in bands of rows.
+		struct Upload {
+			DecodedImage decoded;
+			sf::Texture staging;
+			unsigned int nextRow;
+		};
+
+		void decodeImages();
+		std::size_t continueUpload(std::size_t uploadBudget);
+		void finishEntry(const std::shared_ptr<TextureHandle::Entry>& entry, TextureLoadState state);
+
+		sf::Image m_placeholder;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_decodeCondition;
+		std::condition_variable m_decodedCondition;
+		std::deque<std::shared_ptr<TextureHandle::Entry>> m_decodeQueue;
+		std::deque<DecodedImage> m_decodedImages;
+		std::size_t m_decodingCount = 0;
+		bool m_shouldStop = false;
+
+		// Only touched by the thread that draws
+		std::unordered_map<std::string, std::weak_ptr<TextureHandle::Entry>> m_entries;
+		std::unique_ptr<Upload> m_upload;
+		std::size_t m_pendingCount = 0;
+
+		std::vector<std::thread> m_workers;
+	};
+}
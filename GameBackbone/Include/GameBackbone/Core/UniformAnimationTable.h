@@ -0,0 +1,166 @@
+#pragma once
+
+#include <GameBackbone/Core/UniformAnimationSet.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+namespace GB {
+
+	/// @brief The (x, y) coordinate of a frame in a sprite sheet. Usable in constant expressions, unlike sf::Vector2i.
+	struct FrameIndex {
+		int x;
+		int y;
+	};
+
+	/// @brief The bounds of a frame in a sprite sheet. Usable in constant expressions, unlike sf::IntRect.
+	struct FrameRect {
+		int left;
+		int top;
+		int width;
+		int height;
+
+		/// @brief Converts the bounds to the sf::IntRect used by AnimationSet.
+		operator sf::IntRect() const {
+			return sf::IntRect(left, top, width, height);
+		}
+	};
+
+	/// @brief True if both FrameRects have the same bounds.
+	constexpr bool operator==(const FrameRect& left, const FrameRect& right) noexcept {
+		return left.left == right.left && left.top == right.top && left.width == right.width && left.height == right.height;
+	}
+
+	/// @brief True if the FrameRects do not have the same bounds.
+	constexpr bool operator!=(const FrameRect& left, const FrameRect& right) noexcept {
+		return !(left == right);
+	}
+
+	/// @brief The frames of several animations built by a UniformSpriteSheet.
+	///		When the table is constexpr, the frames are computed while compiling.
+	/// @tparam AnimationCount The number of animations.
+	/// @tparam FrameCount The number of frames across every animation.
+	template <std::size_t AnimationCount, std::size_t FrameCount>
+	class UniformAnimationTable {
+	public:
+		/// @brief Construct a table from its frames.
+		/// @param frameSize The size of every frame, as {width, height}.
+		/// @param frames The frames of every animation, back to back.
+		/// @param offsets The index of the first frame of each animation, followed by FrameCount.
+		constexpr UniformAnimationTable(FrameIndex frameSize, std::array<FrameRect, FrameCount> frames, std::array<std::size_t, AnimationCount + 1> offsets)
+			: m_frameSize(frameSize), m_frames(frames), m_offsets(offsets) {
+		}
+
+		/// @brief Returns the number of animations.
+		static constexpr std::size_t getAnimationCount() noexcept {
+			return AnimationCount;
+		}
+
+		/// @brief Returns the number of frames across every animation.
+		static constexpr std::size_t getFrameCount() noexcept {
+			return FrameCount;
+		}
+
+		/// @brief Returns the size of every frame, as {width, height}.
+		constexpr FrameIndex getFrameSize() const noexcept {
+			return m_frameSize;
+		}
+
+		/// @brief Returns the number of frames of an animation.
+		/// @param animationIndex The index of the animation. Must be less than AnimationCount.
+		constexpr std::size_t getAnimationSize(std::size_t animationIndex) const noexcept {
+			return m_offsets[animationIndex + 1] - m_offsets[animationIndex];
+		}
+
+		/// @brief Returns a frame of an animation.
+		/// @param animationIndex The index of the animation. Must be less than AnimationCount.
+		/// @param frameIndex The index of the frame in the animation. Must be less than the size of the animation.
+		constexpr const FrameRect& getFrame(std::size_t animationIndex, std::size_t frameIndex) const noexcept {
+			return m_frames[m_offsets[animationIndex] + frameIndex];
+		}
+
+		/// @brief Creates a UniformAnimationSet holding the animations of the table.
+		///		The frames are copied in one pass. Nothing is computed.
+		UniformAnimationSet::Ptr makeAnimationSet() const {
+			auto animationSet = std::make_shared<UniformAnimationSet>(sf::Vector2i(m_frameSize.x, m_frameSize.y));
+			animationSet->reserve(AnimationCount, FrameCount);
+			for (std::size_t ii = 0; ii < AnimationCount; ++ii) {
+				animationSet->addAnimation(m_frames.begin() + m_offsets[ii], m_frames.begin() + m_offsets[ii + 1]);
+			}
+			return animationSet;
+		}
+
+	private:
+		FrameIndex m_frameSize;
+		std::array<FrameRect, FrameCount> m_frames;
+		std::array<std::size_t, AnimationCount + 1> m_offsets;
+	};
+
+	/// @brief Describes a sprite sheet of Columns by Rows frames that are all FrameWidth by FrameHeight pixels.
+	///		Builds the same frames as UniformAnimationSet, but can build them while compiling.
+	///		Declaring the result of makeAnimationTable constexpr makes a frame outside of the sheet a compile error.
+	///
+	///		using HeroSheet = UniformSpriteSheet<32, 32, 8, 4>;
+	///		constexpr auto heroAnimations = HeroSheet::makeAnimationTable({ { 0, 0 }, { 1, 0 } }, { { 0, 1 } });
+	///		UniformAnimationSet::Ptr heroSet = heroAnimations.makeAnimationSet();
+	template <int FrameWidth, int FrameHeight, int Columns, int Rows>
+	class UniformSpriteSheet {
+		static_assert(FrameWidth > 0 && FrameHeight > 0, "UniformSpriteSheet frames must have a positive size.");
+		static_assert(Columns > 0 && Rows > 0, "UniformSpriteSheet must have at least one frame.");
+
+	public:
+		/// @brief Returns true if the frame is inside the sheet. Returns false otherwise.
+		/// @param frameIndex The (x, y) coordinate of the frame.
+		static constexpr bool contains(FrameIndex frameIndex) noexcept {
+			return frameIndex.x >= 0 && frameIndex.x < Columns && frameIndex.y >= 0 && frameIndex.y < Rows;
+		}
+
+		/// @brief Returns the bounds of a frame.
+		/// @param frameIndex The (x, y) coordinate of the frame.
+		/// @throws std::out_of_range if the frame is outside of the sheet. In a constant expression this is a compile error.
+		static constexpr FrameRect getFrame(FrameIndex frameIndex) {
+			if (!contains(frameIndex)) {
+				throw std::out_of_range("The frame is outside of the sprite sheet.");
+			}
+			return FrameRect{ frameIndex.x * FrameWidth, frameIndex.y * FrameHeight, FrameWidth, FrameHeight };
+		}
+
+		/// @brief Builds the frames of several animations.
+		/// @param animations The frames of each animation as (x, y) coordinates into the sheet.
+		/// @throws std::out_of_range if a frame is outside of the sheet. In a constant expression this is a compile error.
+		template <std::size_t... AnimationSizes>
+		static constexpr UniformAnimationTable<sizeof...(AnimationSizes), (AnimationSizes + ... + 0)>
+			makeAnimationTable(const FrameIndex (&... animations)[AnimationSizes]) {
+			constexpr std::size_t animationCount = sizeof...(AnimationSizes);
+			constexpr std::size_t frameCount = (AnimationSizes + ... + 0);
+
+			std::array<FrameRect, frameCount> frames{};
+			std::array<std::size_t, animationCount + 1> offsets{};
+			std::size_t animationIndex = 0;
+			std::size_t frameIndex = 0;
+			(appendAnimation(animations, frames, offsets, animationIndex, frameIndex), ...);
+			offsets[animationCount] = frameIndex;
+
+			return UniformAnimationTable<animationCount, frameCount>(FrameIndex{ FrameWidth, FrameHeight }, frames, offsets);
+		}
+
+	private:
+		template <std::size_t AnimationSize, std::size_t FrameCount, std::size_t OffsetCount>
+		static constexpr void appendAnimation(
+			const FrameIndex (&animation)[AnimationSize],
+			std::array<FrameRect, FrameCount>& frames,
+			std::array<std::size_t, OffsetCount>& offsets,
+			std::size_t& animationIndex,
+			std::size_t& frameIndex) {
+			offsets[animationIndex++] = frameIndex;
+			for (const FrameIndex& index : animation) {
+				frames[frameIndex++] = getFrame(index);
+			}
+		}
+	};
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <GameBackbone/Core/Updatable.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GB {
+
+	/// @brief Updates many independent Updatables in parallel on a work stealing thread pool.
+	///		Updatables are grouped into phases. Phases run one after another, in the order they were added, so anything an Updatable
+	///		depends on can be put in an earlier phase. The Updatables within a phase are updated at the same time and must not
+	///		touch each other.
+	///
+	///		Each phase is split into chunks of consecutive Updatables. Every thread starts on its own share of the chunks, then steals
+	///		chunks from the others once it runs out. The thread that calls update works too.
+	///
+	///		Updatables are referenced, not owned. An Updatable must stay at the same address until it is removed.
+	class libGameBackbone UpdateScheduler : public Updatable {
+	public:
+		/// @brief Construct an UpdateScheduler with one phase.
+		/// @param threadCount The number of threads that update, including the one that calls update. 0 uses every hardware thread.
+		explicit UpdateScheduler(std::size_t threadCount = 0);
+
+		UpdateScheduler(const UpdateScheduler&) = delete;
+		UpdateScheduler& operator=(const UpdateScheduler&) = delete;
+		UpdateScheduler(UpdateScheduler&&) = delete;
+		UpdateScheduler& operator=(UpdateScheduler&&) = delete;
+
+		/// @brief Stops the worker threads.
+		~UpdateScheduler() override;
+
+		/// @brief Adds a phase that runs after every existing phase.
+		/// @return The index of the new phase.
+		std::size_t addPhase();
+
+		/// @brief Returns the number of phases.
+		[[nodiscard]]
+		std::size_t getPhaseCount() const noexcept;
+
+		/// @brief Adds an Updatable to a phase.
+		/// @param updatable The Updatable.
+		/// @param phase The index of the phase.
+		/// @throws std::out_of_range if the phase does not exist.
+		void addUpdatable(Updatable& updatable, std::size_t phase = 0);
+
+		/// @brief Removes an Updatable from every phase it was added to. Does nothing if it was not added.
+		/// @param updatable The Updatable.
+		void removeUpdatable(const Updatable& updatable);
+
+		/// @brief Removes every Updatable. The phases are kept.
+		void clearUpdatables();
+
+		/// @brief Returns the number of Updatables across every phase.
+		[[nodiscard]]
+		std::size_t getUpdatableCount() const noexcept;
+
+		/// @brief Returns the number of threads that update, including the one that calls update.
+		[[nodiscard]]
+		std::size_t getThreadCount() const noexcept;
+
+		/// @brief Sets the number of consecutive Updatables in a chunk.
+		///		Larger chunks cost less to schedule; smaller chunks balance uneven work better.
+		///		Phases with no more than one chunk are updated on the calling thread.
+		/// @param chunkSize The number of Updatables per chunk.
+		/// @throws std::invalid_argument if chunkSize is 0.
+		void setChunkSize(std::size_t chunkSize);
+
+		/// @brief Returns the number of consecutive Updatables in a chunk.
+		[[nodiscard]]
+		std::size_t getChunkSize() const noexcept;
+
+		/// @brief Updates every Updatable, one phase at a time. Blocks until every phase is done.
+		///		If an Updatable throws, the rest of its phase still runs, later phases do not, and the first exception is rethrown.
+		/// @param elapsedTime The time passed to every Updatable.
+		void update(sf::Int64 elapsedTime) override;
+
+		/// @brief The default number of consecutive Updatables in a chunk.
+		static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64;
+
+	private:
+		/// @brief Consecutive Updatables of the running phase.
+		struct Chunk {
+			Updatable* const* first;
+			Updatable* const* last;
+		};
+
+		/// @brief The chunks owned by one thread. The owner takes from the front; thieves take from the back.
+		struct WorkQueue {
+			std::mutex mutex;
+			std::deque<Chunk> chunks;
+		};
+
+		void updatePhase(const std::vector<Updatable*>& phase, sf::Int64 elapsedTime);
+		void runWorker(std::size_t threadIndex);
+		void runChunks(std::size_t threadIndex);
+		bool takeChunk(std::size_t threadIndex, Chunk& chunk);
+
+		std::vector<std::vector<Updatable*>> m_phases;
+		std::size_t m_chunkSize = DEFAULT_CHUNK_SIZE;
+
+		// One per thread. Index 0 belongs to the thread that calls update.
+		std::vector<std::unique_ptr<WorkQueue>> m_queues;
+		std::atomic<std::size_t> m_remainingChunks{ 0 };
+		// Written before chunks are queued, so reading it after taking a chunk is safe
+		sf::Int64 m_elapsedTime = 0;
+
+		std::mutex m_mutex;
+		std::condition_variable m_startCondition;
+		std::condition_variable m_doneCondition;
+		std::uint64_t m_generation = 0;
+		std::exception_ptr m_error;
+		bool m_shouldStop = false;
+
+		std::vector<std::thread> m_workers;
+	};
+}
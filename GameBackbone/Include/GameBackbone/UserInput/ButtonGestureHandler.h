@@ -9,8 +9,11 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -36,7 +39,8 @@ namespace GB
 		template <typename T>
 		using GestureContainer = std::vector<T>;
 		using GestureValueContainer = GestureContainer<GestureMatchSignalerType>;
-		using GesturePointerContainer = GestureContainer<std::add_pointer_t<GestureMatchSignalerType>>;
+		using OpenSetWord = std::uint64_t;
+		static constexpr std::size_t OPEN_SET_WORD_BITS = std::numeric_limits<OpenSetWord>::digits;
 	public:
 		using iterator = typename GestureValueContainer::iterator;
 		using const_iterator = typename GestureValueContainer::const_iterator;
@@ -102,6 +106,7 @@ namespace GB
 		GestureMatchSignalerType& addMatchSignaler(GestureMatchSignalerType matchSignaler)
 		{
 			auto& emplacedSignaler = m_wholeSet.emplace_back(std::move(matchSignaler));
+			m_openSet.resize(getOpenSetWordCount(m_wholeSet.size()));
 			reset();
 			return emplacedSignaler;
 		}
@@ -116,15 +121,16 @@ namespace GB
 				throw std::out_of_range("Out of bounds position in ButtonGestureHandler::removeGesture");
 			}
 
-			// Remove from the open set if it exists
-			auto removeResult = std::remove(m_openSetGestures.begin(), m_openSetGestures.end(), &m_wholeSet[position]);
-			if (removeResult != m_openSetGestures.end())
+			// Remove from the open set by moving the bits of every later GB::GestureMatchSignaler down by one
+			for (size_type ii = position; ii + 1 < m_wholeSet.size(); ++ii)
 			{
-				m_openSetGestures.erase(removeResult);
+				setOpen(ii, isOpen(ii + 1));
 			}
+			setOpen(m_wholeSet.size() - 1, false);
+			m_openSet.resize(getOpenSetWordCount(m_wholeSet.size() - 1));
 
 			// Remove from the whole set
-			m_wholeSet.erase(m_wholeSet.begin() + position);
+			m_wholeSet.erase(m_wholeSet.begin() + static_cast<std::ptrdiff_t>(position));
 		}
 
 		/// @brief Gets a reference to the GB::GestureMatchSignaler at the provided location.
@@ -154,14 +160,17 @@ namespace GB
 		/// @brief Makes all instances of GB::GestureMatchSignaler active. Resets the state of all instances of GB::GestureMatchSignaler.
 		void reset()
 		{
-			// Clear the open set completely
-			m_openSetGestures.clear();
-
-			// Add all gestures from the whole set to the active gestures open set.
 			for (GestureMatchSignalerType& bind : m_wholeSet)
 			{
 				bind.reset();
-				m_openSetGestures.push_back(&bind);
+			}
+
+			// Add all gestures from the whole set to the open set, a word at a time.
+			std::fill(m_openSet.begin(), m_openSet.end(), ~OpenSetWord{ 0 });
+			const std::size_t trailingBits = m_wholeSet.size() % OPEN_SET_WORD_BITS;
+			if (trailingBits != 0)
+			{
+				m_openSet.back() = (OpenSetWord{ 1 } << trailingBits) - 1;
 			}
 		}
 
@@ -222,30 +231,68 @@ namespace GB
 		bool applyEventToOpenSet(sf::Int64 elapsedTime, const sf::Event& event)
 		{
 			bool eventConsumed = false;
-			for (std::size_t ii = 0; ii < m_openSetGestures.size(); ++ii)
+			for (std::size_t wordIndex = 0; wordIndex < m_openSet.size(); ++wordIndex)
 			{
-				// Forward event to the gesture bind
-				auto result = m_openSetGestures[ii]->processEvent(elapsedTime, event);
-
-				// The bind cannot take any more input. Remove it from the open set.
-				if (!result.isReadyForInput)
+				// Words whose gestures have all been removed from the open set are skipped as a whole
+				OpenSetWord openBits = m_openSet[wordIndex];
+				for (std::size_t bit = 0; openBits != 0; ++bit, openBits >>= 1)
 				{
-					m_openSetGestures.erase(m_openSetGestures.begin() + ii);
-					--ii;
-				}
-
-				// The event was part of the gesture
-				if (result.inputConsumed)
-				{
-					eventConsumed = true;
+					if ((openBits & 1) == 0)
+					{
+						continue;
+					}
+
+					// Forward event to the gesture bind
+					auto result = m_wholeSet[wordIndex * OPEN_SET_WORD_BITS + bit].processEvent(elapsedTime, event);
+
+					// The bind cannot take any more input. Remove it from the open set.
+					if (!result.isReadyForInput)
+					{
+						m_openSet[wordIndex] &= ~(OpenSetWord{ 1 } << bit);
+					}
+
+					// The event was part of the gesture
+					if (result.inputConsumed)
+					{
+						eventConsumed = true;
+					}
 				}
 			}
 
 			return eventConsumed;
 		}
 
-		GesturePointerContainer m_openSetGestures;
+		/// @brief Returns the number of words needed for the open set of signalerCount GB::GestureMatchSignaler.
+		static std::size_t getOpenSetWordCount(std::size_t signalerCount)
+		{
+			return (signalerCount + OPEN_SET_WORD_BITS - 1) / OPEN_SET_WORD_BITS;
+		}
+
+		/// @brief Returns true if the GB::GestureMatchSignaler at the position is in the open set.
+		bool isOpen(size_type position) const
+		{
+			return (m_openSet[position / OPEN_SET_WORD_BITS] >> (position % OPEN_SET_WORD_BITS)) & 1;
+		}
+
+		/// @brief Adds the GB::GestureMatchSignaler at the position to the open set or removes it.
+		void setOpen(size_type position, bool open)
+		{
+			const OpenSetWord mask = OpenSetWord{ 1 } << (position % OPEN_SET_WORD_BITS);
+			if (open)
+			{
+				m_openSet[position / OPEN_SET_WORD_BITS] |= mask;
+			}
+			else
+			{
+				m_openSet[position / OPEN_SET_WORD_BITS] &= ~mask;
+			}
+		}
+
 		GestureValueContainer m_wholeSet;
+
+		// One bit per GB::GestureMatchSignaler in m_wholeSet. A set bit means that it is in the open set.
+		// Unlike pointers, the bits stay valid when the handler is copied or the whole set reallocates.
+		std::vector<OpenSetWord> m_openSet;
 	};
 
 	/// @brief GB::ButtonGestureHandler that handles sequences of key down inputs. 
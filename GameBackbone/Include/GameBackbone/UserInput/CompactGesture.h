@@ -0,0 +1,169 @@
+#pragma once
+
+#include <GameBackbone/UserInput/EventComparator.h>
+
+#include <SFML/Window/Event.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace GB
+{
+	/// @brief The number of events a GB::CompactGesture holds by default. Seven keys and a count fill 32 bytes.
+	inline constexpr std::size_t DEFAULT_COMPACT_GESTURE_CAPACITY = 7;
+
+	/// @brief A gesture stored as the GB::EventKey of each of its events, inline, with a fixed capacity.
+	/// @details Four bytes per event instead of a whole sf::Event, and no allocation. A CompactGesture is trivially copyable,
+	///		so a GB::GestureMatchSignaler that stores its gesture this way, and whose action is trivially copyable, is too.
+	///
+	///		Only events that have a GB::EventKey can be stored. Events are converted with the keys made by the built-in comparators,
+	///		or by the comparator passed to the converting constructor.
+	/// @tparam Capacity The most events the gesture can hold.
+	template <std::size_t Capacity = DEFAULT_COMPACT_GESTURE_CAPACITY>
+	class CompactGesture
+	{
+		static_assert(Capacity > 0, "A CompactGesture must be able to hold at least one event.");
+		static_assert(Capacity <= std::numeric_limits<std::uint32_t>::max(), "The capacity of a CompactGesture must fit in 32 bits.");
+
+	public:
+		using value_type = EventKey;
+		using size_type = std::size_t;
+		using const_iterator = const EventKey*;
+
+		/// @brief Construct an empty CompactGesture.
+		CompactGesture() = default;
+
+		/// @brief Construct a CompactGesture from event keys.
+		/// @param keys The key of each event in the gesture.
+		/// @throws std::length_error if there are more keys than the capacity.
+		CompactGesture(std::initializer_list<EventKey> keys)
+		{
+			for (EventKey key : keys)
+			{
+				push_back(key);
+			}
+		}
+
+		/// @brief Construct a CompactGesture from events using the keys made by the built-in comparators.
+		/// @param events The events in the gesture.
+		/// @throws std::length_error if there are more events than the capacity.
+		/// @throws std::invalid_argument if an event is not a key, joystick button, or mouse button event.
+		CompactGesture(std::initializer_list<sf::Event> events) : CompactGesture(events.begin(), events.end(), ButtonEventComparator{})
+		{
+		}
+
+		/// @brief Construct a CompactGesture from events using the keys made by the built-in comparators.
+		/// @param events The events in the gesture.
+		/// @throws std::length_error if there are more events than the capacity.
+		/// @throws std::invalid_argument if an event is not a key, joystick button, or mouse button event.
+		CompactGesture(const std::vector<sf::Event>& events) : CompactGesture(events.begin(), events.end(), ButtonEventComparator{})
+		{
+		}
+
+		/// @brief Construct a CompactGesture from events using the keys made by a comparator.
+		/// @param events The events in the gesture.
+		/// @param eventComparator The keyed event comparator that makes the key of each event.
+		/// @throws std::length_error if there are more events than the capacity.
+		/// @throws std::invalid_argument if the comparator makes no key for an event.
+		template <class EventComparator, std::enable_if_t<is_keyed_event_comparator_v<EventComparator>, bool> = true>
+		CompactGesture(const std::vector<sf::Event>& events, const EventComparator& eventComparator) :
+			CompactGesture(events.begin(), events.end(), eventComparator)
+		{
+		}
+
+		/// @brief Appends the key of an event.
+		/// @param key The key to append.
+		/// @throws std::length_error if the gesture is full.
+		void push_back(EventKey key)
+		{
+			if (m_size == Capacity)
+			{
+				throw std::length_error("The gesture does not fit in the CompactGesture.");
+			}
+			m_keys[m_size] = key;
+			++m_size;
+		}
+
+		/// @brief Returns the number of events in the gesture.
+		size_type size() const noexcept
+		{
+			return m_size;
+		}
+
+		/// @brief Returns true if the gesture has no events.
+		bool empty() const noexcept
+		{
+			return m_size == 0;
+		}
+
+		/// @brief Returns the most events the gesture can hold.
+		static constexpr size_type capacity() noexcept
+		{
+			return Capacity;
+		}
+
+		/// @brief Returns the key of the event at the position. The position must be less than size().
+		const EventKey& operator[](size_type position) const
+		{
+			return m_keys[position];
+		}
+
+		/// @brief Returns an iterator to the first key.
+		const_iterator begin() const noexcept
+		{
+			return m_keys.data();
+		}
+
+		/// @brief Returns an iterator past the last key.
+		const_iterator end() const noexcept
+		{
+			return m_keys.data() + m_size;
+		}
+
+		friend bool operator==(const CompactGesture& lhs, const CompactGesture& rhs) noexcept
+		{
+			if (lhs.m_size != rhs.m_size)
+			{
+				return false;
+			}
+			for (std::uint32_t ii = 0; ii < lhs.m_size; ++ii)
+			{
+				if (lhs.m_keys[ii] != rhs.m_keys[ii])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		friend bool operator!=(const CompactGesture& lhs, const CompactGesture& rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		template <class EventIterator, class EventComparator>
+		CompactGesture(EventIterator first, EventIterator last, const EventComparator& eventComparator)
+		{
+			for (; first != last; ++first)
+			{
+				const std::optional<EventKey> key = eventComparator.getEventKey(*first);
+				if (!key)
+				{
+					throw std::invalid_argument("The event cannot be stored in a CompactGesture.");
+				}
+				push_back(*key);
+			}
+		}
+
+		std::array<EventKey, Capacity> m_keys{};
+		std::uint32_t m_size = 0;
+	};
+}
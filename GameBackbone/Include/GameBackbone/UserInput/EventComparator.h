@@ -2,8 +2,36 @@
 
 #include <SFML/Window/Event.hpp>
 
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
 namespace GB
 {
+	/// @brief Compact identity of a button event: its type and the key or button it refers to.
+	///		Two events with equal keys are equal according to the comparator that made the keys.
+	struct EventKey
+	{
+		std::uint16_t type;
+		std::uint16_t code;
+
+		/// @brief Returns the type and code packed into one integer. Useful as a hash key.
+		constexpr std::uint32_t pack() const noexcept
+		{
+			return (std::uint32_t{ type } << 16) | code;
+		}
+
+		friend constexpr bool operator==(EventKey lhs, EventKey rhs) noexcept
+		{
+			return lhs.type == rhs.type && lhs.code == rhs.code;
+		}
+
+		friend constexpr bool operator!=(EventKey lhs, EventKey rhs) noexcept
+		{
+			return !(lhs == rhs);
+		}
+	};
+
 	/// @brief if T is an event comparator, provides a member constant value to true.
 	///		For any other type, value is equal to false.
 	///		Event comparators compare two events for equality.
@@ -21,6 +49,38 @@ namespace GB
 	template <typename T>
 	static inline constexpr bool is_event_comparator_v = is_event_comparator<T>::value;
 
+	namespace Detail
+	{
+		template <class T>
+		using EventComparatorGetEventKey = decltype(
+			std::declval<std::optional<EventKey>&>() = std::declval<const T&>().getEventKey(std::declval<const sf::Event&>())
+		);
+
+		template <class T, class = void>
+		struct supports_event_comparator_get_event_key : std::false_type {};
+
+		template <class T>
+		struct supports_event_comparator_get_event_key<T, std::void_t<EventComparatorGetEventKey<T>>> : std::true_type {};
+	}
+
+	/// @brief if T is an event comparator that can reduce events to a GB::EventKey, provides a member constant value equal to true.
+	///		For any other type, value is equal to false.
+	///		A keyed event comparator has a const member function getEventKey that takes a const reference to sf::Event and
+	///		returns std::optional<GB::EventKey>. It returns std::nullopt for events that never compare equal to anything.
+	///		Otherwise, two events compare equal exactly when their keys are equal.
+	/// @tparam T The type to check
+	template <typename T>
+	using is_keyed_event_comparator = std::conjunction<
+		is_event_comparator<T>,
+		Detail::supports_event_comparator_get_event_key<T>
+	>;
+
+	/// @brief Checks if a type is a keyed event comparator.
+	/// @tparam T The type to check
+	/// @see GB::is_keyed_event_comparator
+	template <typename T>
+	static inline constexpr bool is_keyed_event_comparator_v = is_keyed_event_comparator<T>::value;
+
 	/// @brief Comparator used to compare two key events
 	class KeyEventComparator
 	{
@@ -36,6 +96,16 @@ namespace GB
 			// Return true if the buttons match
 			return (userEvent.key.code == gestureEvent.key.code && userEvent.key.code != sf::Keyboard::Unknown);
 		}
+
+		/// @brief Returns the key of a key event. Returns std::nullopt for any other event and for unknown keys.
+		std::optional<EventKey> getEventKey(const sf::Event& event) const
+		{
+			if ((event.type != sf::Event::KeyPressed && event.type != sf::Event::KeyReleased) || event.key.code == sf::Keyboard::Unknown)
+			{
+				return std::nullopt;
+			}
+			return EventKey{ static_cast<std::uint16_t>(event.type), static_cast<std::uint16_t>(event.key.code) };
+		}
 	};
 
 	/// @brief Comparator used to compare two joystick button events
@@ -53,6 +123,16 @@ namespace GB
 			// Return true if the buttons match
 			return userEvent.joystickButton.button == gestureEvent.joystickButton.button;
 		}
+
+		/// @brief Returns the key of a joystick button event. Returns std::nullopt for any other event.
+		std::optional<EventKey> getEventKey(const sf::Event& event) const
+		{
+			if (event.type != sf::Event::JoystickButtonPressed && event.type != sf::Event::JoystickButtonReleased)
+			{
+				return std::nullopt;
+			}
+			return EventKey{ static_cast<std::uint16_t>(event.type), static_cast<std::uint16_t>(event.joystickButton.button) };
+		}
 	};
 
 	/// @brief Comparator used to compare two mouse button events
@@ -70,6 +150,16 @@ namespace GB
 			// Return true if the buttons match
 			return userEvent.mouseButton.button == gestureEvent.mouseButton.button;
 		}
+
+		/// @brief Returns the key of a mouse button event. Returns std::nullopt for any other event.
+		std::optional<EventKey> getEventKey(const sf::Event& event) const
+		{
+			if (event.type != sf::Event::MouseButtonPressed && event.type != sf::Event::MouseButtonReleased)
+			{
+				return std::nullopt;
+			}
+			return EventKey{ static_cast<std::uint16_t>(event.type), static_cast<std::uint16_t>(event.mouseButton.button) };
+		}
 	};
 
 	/// @brief Comparator used to compare two button down or button up events
@@ -89,5 +179,19 @@ namespace GB
 				|| JoystickButtonEventComparator{}(userEvent, gestureEvent)
 				|| MouseButtonEventComparator{}(userEvent, gestureEvent);
 		}
+
+		/// @brief Returns the key of a key, joystick button, or mouse button event. Returns std::nullopt for any other event.
+		std::optional<EventKey> getEventKey(const sf::Event& event) const
+		{
+			if (std::optional<EventKey> key = KeyEventComparator{}.getEventKey(event))
+			{
+				return key;
+			}
+			if (std::optional<EventKey> key = JoystickButtonEventComparator{}.getEventKey(event))
+			{
+				return key;
+			}
+			return MouseButtonEventComparator{}.getEventKey(event);
+		}
 	};
 }
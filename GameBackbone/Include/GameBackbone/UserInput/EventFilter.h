@@ -2,6 +2,9 @@
 
 #include <SFML/Window/Event.hpp>
 
+#include <cstdint>
+#include <type_traits>
+
 namespace GB
 {
 	/// @brief A type_trait expressing the concept of an EventFilter. An EventFilter checks to see if an sf::Event meets some criteria.
@@ -18,11 +21,44 @@ namespace GB
 	template <typename T>
 	static inline constexpr bool is_event_filter_v = is_event_filter<T>::value;
 
+	/// @brief A set of sf::Event::EventType values, one bit per type.
+	using EventTypeSet = std::uint64_t;
+
+	static_assert(sf::Event::Count < 64, "Every sf::Event::EventType must fit in an EventTypeSet.");
+
+	/// @brief The EventTypeSet that holds every event type, including values past sf::Event::Count.
+	inline constexpr EventTypeSet ALL_EVENT_TYPES = ~EventTypeSet{ 0 };
+
+	/// @brief Returns the EventTypeSet that holds the given event types.
+	template <typename... EventTypes>
+	constexpr EventTypeSet makeEventTypeSet(EventTypes... eventTypes)
+	{
+		return (EventTypeSet{ 0 } | ... | (EventTypeSet{ 1 } << static_cast<unsigned int>(eventTypes)));
+	}
+
+	namespace Detail
+	{
+		template <class T, class = void>
+		struct event_filter_event_types : std::integral_constant<EventTypeSet, ALL_EVENT_TYPES> {};
+
+		template <class T>
+		struct event_filter_event_types<T, std::void_t<decltype(T::eventTypes)>> : std::integral_constant<EventTypeSet, T::eventTypes> {};
+	}
+
+	/// @brief The EventTypeSet holding every type of event that an EventFilter can accept.
+	///		An EventFilter declares it with a static constexpr EventTypeSet member named eventTypes. It is ALL_EVENT_TYPES for
+	///		filters that do not declare one.
+	/// @tparam T The EventFilter.
+	template <typename T>
+	inline constexpr EventTypeSet event_filter_event_types_v = Detail::event_filter_event_types<T>::value;
+
 	/// @brief Fulfills the requirements of the concept EventFilter. Filters for any sf::Event that is a key down event.
 	/// @details Filters for any sf::Event that has a type of sf::Event::KeyPressed.
 	class KeyDownEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::KeyPressed);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::KeyPressed;
@@ -34,6 +70,8 @@ namespace GB
 	class KeyUpEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::KeyReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::KeyReleased;
@@ -45,6 +83,8 @@ namespace GB
 	class AnyKeyEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::KeyPressed, sf::Event::KeyReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return KeyDownEventFilter{}(userEvent) || KeyUpEventFilter{}(userEvent);
@@ -56,6 +96,8 @@ namespace GB
 	class MouseButtonDownEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::MouseButtonPressed);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::MouseButtonPressed;
@@ -67,6 +109,8 @@ namespace GB
 	class MouseButtonUpEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::MouseButtonReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::MouseButtonReleased;
@@ -78,6 +122,8 @@ namespace GB
 	class AnyMouseButtonEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::MouseButtonPressed, sf::Event::MouseButtonReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return MouseButtonDownEventFilter{}(userEvent) || MouseButtonUpEventFilter{}(userEvent);
@@ -89,6 +135,8 @@ namespace GB
 	class JoystickButtonDownEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::JoystickButtonPressed);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::JoystickButtonPressed;
@@ -100,6 +148,8 @@ namespace GB
 	class JoystickButtonUpEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::JoystickButtonReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return userEvent.type == sf::Event::JoystickButtonReleased;
@@ -111,6 +161,8 @@ namespace GB
 	class AnyJoystickButtonEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = makeEventTypeSet(sf::Event::JoystickButtonPressed, sf::Event::JoystickButtonReleased);
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return JoystickButtonDownEventFilter{}(userEvent) || JoystickButtonUpEventFilter{}(userEvent);
@@ -122,6 +174,8 @@ namespace GB
 	class AnyButtonDownEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = KeyDownEventFilter::eventTypes | MouseButtonDownEventFilter::eventTypes | JoystickButtonDownEventFilter::eventTypes;
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return KeyDownEventFilter{}(userEvent) || MouseButtonDownEventFilter{}(userEvent) || JoystickButtonDownEventFilter{}(userEvent);
@@ -133,6 +187,8 @@ namespace GB
 	class AnyButtonUpEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = KeyUpEventFilter::eventTypes | MouseButtonUpEventFilter::eventTypes | JoystickButtonUpEventFilter::eventTypes;
+
 		bool operator()(const sf::Event& userEvent)
 		{
 			return KeyUpEventFilter{}(userEvent) || MouseButtonUpEventFilter{}(userEvent) || JoystickButtonUpEventFilter{}(userEvent);
@@ -144,6 +200,8 @@ namespace GB
 	class AnyEventFilter
 	{
 	public:
+		static constexpr EventTypeSet eventTypes = ALL_EVENT_TYPES;
+
 		bool operator()(const sf::Event& /*userEvent*/)
 		{
 			return true;
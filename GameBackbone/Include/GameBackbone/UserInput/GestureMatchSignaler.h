@@ -1,6 +1,7 @@
 #pragma once
 
 #include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/UserInput/CompactGesture.h>
 #include <GameBackbone/UserInput/EventComparator.h>
 #include <GameBackbone/UserInput/EventFilter.h>
 #include <GameBackbone/UserInput/InputHandler.h>
@@ -10,6 +11,7 @@
 
 #include <cassert>
 #include <functional>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -41,6 +43,13 @@ namespace GB
 		template <class GestureMatchSignalerType>
 		struct supports_gesture_match_signaler_process_event <GestureMatchSignalerType, std::void_t<GestureMatchSignalerProcessEvent<GestureMatchSignalerType>>> :
 			std::true_type {};
+
+		template <class Gesture>
+		inline constexpr bool is_event_key_gesture_v = std::is_same_v<typename Gesture::value_type, EventKey>;
+
+		template <class Gesture, class EventCompare>
+		inline constexpr bool is_supported_gesture_v =
+			std::is_same_v<Gesture, std::vector<sf::Event>> || (is_event_key_gesture_v<Gesture> && is_keyed_event_comparator_v<EventCompare>);
 	}
 
 	/// @brief Type trait that determines if a type is a GestureMatchSignaler. If the type is a GestureMatchSignaler
@@ -58,15 +67,38 @@ namespace GB
 	template <class GestureMatchSignalerType>
 	inline constexpr bool is_gesture_match_signaler_v = is_gesture_match_signaler<GestureMatchSignalerType>::value;
 
+	/// @brief Indicates the desired behavior of a GestureMatchSignaler after a match is found.
+	enum class GestureMatchBehavior
+	{
+		/// @brief Signal with every subsequent event that matches the last event in the gesture.
+		Penultimate,
+
+		/// @brief Puts the gesture back to position 0 after it completes and allows the gesture to complete again.
+		Reset,
+
+		/// @brief Stop handling events after signaling the next match.
+		Block
+	};
+
 	/// @brief Signal class that fires an action when it handles a set of inputs that match an expected gesture.
 	/// @tparam EventCompare The type of the comparator that will be used to check if two events match.
 	/// @tparam EventFilter The type of the filter that determines if an event should be matched against the expected
 	///						gesture or skipped entirely.
+	/// @tparam Action The type of the action fired when the gesture is matched. It must be callable with no arguments through a
+	///						const reference. A function pointer or a small function object is stored inline and called directly,
+	///						which avoids the allocation and indirect call of std::function and makes the signaler cheaper to copy.
+	/// @tparam Gesture The type that stores the expected gesture. Either std::vector<sf::Event>, or a GB::CompactGesture when
+	///						EventCompare is a keyed event comparator. A CompactGesture keeps the gesture inline as GB::EventKey values,
+	///						so matching an event reads the signaler's own memory instead of a separate allocation of sf::Event.
 	template <
 		typename EventCompare,
 		typename EventFilter,
+		typename Action = std::function<void()>,
+		typename Gesture = std::vector<sf::Event>,
 		std::enable_if_t<is_event_comparator_v<EventCompare>, bool> = true,
-		std::enable_if_t<is_event_filter_v<EventFilter>, bool> = true
+		std::enable_if_t<is_event_filter_v<EventFilter>, bool> = true,
+		std::enable_if_t<std::is_invocable_v<const Action&>, bool> = true,
+		std::enable_if_t<Detail::is_supported_gesture_v<Gesture, EventCompare>, bool> = true
 	>
 	class GestureMatchSignaler
 	{
@@ -76,20 +108,12 @@ namespace GB
 
 		using EventComparatorType = EventCompare;
 		using EventFilterType = EventFilter;
+		using ActionType = Action;
+		using GestureType = Gesture;
 		using ProcessEventResult = GestureMatchSignalerProcessEventResult;
 
-		/// @brief Indicates the desired behavior after a match is found.
-		enum class MatchBehavior
-		{
-			/// @brief Signal with every subsequent event that matches the last event in the gesture.
-			Penultimate,
-
-			/// @brief Puts the gesture back to position 0 after it completes and allows the gesture to complete again.
-			Reset,
-
-			/// @brief Stop handling events after signaling the next match.
-			Block
-		};
+		/// @brief Indicates the desired behavior after a match is found. Shared by every GestureMatchSignaler.
+		using MatchBehavior = GestureMatchBehavior;
 
 		
 		/// @brief Creates a new instance of a GestureMatchSignaler.
@@ -100,8 +124,8 @@ namespace GB
 			typename = std::enable_if_t< std::is_default_constructible_v<EventFilterType>>
 		>
 		GestureMatchSignaler(
-			std::vector<sf::Event> gesture,
-			std::function<void()> action) :
+			GestureType gesture,
+			ActionType action) :
 			GestureMatchSignaler(
 				std::move(gesture),
 				std::move(action),
@@ -119,8 +143,8 @@ namespace GB
 			typename = std::enable_if_t< std::is_default_constructible_v<EventFilterType>>
 		>
 		GestureMatchSignaler(
-			std::vector<sf::Event> gesture,
-			std::function<void()> action,
+			GestureType gesture,
+			ActionType action,
 			MatchBehavior matchBehavior) :
 			GestureMatchSignaler(
 				std::move(gesture),
@@ -141,8 +165,8 @@ namespace GB
 			typename = std::enable_if_t< std::is_default_constructible_v<EventFilterType>>
 		>
 		GestureMatchSignaler(
-			std::vector<sf::Event> gesture,
-			std::function<void()> action,
+			GestureType gesture,
+			ActionType action,
 			MatchBehavior matchBehavior,
 			sf::Int64 maxTimeBetweenInputs
 		) :
@@ -166,8 +190,8 @@ namespace GB
 		/// @param eventFilter A function or function object that returns true if the input event should be matched against the expected
 		///						one and false if it should be skipped entirely.
 		GestureMatchSignaler(
-			std::vector<sf::Event> gesture,
-			std::function<void()> action,
+			GestureType gesture,
+			ActionType action,
 			MatchBehavior matchBehavior,
 			sf::Int64 maxTimeBetweenInputs,
 			EventComparatorType eventComparator,
@@ -175,8 +199,8 @@ namespace GB
 		) :
 			m_gesture(std::move(gesture)),
 			m_action(std::move(action)),
-			m_matchBehavior(matchBehavior),
 			m_maxTimeBetweenInputs(maxTimeBetweenInputs),
+			m_matchBehavior(matchBehavior),
 			m_position(0),
 			m_readyForInput(true),
 			m_eventComparator(std::move(eventComparator)),
@@ -208,7 +232,7 @@ namespace GB
 			bool actionFired = false;
 			bool inputConsumed = false;
 			// If the events are the same and the time is within the maximum, increment the position and behave accordingly.
-			if (compareEvents(getNextEvent(), event) && elapsedTime < m_maxTimeBetweenInputs)
+			if (matchesNextEvent(event) && elapsedTime < m_maxTimeBetweenInputs)
 			{
 				++m_position;
 				// If the input was the last sf::Event in the Sequence, complete the match.
@@ -231,13 +255,13 @@ namespace GB
 		}
 
 		/// @brief Returns the sf::Event Sequence that is being matched for.
-		const std::vector<sf::Event>& getGesture() const
+		const GestureType& getGesture() const
 		{
 			return m_gesture;
 		}
 
 		/// @brief Returns the action that will be fired upon the Sequence being matched.
-		const std::function<void()>& getAction() const
+		const ActionType& getAction() const
 		{
 			return m_action;
 		}
@@ -254,14 +278,26 @@ namespace GB
 			return m_matchBehavior;
 		}
 
+		/// @brief Returns the comparator used to check if an event matches the next expected event.
+		const EventComparatorType& getEventComparator() const
+		{
+			return m_eventComparator;
+		}
+
+		/// @brief Returns the filter that determines which events are matched against the gesture.
+		const EventFilterType& getEventFilter() const
+		{
+			return m_eventFilter;
+		}
+
 		/// @brief Set the Sequence of sf::Event that the GestureMatchSignaler will match.
-		void setGesture(std::vector<sf::Event> gesture)
+		void setGesture(GestureType gesture)
 		{
 			m_gesture = std::move(gesture);
 		}
 
 		/// @brief Set the action that will be fired upon the Sequence being matched.
-		void setAction(std::function<void()> action)
+		void setAction(ActionType action)
 		{
 			m_action = std::move(action);
 		}
@@ -293,13 +329,21 @@ namespace GB
 
 	private:
 
-		/// @brief Invoke the EventComparator
-		/// @param lhs The left-hand sf::Event.
-		/// @param rhs The right-hand sf::Event.
-		/// @return The result of the EventComparator.
-		bool compareEvents(const sf::Event& lhs, const sf::Event& rhs)
+		/// @brief Check if an event matches the next expected event in the gesture.
+		/// @param event The input event.
+		/// @return True if the event matches the next expected event.
+		bool matchesNextEvent(const sf::Event& event)
 		{
-			return std::invoke(m_eventComparator, lhs, rhs);
+			assert(m_position < m_gesture.size());
+			if constexpr (Detail::is_event_key_gesture_v<GestureType>)
+			{
+				const std::optional<EventKey> key = m_eventComparator.getEventKey(event);
+				return key.has_value() && *key == m_gesture[m_position];
+			}
+			else
+			{
+				return std::invoke(m_eventComparator, m_gesture[m_position], event);
+			}
 		}
 
 		/// @brief Signals the slot and sets the state that corresponds to the MatchType
@@ -329,17 +373,10 @@ namespace GB
 			// Signal.
 			std::invoke(m_action);
 		}
-		
-		/// @brief Get the next expected event
-		const sf::Event& getNextEvent() const
-		{
-			assert(m_position < m_gesture.size());
-			return m_gesture[m_position];
-		}
 
 		// Matching Criteria
-		std::vector<sf::Event> m_gesture;
-		std::function<void()> m_action;
+		GestureType m_gesture;
+		ActionType m_action;
 		sf::Int64 m_maxTimeBetweenInputs;
 
 		// State control and State
@@ -363,4 +400,22 @@ namespace GB
 
 	/// @brief Signal class that fires an action when it handles a set of mouse button down events. Ignores all events that are not mouse button down events.
 	using ButtonDownMatchSignaler = GestureMatchSignaler<ButtonEventComparator, AnyButtonDownEventFilter>;
-}
\ No newline at end of file
+
+	/// @brief Signal class that fires an action when it handles a set of key down events, storing its gesture as a GB::CompactGesture.
+	template <typename Action = std::function<void()>, std::size_t Capacity = DEFAULT_COMPACT_GESTURE_CAPACITY>
+	using CompactKeyDownMatchSignaler = GestureMatchSignaler<KeyEventComparator, KeyDownEventFilter, Action, CompactGesture<Capacity>>;
+
+	/// @brief Signal class that fires an action when it handles a set of joystick button down events, storing its gesture as a GB::CompactGesture.
+	template <typename Action = std::function<void()>, std::size_t Capacity = DEFAULT_COMPACT_GESTURE_CAPACITY>
+	using CompactJoystickButtonDownMatchSignaler =
+		GestureMatchSignaler<JoystickButtonEventComparator, JoystickButtonDownEventFilter, Action, CompactGesture<Capacity>>;
+
+	/// @brief Signal class that fires an action when it handles a set of mouse button down events, storing its gesture as a GB::CompactGesture.
+	template <typename Action = std::function<void()>, std::size_t Capacity = DEFAULT_COMPACT_GESTURE_CAPACITY>
+	using CompactMouseButtonDownMatchSignaler =
+		GestureMatchSignaler<MouseButtonEventComparator, MouseButtonDownEventFilter, Action, CompactGesture<Capacity>>;
+
+	/// @brief Signal class that fires an action when it handles a set of button down events, storing its gesture as a GB::CompactGesture.
+	template <typename Action = std::function<void()>, std::size_t Capacity = DEFAULT_COMPACT_GESTURE_CAPACITY>
+	using CompactButtonDownMatchSignaler = GestureMatchSignaler<ButtonEventComparator, AnyButtonDownEventFilter, Action, CompactGesture<Capacity>>;
+}
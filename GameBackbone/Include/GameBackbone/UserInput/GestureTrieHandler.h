@@ -0,0 +1,464 @@
+#pragma once
+
+#include <GameBackbone/UserInput/EventComparator.h>
+#include <GameBackbone/UserInput/GestureMatchSignaler.h>
+#include <GameBackbone/UserInput/InputHandler.h>
+
+#include <SFML/Window/Event.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace GB
+{
+	/// @brief Specialized GB::InputHandler that matches incoming sf::Events against many GB::GestureMatchSignaler at once.
+	/// @details Fires the same actions and returns the same results as GB::ButtonGestureHandler, but the gestures are merged into
+	///				a prefix trie keyed by GB::EventKey. Gestures that start with the same events share nodes, so an event follows
+	///				one edge of the trie instead of being compared against every gesture. The cost of an event does not grow with
+	///				the number of gestures, which suits large tables of combos.
+	///
+	///				The stored GB::GestureMatchSignaler only describe the gestures. Their own match state is not used.
+	///				The comparator must be a keyed event comparator (see GB::is_keyed_event_comparator) and both the comparator
+	///				and the filter must be stateless, so that every gesture agrees on which events are equal.
+	/// @tparam Signaler The type of GestureMatchSignaler that will be used to match against event sequences.
+	template <
+		class Signaler,
+		std::enable_if_t<is_gesture_match_signaler_v<Signaler>, bool> = true,
+		std::enable_if_t<is_keyed_event_comparator_v<typename Signaler::EventComparatorType>, bool> = true,
+		std::enable_if_t<std::is_empty_v<typename Signaler::EventComparatorType> && std::is_empty_v<typename Signaler::EventFilterType>, bool> = true
+	>
+	class GestureTrieHandler : public InputHandler
+	{
+	public:
+		/// @brief The type of GestureMatchSignaler that inputs will be matched against.
+		using GestureMatchSignalerType = Signaler;
+	private:
+		using GestureValueContainer = std::vector<GestureMatchSignalerType>;
+	public:
+		using const_iterator = typename GestureValueContainer::const_iterator;
+		using size_type = typename GestureValueContainer::size_type;
+
+		/// @brief Default construct a GestureTrieHandler. It contains no instances of GB::GestureMatchSignaler.
+		GestureTrieHandler()
+		{
+			rebuildTrie();
+		}
+
+		/// @brief Copy construct a GestureTrieHandler.
+		/// @param other The GestureTrieHandler to copy.
+		GestureTrieHandler(const GestureTrieHandler& other) = default;
+
+		/// @brief Move construct a GestureTrieHandler.
+		/// @param other The GestureTrieHandler to move.
+		GestureTrieHandler(GestureTrieHandler&& other) = default;
+
+		/// @brief Copy Assignment.
+		/// @param other The GestureTrieHandler to copy.
+		/// @return *this
+		GestureTrieHandler& operator=(const GestureTrieHandler& other) = default;
+
+		/// @brief Move Assignment.
+		/// @param other The GestureTrieHandler to move.
+		/// @return *this
+		GestureTrieHandler& operator=(GestureTrieHandler&& other) = default;
+
+		/// @brief Destroy the GestureTrieHandler.
+		~GestureTrieHandler() override = default;
+
+		/// @brief Advance every partially matched gesture with the incoming event.
+		/// @details Behaves like GB::ButtonGestureHandler::handleEvent. If no partially matched gesture matches the event,
+		///			every gesture is reset and the event is matched again from the start of the gestures.
+		///			Actions fire in the order their GB::GestureMatchSignaler were added.
+		/// @param elapsedTime The time since the last event.
+		/// @param event The incoming event.
+		/// @return Value is true if any gesture matched the incoming event. False otherwise.
+		bool handleEvent(sf::Int64 elapsedTime, const sf::Event& event) override
+		{
+			if (m_wholeSet.empty())
+			{
+				return false;
+			}
+
+			// The comparator and filter are stateless, so any gesture's copy answers for every gesture
+			EventFilterType eventFilter = m_wholeSet.front().getEventFilter();
+			if (!std::invoke(eventFilter, event))
+			{
+				// Nothing consumes a filtered event, which resets every gesture
+				reset();
+				return false;
+			}
+			const std::optional<EventKey> eventKey = m_wholeSet.front().getEventComparator().getEventKey(event);
+
+			bool eventConsumed = applyEventToCursors(elapsedTime, eventKey);
+
+			// If the event was not consumed by any partial match see if it starts a gesture
+			if (!eventConsumed)
+			{
+				reset();
+				eventConsumed = applyEventToCursors(0, eventKey);
+			}
+			return eventConsumed;
+		}
+
+		/// @brief Adds a GB::GestureMatchSignaler to match against incoming events. Resets every gesture.
+		/// @param matchSignaler The GB::GestureMatchSignaler to add.
+		/// @return A reference to the added GB::GestureMatchSignaler.
+		/// @note The reference returned by this function is invalidated by any future calls to
+		///			addMatchSignaler or removeMatchSignaler.
+		const GestureMatchSignalerType& addMatchSignaler(GestureMatchSignalerType matchSignaler)
+		{
+			const GestureMatchSignalerType& emplacedSignaler = m_wholeSet.emplace_back(std::move(matchSignaler));
+			insertGesture(static_cast<std::uint32_t>(m_wholeSet.size() - 1));
+			reserveMatchState();
+			reset();
+			return emplacedSignaler;
+		}
+
+		/// @brief Removes the GB::GestureMatchSignaler at the provided location. Rebuilds the trie and resets every gesture.
+		/// @param position The index of the GB::GestureMatchSignaler to remove.
+		/// @throws std::out_of_range exception if the position is invalid.
+		void removeMatchSignaler(size_type position)
+		{
+			if (position >= m_wholeSet.size())
+			{
+				throw std::out_of_range("Out of bounds position in GestureTrieHandler::removeMatchSignaler");
+			}
+
+			m_wholeSet.erase(m_wholeSet.begin() + static_cast<std::ptrdiff_t>(position));
+			rebuildTrie();
+			reset();
+		}
+
+		/// @brief Gets a reference to the GB::GestureMatchSignaler at the provided location.
+		/// @param position the index of the GB::GestureMatchSignaler to return.
+		/// @return The GB::GestureMatchSignaler at the provided index.
+		/// @throws std::out_of_range exception if the position is invalid.
+		const GestureMatchSignalerType& getMatchSignaler(size_type position) const
+		{
+			return m_wholeSet.at(position);
+		}
+
+		/// @brief Get the number of GB::GestureMatchSignaler stored on this instance.
+		size_type getMatchSignalerCount() const
+		{
+			return m_wholeSet.size();
+		}
+
+		/// @brief Get the number of nodes in the trie, including the root. Gestures that start with the same events share nodes.
+		std::size_t getNodeCount() const
+		{
+			return m_nodes.size();
+		}
+
+		/// @brief Discards every partial match so that the next event is matched from the start of every gesture.
+		void reset()
+		{
+			m_cursors.clear();
+			m_cursors.push_back(Cursor{ ROOT_NODE, ALL_GESTURES, std::numeric_limits<sf::Int64>::min() });
+		}
+
+		/// @brief Gets an iterator to the first GB::GestureMatchSignaler stored on this instance.
+		/// @note all iterators are invalidated by calls to addMatchSignaler or removeMatchSignaler.
+		const_iterator begin() const
+		{
+			return m_wholeSet.begin();
+		}
+
+		/// @brief Gets an iterator to the first GB::GestureMatchSignaler stored on this instance.
+		/// @note all iterators are invalidated by calls to addMatchSignaler or removeMatchSignaler.
+		const_iterator cbegin() const
+		{
+			return m_wholeSet.cbegin();
+		}
+
+		/// @brief End iterator to the instances of GB::GestureMatchSignaler that are stored on this instance.
+		/// @note all iterators are invalidated by calls to addMatchSignaler or removeMatchSignaler.
+		const_iterator end() const
+		{
+			return m_wholeSet.end();
+		}
+
+		/// @brief End iterator to the instances of GB::GestureMatchSignaler that are stored on this instance.
+		/// @note all iterators are invalidated by calls to addMatchSignaler or removeMatchSignaler.
+		const_iterator cend() const
+		{
+			return m_wholeSet.cend();
+		}
+
+	private:
+		using EventFilterType = typename GestureMatchSignalerType::EventFilterType;
+		using MatchBehavior = typename GestureMatchSignalerType::MatchBehavior;
+
+		static constexpr std::uint32_t ROOT_NODE = 0;
+		static constexpr std::uint32_t ALL_GESTURES = std::numeric_limits<std::uint32_t>::max();
+
+		/// @brief The events shared by the start of one or more gestures.
+		struct Node
+		{
+			// The key of the edge from the parent
+			EventKey key;
+			std::uint32_t parent;
+			std::uint32_t depth;
+
+			// The most time allowed between inputs by any gesture that reaches this node
+			sf::Int64 maxTimeBetweenInputs;
+
+			// The most time allowed between inputs by any gesture that continues past this node
+			sf::Int64 continuingMaxTimeBetweenInputs;
+
+			// The gestures that end at this node, in the order they were added
+			std::vector<std::uint32_t> completedGestures;
+		};
+
+		/// @brief A partial match of one or more gestures.
+		/// @details A cursor that follows ALL_GESTURES stands for every gesture through its node that has allowed each input so far.
+		///			Gestures that restart after a match are followed by their own cursor.
+		struct Cursor
+		{
+			std::uint32_t node;
+			std::uint32_t gesture;
+
+			// The longest time between inputs matched by a cursor that follows ALL_GESTURES
+			sf::Int64 slowestInput;
+		};
+
+		/// @brief Returns the key of the edge leaving a node.
+		static std::uint64_t getEdgeId(std::uint32_t node, EventKey key)
+		{
+			return (std::uint64_t{ node } << 32) | key.pack();
+		}
+
+		/// @brief Clears the trie and inserts every gesture again.
+		void rebuildTrie()
+		{
+			m_nodes.clear();
+			m_edges.clear();
+			m_gesturePaths.clear();
+			m_nodes.push_back(Node{ EventKey{}, ROOT_NODE, 0, std::numeric_limits<sf::Int64>::min(), std::numeric_limits<sf::Int64>::min(), {} });
+
+			for (std::uint32_t gesture = 0; gesture < m_wholeSet.size(); ++gesture)
+			{
+				insertGesture(gesture);
+			}
+			reserveMatchState();
+		}
+
+		/// @brief Returns the key of an event in the gesture of a signaler.
+		static std::optional<EventKey> getGestureEventKey(const GestureMatchSignalerType& signaler, const sf::Event& gestureEvent)
+		{
+			return signaler.getEventComparator().getEventKey(gestureEvent);
+		}
+
+		/// @brief Returns the key of an event in the gesture of a signaler that stores its gesture as keys.
+		static std::optional<EventKey> getGestureEventKey(const GestureMatchSignalerType& /*signaler*/, EventKey gestureEventKey)
+		{
+			return gestureEventKey;
+		}
+
+		/// @brief Adds the path of a gesture to the trie.
+		/// @param gesture The index of the gesture in the whole set.
+		void insertGesture(std::uint32_t gesture)
+		{
+			const GestureMatchSignalerType& signaler = m_wholeSet[gesture];
+			const sf::Int64 maxTimeBetweenInputs = signaler.getMaxTimeBetweenInputs();
+
+			std::vector<std::uint32_t> path{ ROOT_NODE };
+			for (const auto& gestureEvent : signaler.getGesture())
+			{
+				const std::optional<EventKey> key = getGestureEventKey(signaler, gestureEvent);
+
+				// No input compares equal to this event, so the gesture can never get past it
+				if (!key)
+				{
+					break;
+				}
+
+				const std::uint32_t parent = path.back();
+				m_nodes[parent].continuingMaxTimeBetweenInputs = std::max(m_nodes[parent].continuingMaxTimeBetweenInputs, maxTimeBetweenInputs);
+
+				const auto [edge, isNewEdge] = m_edges.try_emplace(getEdgeId(parent, *key), static_cast<std::uint32_t>(m_nodes.size()));
+				if (isNewEdge)
+				{
+					m_nodes.push_back(Node{
+						*key,
+						parent,
+						m_nodes[parent].depth + 1,
+						std::numeric_limits<sf::Int64>::min(),
+						std::numeric_limits<sf::Int64>::min(),
+						{} });
+				}
+
+				Node& node = m_nodes[edge->second];
+				node.maxTimeBetweenInputs = std::max(node.maxTimeBetweenInputs, maxTimeBetweenInputs);
+				path.push_back(edge->second);
+			}
+
+			if (!signaler.getGesture().empty() && path.size() == signaler.getGesture().size() + 1)
+			{
+				m_nodes[path.back()].completedGestures.push_back(gesture);
+			}
+			m_gesturePaths.push_back(std::move(path));
+		}
+
+		/// @brief Reserves enough room for the match state that handling an event never allocates.
+		void reserveMatchState()
+		{
+			// There is at most one cursor that follows ALL_GESTURES and one per restarted gesture
+			m_cursors.reserve(m_wholeSet.size() + 1);
+			m_nextCursors.reserve(m_wholeSet.size() + 1);
+			m_completedGestures.reserve(m_wholeSet.size());
+		}
+
+		/// @brief Advance every cursor with the incoming event. Cursors that cannot follow the event are dropped.
+		/// @param elapsedTime The time since the last event.
+		/// @param eventKey The key of the incoming event. std::nullopt if the event matches nothing.
+		/// @return Value is true if any gesture matched the incoming event. False otherwise.
+		bool applyEventToCursors(sf::Int64 elapsedTime, const std::optional<EventKey>& eventKey)
+		{
+			m_nextCursors.clear();
+			m_completedGestures.clear();
+
+			bool eventConsumed = false;
+			if (eventKey)
+			{
+				for (const Cursor& cursor : m_cursors)
+				{
+					if (cursor.gesture == ALL_GESTURES)
+					{
+						eventConsumed |= advanceAllGestures(cursor, elapsedTime, *eventKey);
+					}
+					else
+					{
+						eventConsumed |= advanceGesture(cursor, elapsedTime, *eventKey);
+					}
+				}
+			}
+			std::swap(m_cursors, m_nextCursors);
+
+			// Fire in the order that the gestures were added, like GB::ButtonGestureHandler
+			std::sort(m_completedGestures.begin(), m_completedGestures.end());
+			for (std::uint32_t gesture : m_completedGestures)
+			{
+				std::invoke(m_wholeSet[gesture].getAction());
+			}
+			return eventConsumed;
+		}
+
+		/// @brief Advance a cursor that follows every gesture through its node.
+		/// @return Value is true if any gesture matched the incoming event. False otherwise.
+		bool advanceAllGestures(const Cursor& cursor, sf::Int64 elapsedTime, EventKey eventKey)
+		{
+			const auto edge = m_edges.find(getEdgeId(cursor.node, eventKey));
+			if (edge == m_edges.end())
+			{
+				return false;
+			}
+
+			// Gestures drop out once an input takes as long as they allow
+			const sf::Int64 slowestInput = std::max(cursor.slowestInput, elapsedTime);
+			const Node& node = m_nodes[edge->second];
+			if (node.maxTimeBetweenInputs <= slowestInput)
+			{
+				return false;
+			}
+
+			for (std::uint32_t gesture : node.completedGestures)
+			{
+				if (m_wholeSet[gesture].getMaxTimeBetweenInputs() > slowestInput)
+				{
+					completeGesture(gesture, edge->second);
+				}
+			}
+
+			if (node.continuingMaxTimeBetweenInputs > slowestInput)
+			{
+				m_nextCursors.push_back(Cursor{ edge->second, ALL_GESTURES, slowestInput });
+			}
+			return true;
+		}
+
+		/// @brief Advance a cursor that follows a single gesture.
+		/// @return Value is true if the gesture matched the incoming event. False otherwise.
+		bool advanceGesture(const Cursor& cursor, sf::Int64 elapsedTime, EventKey eventKey)
+		{
+			const GestureMatchSignalerType& signaler = m_wholeSet[cursor.gesture];
+			const std::vector<std::uint32_t>& path = m_gesturePaths[cursor.gesture];
+			const std::size_t nextDepth = std::size_t{ m_nodes[cursor.node].depth } + 1;
+
+			const std::uint32_t nextNode = path[nextDepth];
+			if (m_nodes[nextNode].key != eventKey || elapsedTime >= signaler.getMaxTimeBetweenInputs())
+			{
+				return false;
+			}
+
+			if (nextDepth == signaler.getGesture().size())
+			{
+				completeGesture(cursor.gesture, nextNode);
+			}
+			else
+			{
+				m_nextCursors.push_back(Cursor{ nextNode, cursor.gesture, 0 });
+			}
+			return true;
+		}
+
+		/// @brief Queues the action of a completed gesture and sets up its next match according to its MatchBehavior.
+		/// @param gesture The index of the gesture in the whole set.
+		/// @param node The node the gesture ends at.
+		void completeGesture(std::uint32_t gesture, std::uint32_t node)
+		{
+			m_completedGestures.push_back(gesture);
+			switch (m_wholeSet[gesture].getMatchBehavior())
+			{
+			case MatchBehavior::Penultimate:
+			{
+				m_nextCursors.push_back(Cursor{ m_nodes[node].parent, gesture, 0 });
+				break;
+			}
+			case MatchBehavior::Reset:
+			{
+				m_nextCursors.push_back(Cursor{ ROOT_NODE, gesture, 0 });
+				break;
+			}
+			case MatchBehavior::Block:
+			{
+				break;
+			}
+			}
+		}
+
+		GestureValueContainer m_wholeSet;
+
+		// The trie. Node 0 is the root.
+		std::vector<Node> m_nodes;
+		std::unordered_map<std::uint64_t, std::uint32_t> m_edges;
+		// The nodes each gesture passes through, starting at the root
+		std::vector<std::vector<std::uint32_t>> m_gesturePaths;
+
+		// Match state
+		std::vector<Cursor> m_cursors;
+		std::vector<Cursor> m_nextCursors;
+		std::vector<std::uint32_t> m_completedGestures;
+	};
+
+	/// @brief GB::GestureTrieHandler that handles sequences of key down inputs.
+	using KeyboardGestureTrieHandler = GestureTrieHandler<KeyDownMatchSignaler>;
+
+	/// @brief GB::GestureTrieHandler that handles sequences of joystick button down inputs.
+	using JoystickButtonGestureTrieHandler = GestureTrieHandler<JoystickButtonDownMatchSignaler>;
+
+	/// @brief GB::GestureTrieHandler that handles sequences of mouse button down inputs.
+	using MouseButtonGestureTrieHandler = GestureTrieHandler<MouseButtonDownMatchSignaler>;
+
+	/// @brief GB::GestureTrieHandler that handles sequences of button down inputs.
+	using AnyButtonGestureTrieHandler = GestureTrieHandler<ButtonDownMatchSignaler>;
+}
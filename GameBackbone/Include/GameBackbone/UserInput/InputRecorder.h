@@ -64,23 +64,29 @@ namespace GB
 		}
 
 		/// @brief Construct a ReturnGestureMatchSignaler to match the recorded Events.
+		/// @tparam Action The type of the action of the returned GB::GestureMatchSignaler. It is never deduced, so passing a lambda
+		///			still returns a ReturnGestureMatchSignaler. Name a type, such as a function pointer, to store the action without std::function.
+		/// @tparam Gesture The type that stores the gesture of the returned GB::GestureMatchSignaler. Name a GB::CompactGesture to
+		///			convert the recorded events to keys with the recorder's comparator, which must then be a keyed event comparator.
 		/// @param action The action that will be attached to the GB::GestureBindSignaler.
 		/// @param matchBehavior The behavior of the resulting GB::GestureMatchSignaler after a successful match.
 		/// @param maxTimeBetweenInputs The Maximum time in between inputs on the GB::GestureBindSignaler.
 		/// @param shouldClear If true, clears the recorded events after construction of the GB::GestureBindSignaler. 
-		/// @return The constructed ReturnGestureMatchSignaler.
+		/// @return The constructed GB::GestureMatchSignaler.
+		/// @throws std::length_error if Gesture is a GB::CompactGesture and more events were recorded than it can hold.
+		template <class Action = typename ReturnGestureMatchSignaler::ActionType, class Gesture = typename ReturnGestureMatchSignaler::GestureType>
 		[[nodiscard]]
-		ReturnGestureMatchSignaler getCompletedBind(
-			std::function<void()> action, 
+		GestureMatchSignaler<EventComparator, EventFilter, Action, Gesture> getCompletedBind(
+			std::common_type_t<Action> action,
 			typename ReturnGestureMatchSignaler::MatchBehavior matchBehavior = ReturnGestureMatchSignaler::MatchBehavior::Block,
 			sf::Int64 maxTimeBetweenInputs = 1000000,
 			bool shouldClear = true)
 		{
 			// Construct an ReturnGestureMatchSignaler with the current recorded events and the given action, matchBehavior, and maxTimeBetweenInputs.
 			// m_eventComparator and m_eventFilter are copied and passed into the ReturnGestureMatchSignaler
-			ReturnGestureMatchSignaler returnsignaler{
-				m_bindKeys,
-				action,
+			GestureMatchSignaler<EventComparator, EventFilter, Action, Gesture> returnsignaler{
+				makeGesture<Gesture>(),
+				std::move(action),
 				matchBehavior,
 				maxTimeBetweenInputs,
 				m_eventComparator,
@@ -132,6 +138,20 @@ namespace GB
 		}
 
 	private:
+		/// @brief Copies the recorded events into the gesture type of a GestureMatchSignaler.
+		template <class Gesture>
+		Gesture makeGesture() const
+		{
+			if constexpr (Detail::is_event_key_gesture_v<Gesture>)
+			{
+				return Gesture(m_bindKeys, m_eventComparator);
+			}
+			else
+			{
+				return m_bindKeys;
+			}
+		}
+
 		EventComparatorType m_eventComparator;
 		EventFilterType m_eventFilter;
 
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <GameBackbone/Core/Updatable.h>
+#include <GameBackbone/UserInput/EventFilter.h>
 #include <GameBackbone/UserInput/InputHandler.h>
 
 #include <SFML/Window/Event.hpp>
 
+#include <array>
 #include <vector>
 #include <tuple>
 #include <functional>
@@ -48,9 +50,95 @@ namespace GB
 		/// <summary> Checks if all types fulfill the requirements of a CompoundSprite component. (Drawable and Transformable) </summary>
 		template <class... InTypes>
 		inline constexpr bool are_all_input_handlers_v = (std::is_base_of_v<InputHandler, InTypes> && ...);
+
+		template <class T, class = void>
+		struct handled_event_types : std::integral_constant<EventTypeSet, ALL_EVENT_TYPES> {};
+
+		template <class T>
+		struct handled_event_types<T, std::void_t<decltype(T::handledEventTypes)>> : std::integral_constant<EventTypeSet, T::handledEventTypes> {};
 	}
+
+	/// @brief The EventTypeSet of events that a GB::InputRouter offers to an InputHandler.
+	///		An InputHandler declares it with a static constexpr EventTypeSet member named handledEventTypes. It is ALL_EVENT_TYPES for
+	///		handlers that do not declare one.
+	/// @tparam Handler The InputHandler.
+	template <class Handler>
+	inline constexpr EventTypeSet handled_event_types_v = Detail::handled_event_types<Handler>::value;
+
+	/// @brief Wraps a GB::InputHandler so that it only handles the events that pass an EventFilter.
+	/// @details Declares the event types of the filter as its handledEventTypes, so a GB::InputRouter never offers it any other type
+	///		of event. This lets a GB::ButtonGestureHandler for key presses ignore mouse movement entirely, instead of treating it as
+	///		an event that breaks the gesture in progress.
+	/// @tparam EventFilter The filter for the events to handle. See GB::event_filter_event_types_v.
+	/// @tparam Handler The wrapped GB::InputHandler.
+	template <
+		class EventFilter,
+		class Handler,
+		std::enable_if_t<is_event_filter_v<EventFilter>, bool> = true,
+		std::enable_if_t<Detail::are_all_input_handlers_v<Handler>, bool> = true
+	>
+	class FilteredInputHandler final : public InputHandler
+	{
+	public:
+		static constexpr EventTypeSet handledEventTypes = event_filter_event_types_v<EventFilter> & handled_event_types_v<Handler>;
+
+		/// @brief Construct an instance of FilteredInputHandler that wraps the provided GB::InputHandler.
+		/// @param handler The GB::InputHandler that handles the events that pass the filter.
+		/// @param eventFilter The filter for the events to handle.
+		FilteredInputHandler(Handler handler, EventFilter eventFilter) :
+			m_handler(std::move(handler)),
+			m_eventFilter(std::move(eventFilter)),
+			m_filteredTime(0)
+		{
+		}
+
+		/// @brief Construct an instance of FilteredInputHandler that wraps the provided GB::InputHandler. Default constructs the EventFilter.
+		/// @param handler The GB::InputHandler that handles the events that pass the filter.
+		template <typename = std::enable_if_t< std::is_default_constructible_v<EventFilter> >>
+		explicit FilteredInputHandler(Handler handler) : FilteredInputHandler(std::move(handler), EventFilter{})
+		{
+		}
+
+		/// @brief Forwards the event to the wrapped GB::InputHandler if it passes the filter.
+		///		The elapsed time of filtered events is added to the elapsed time of the next event that is forwarded.
+		/// @param elapsedTime The time since the last event was handled.
+		/// @param event The event to handle.
+		/// @return Returns true if the wrapped GB::InputHandler handled the event.
+		bool handleEvent(sf::Int64 elapsedTime, const sf::Event& event) final
+		{
+			m_filteredTime += elapsedTime;
+			if (!std::invoke(m_eventFilter, event))
+			{
+				return false;
+			}
+
+			const sf::Int64 handlerElapsedTime = m_filteredTime;
+			m_filteredTime = 0;
+			return m_handler.handleEvent(handlerElapsedTime, event);
+		}
+
+		/// @brief Returns the wrapped GB::InputHandler.
+		Handler& getHandler()
+		{
+			return m_handler;
+		}
+
+		/// @brief Returns the wrapped GB::InputHandler.
+		const Handler& getHandler() const
+		{
+			return m_handler;
+		}
+
+	private:
+		Handler m_handler;
+		EventFilter m_eventFilter;
+		sf::Int64 m_filteredTime;
+	};
 	
 	/// @brief Stores several GB::InputHandler instances and forwards handleEvent calls to each of them in order. Once the event is successfully handled, no other GB::InputHandler may handle the event.
+	/// @details Each event is only offered to the handlers whose handled_event_types_v holds its type. The handlers for each
+	///		type are found at compile time, so an event costs one table lookup plus the handlers that take its type, and a flood of
+	///		mouse movement never reaches handlers that declare they only take key events.
 	/// @tparam ...Handlers A variadic list of GB::InputHandler that will receive the forwarded handleEvent calls. 
 	///						The priority of the Handlers is defined by the order that they were passed in. Earlier Handlers have higher priority.
 	template <class... Handlers>
@@ -67,11 +155,12 @@ namespace GB
 				std::make_tuple( 
 					std::make_pair(sf::Int64{ 0 }, std::move(inputHandlers))... 
 				) 
-			)
+			),
+			m_currentTime(0)
 		{
 		}
 
-		/// @brief Handles an event by forwarding the handleEvemt call to all stored GB::InputHandler instances. 
+		/// @brief Handles an event by forwarding the handleEvemt call to the stored GB::InputHandler instances that take its type.
 		///			Once the event is handled, no other GB::InputHandler may handle the event.
 		///			The elapsed time sent to each invoked GB::InputHandler is the time since that specific
 		///			handler was last called.
@@ -80,30 +169,61 @@ namespace GB
 		/// @return Returns true if any GB::InputHandler handled the event.
 		bool handleEvent(sf::Int64 elapsedTime, const sf::Event& event) final
 		{
-			bool eventHandled = false;
-
-			// Loop through all sub-handlers until handles the event
-			Detail::forEach(
-				m_handlers,
-				[&event, &eventHandled, elapsedTime](auto& handlerPair)
-				{
-					handlerPair.first += elapsedTime;
-
-					// Only attempt to handle an event that has not been handled yet
-					if (!eventHandled)
-					{
-						if (handlerPair.second.handleEvent(handlerPair.first, event))
-						{
-							eventHandled = true;
-						}
-						handlerPair.first = 0;
-					}
-				}
-			);
-			return eventHandled;
+			// The dispatch function for each event type. Types past sf::Event::Count share the last entry.
+			static constexpr std::array<DispatchFunction, EVENT_TYPE_COUNT + 1> dispatchTable =
+				makeDispatchTable(std::make_index_sequence<EVENT_TYPE_COUNT + 1>{});
+
+			m_currentTime += elapsedTime;
+			const std::size_t eventType = std::min(static_cast<std::size_t>(event.type), EVENT_TYPE_COUNT);
+			return (this->*dispatchTable[eventType])(event);
 		}
 
 	private:
+		using DispatchFunction = bool (InputRouter::*)(const sf::Event&);
+
+		static constexpr std::size_t EVENT_TYPE_COUNT = sf::Event::Count;
+
+		template <std::size_t... EventTypes>
+		static constexpr std::array<DispatchFunction, sizeof...(EventTypes)> makeDispatchTable(std::index_sequence<EventTypes...>)
+		{
+			return { &InputRouter::dispatchEventType<EventTypes>... };
+		}
+
+		/// @brief Offers an event of the type to each handler that takes it, in order, until one handles it.
+		template <std::size_t EventType>
+		bool dispatchEventType(const sf::Event& event)
+		{
+			return offerEventToHandlers<EventType>(event, std::index_sequence_for<Handlers...>{});
+		}
+
+		template <std::size_t EventType, std::size_t... HandlerIndices>
+		bool offerEventToHandlers(const sf::Event& event, std::index_sequence<HandlerIndices...>)
+		{
+			// || stops offering the event after the first handler that handles it
+			return (offerEventToHandler<EventType, HandlerIndices>(event) || ...);
+		}
+
+		/// @brief Forwards the event to the handler if it takes the event type. Compiles to nothing if it does not.
+		template <std::size_t EventType, std::size_t HandlerIndex>
+		bool offerEventToHandler(const sf::Event& event)
+		{
+			using Handler = std::tuple_element_t<HandlerIndex, std::tuple<Handlers...>>;
+			if constexpr (((handled_event_types_v<Handler> >> EventType) & 1) != 0)
+			{
+				// Each handler remembers when it was last called, so handlers that are skipped need no bookkeeping
+				auto& [lastCallTime, handler] = std::get<HandlerIndex>(m_handlers);
+				const sf::Int64 handlerElapsedTime = m_currentTime - lastCallTime;
+				lastCallTime = m_currentTime;
+				return handler.handleEvent(handlerElapsedTime, event);
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// Each handler and the value of m_currentTime when it was last called
 		std::tuple<std::pair<sf::Int64, Handlers>...> m_handlers;
+		sf::Int64 m_currentTime;
 	};
 }
\ No newline at end of file
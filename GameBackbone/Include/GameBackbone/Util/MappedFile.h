@@ -0,0 +1,44 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <cstddef>
+#include <string>
+
+namespace GB {
+
+	/// @brief Maps a file into memory read only.
+	///		The contents are paged in by the operating system as they are read, so nothing is copied up front.
+	class libGameBackbone MappedFile {
+	public:
+		/// @brief Construct a MappedFile that maps nothing.
+		MappedFile() noexcept = default;
+
+		/// @brief Maps the whole file at path into memory.
+		/// @param path The path of the file.
+		/// @throws std::runtime_error if the file could not be opened or mapped.
+		explicit MappedFile(const std::string& path);
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/// @brief Unmaps the file.
+		~MappedFile();
+
+		/// @brief Returns the first byte of the file. nullptr if nothing is mapped or the file is empty.
+		[[nodiscard]]
+		const char* getData() const noexcept;
+
+		/// @brief Returns the size of the file in bytes.
+		[[nodiscard]]
+		std::size_t getSize() const noexcept;
+
+	private:
+		void unmap() noexcept;
+
+		const char* m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+}
@@ -3,10 +3,52 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 using namespace GB;
 
+std::uint64_t GB::consumeAnimationTime(sf::Int64& timeSinceLastFrame, sf::Int64 delay, bool isFrameSkipping) {
+	// A delay of zero would make every frame due at once. Treat it like frame skipping is disabled.
+	if (!isFrameSkipping || delay <= 0) {
+		timeSinceLastFrame = 0;
+		return 1;
+	}
+
+	// A frame is due every time more than delay has built up. What is left over is at most delay.
+	const sf::Int64 frameCount = (timeSinceLastFrame - 1) / delay;
+	timeSinceLastFrame -= frameCount * delay;
+	return static_cast<std::uint64_t>(frameCount);
+}
+
+unsigned int GB::advanceAnimationFrame(unsigned int currentFrame, std::size_t animationSize, ANIMATION_END_TYPE endType, std::uint64_t frameCount, bool& isReverse) {
+	// Only change the frame if the animation has more than one frame
+	if (animationSize <= 1) {
+		return currentFrame;
+	}
+
+	const std::uint64_t lastFrame = animationSize - 1;
+	switch (endType) {
+	case ANIMATION_END_TYPE::ANIMATION_LOOP:
+		return static_cast<unsigned int>((currentFrame + frameCount) % animationSize);
+	case ANIMATION_END_TYPE::ANIMATION_REVERSE: {
+		// Unfold the back and forth into one cycle of 2 * lastFrame positions. Moving backward from a frame
+		// is the same as being that many positions before the end of the cycle.
+		const std::uint64_t cycleLength = 2 * lastFrame;
+		std::uint64_t position = isReverse ? cycleLength - (currentFrame % cycleLength) : currentFrame % cycleLength;
+		position = (position + frameCount) % cycleLength;
+		isReverse = position > lastFrame;
+		return static_cast<unsigned int>(isReverse ? cycleLength - position : position);
+	}
+	case ANIMATION_END_TYPE::ANIMATION_STOP:
+		if (currentFrame >= lastFrame) {
+			return currentFrame;
+		}
+		return static_cast<unsigned int>(std::min(currentFrame + frameCount, lastFrame));
+	}
+	return currentFrame;
+}
+
 //ctr and dtr
 
 AnimatedSprite::AnimatedSprite() : AnimatedSprite(sf::Texture{}) {
@@ -16,17 +58,18 @@ AnimatedSprite::AnimatedSprite(const sf::Texture & texture) :
 	AnimatedSprite(texture, nullptr) {
 }
 
-AnimatedSprite::AnimatedSprite(const sf::Texture & texture, AnimationSet::Ptr animations) : 
+AnimatedSprite::AnimatedSprite(const sf::Texture & texture, AnimationSet::ConstPtr animations) : 
 	sf::Sprite(texture),
 	animating(false),
 	isReverse(false),
+	frameSkippingEnabled(false),
 	animationEnd(ANIMATION_END_TYPE::ANIMATION_LOOP),
 	animationDelay(sf::Time::Zero),
 	timeSinceLastUpdate(sf::Time::Zero),
 	currentFrame(0),
 	framesSpentInCurrentAnimation(0),
 	currentAnimationId(0),
-	currentAnimation(nullptr),
+	currentAnimation(),
 	animations(nullptr)
 {
 	setAnimations(std::move(animations));
@@ -37,14 +80,20 @@ void AnimatedSprite::setAnimating(bool animating) {
 }
 
 void AnimatedSprite::setCurrentFrame(unsigned int frame) {
-	if (!currentAnimation) {
+	if (currentAnimation.empty()) {
 		throw std::runtime_error("Cannot set the frame of an animation without an active animation (calling runAnimation).");
 	}
+	// Throws if the frame does not exist
+	static_cast<void>(currentAnimation.at(frame));
+	showFrame(frame);
+}
+
+void AnimatedSprite::showFrame(unsigned int frame) {
 	currentFrame = frame;
-	setTextureRect(currentAnimation->at(currentFrame));
+	setTextureRect(currentAnimation[frame]);
 }
 
-void AnimatedSprite::setAnimations(AnimationSet::Ptr animations) {
+void AnimatedSprite::setAnimations(AnimationSet::ConstPtr animations) {
 	if (animations) {
 		this->animations = std::move(animations);
 		// Initialize sprite to first frame of first animation
@@ -56,12 +105,20 @@ void AnimatedSprite::setAnimationDelay(sf::Time delay) {
 	animationDelay = delay;
 }
 
+void AnimatedSprite::setFrameSkippingEnabled(bool frameSkipping) {
+	frameSkippingEnabled = frameSkipping;
+}
+
+bool AnimatedSprite::isFrameSkippingEnabled() const {
+	return frameSkippingEnabled;
+}
+
 unsigned int AnimatedSprite::getCurrentFrame() const {
 	return currentFrame;
 }
 
-const Animation* AnimatedSprite::getCurrentAnimation() const {
-	return currentAnimation;
+const AnimationView* AnimatedSprite::getCurrentAnimation() const {
+	return currentAnimation.empty() ? nullptr : &currentAnimation;
 }
 
 std::size_t AnimatedSprite::getCurrentAnimationId() const {
@@ -95,12 +152,13 @@ void AnimatedSprite::setCurrentAnimation(unsigned int animationId) {
 
 void AnimatedSprite::setCurrentAnimation(unsigned int animationId, ANIMATION_END_TYPE endStyle) {
 	// Empty animations cannot be run. What frame would be displayed?
-	if (animations->at(animationId).empty()) {
+	const AnimationView animation = animations->at(animationId);
+	if (animation.empty()) {
 		throw std::out_of_range("The requested Animation does not exist.");
 	}
 	this->animationEnd = endStyle;
 	this->currentAnimationId = animationId;
-	this->currentAnimation = &animations->at(animationId);
+	this->currentAnimation = animation;
 	this->currentFrame = 0;
 	this->framesSpentInCurrentAnimation = 0;
 }
@@ -108,33 +166,16 @@ void AnimatedSprite::setCurrentAnimation(unsigned int animationId, ANIMATION_END
 void AnimatedSprite::update(sf::Int64 elapsedTime) {
 	timeSinceLastUpdate = timeSinceLastUpdate + sf::microseconds(elapsedTime);
 	if (animating && (timeSinceLastUpdate.asMicroseconds() > animationDelay.asMicroseconds())) {
-		timeSinceLastUpdate = sf::Time::Zero;
-		switch (animationEnd) {
-		case ANIMATION_END_TYPE::ANIMATION_LOOP:
-			setCurrentFrame((currentFrame + 1ULL) % currentAnimation->size());
-			break;
-		case ANIMATION_END_TYPE::ANIMATION_REVERSE:
-			// Only change the frame if the animation has more than one frame
-			if (currentAnimation->size() > 1) {
-				if (currentFrame >= currentAnimation->size() - 1 || (currentFrame == 0 && isReverse)) {
-					isReverse = !isReverse;
-				}
-
-				if (!isReverse) {
-					setCurrentFrame(currentFrame + 1);
-				}
-				else {
-					setCurrentFrame(currentFrame - 1);
-				}
-			}
-			break;
-		case ANIMATION_END_TYPE::ANIMATION_STOP:
-			if (currentFrame < currentAnimation->size() - 1) {
-				setCurrentFrame(currentFrame + 1);
-			}
-			break;
+		sf::Int64 leftoverTime = timeSinceLastUpdate.asMicroseconds();
+		const std::uint64_t frameCount = consumeAnimationTime(leftoverTime, animationDelay.asMicroseconds(), frameSkippingEnabled);
+		timeSinceLastUpdate = sf::microseconds(leftoverTime);
+
+		// advanceAnimationFrame only returns frames of the animation, so the frame does not need to be checked
+		const unsigned int nextFrame = advanceAnimationFrame(currentFrame, currentAnimation.size(), animationEnd, frameCount, isReverse);
+		if (nextFrame != currentFrame) {
+			showFrame(nextFrame);
 		}
 
-		framesSpentInCurrentAnimation++;
+		framesSpentInCurrentAnimation += static_cast<unsigned int>(frameCount);
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,500 @@
+#include <GameBackbone/Core/AnimationAsset.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+using namespace GB;
+
+// Frames are read from the file as sf::IntRect without being converted
+static_assert(std::is_standard_layout_v<sf::IntRect> && sizeof(sf::IntRect) == 4 * sizeof(std::int32_t),
+	"sf::IntRect must be laid out as four 32 bit integers to be read in place.");
+static_assert(offsetof(sf::IntRect, left) == 0 && offsetof(sf::IntRect, top) == 4 &&
+	offsetof(sf::IntRect, width) == 8 && offsetof(sf::IntRect, height) == 12,
+	"sf::IntRect must be laid out as (left, top, width, height) to be read in place.");
+
+namespace
+{
+	constexpr char ASSET_MAGIC[4] = { 'G', 'B', 'A', 'N' };
+	constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+	/// @brief Returns size rounded up to a multiple of 4.
+	constexpr std::uint64_t padToFourBytes(std::uint64_t size)
+	{
+		return (size + 3) & ~std::uint64_t{ 3 };
+	}
+
+	/// @brief Returns value as a 32 bit count. Throws if it does not fit in the format.
+	std::uint32_t toFileCount(std::size_t value)
+	{
+		if (value > std::numeric_limits<std::uint32_t>::max())
+		{
+			throw std::length_error("The animation asset is too large for the binary format.");
+		}
+		return static_cast<std::uint32_t>(value);
+	}
+
+	/// @brief Writes the bytes of a trivially copyable value.
+	template <class T>
+	void writeValue(std::ostream& output, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	/// @brief Throws a std::runtime_error naming the line of the text asset.
+	[[noreturn]] void throwTextError(std::size_t lineNumber, const std::string& message)
+	{
+		throw std::runtime_error("Line " + std::to_string(lineNumber) + " of the animation asset: " + message);
+	}
+
+	/// @brief Throws if anything is left on the line.
+	void expectEndOfLine(std::istringstream& line, std::size_t lineNumber, const std::string& keyword)
+	{
+		std::string extra;
+		if (line >> extra)
+		{
+			throwTextError(lineNumber, "unexpected " + extra + " after " + keyword + ".");
+		}
+	}
+
+	/// @brief Reads count integers from the line. Throws if there are not exactly count integers.
+	template <std::size_t count>
+	void readIntegers(std::istringstream& line, std::size_t lineNumber, const std::string& keyword, int (&values)[count])
+	{
+		for (int& value : values)
+		{
+			if (!(line >> value))
+			{
+				throwTextError(lineNumber, keyword + " expects " + std::to_string(count) + " integers.");
+			}
+		}
+		expectEndOfLine(line, lineNumber, keyword);
+	}
+}
+
+AnimationAsset::AnimationAsset(AnimationAsset&& other) noexcept :
+	m_file(std::move(other.m_file)),
+	m_buffer(std::move(other.m_buffer)),
+	m_header(std::exchange(other.m_header, nullptr)),
+	m_ranges(std::exchange(other.m_ranges, nullptr)),
+	m_frames(std::exchange(other.m_frames, nullptr)),
+	m_regions(std::exchange(other.m_regions, nullptr)),
+	m_strings(std::exchange(other.m_strings, nullptr))
+{
+}
+
+AnimationAsset& AnimationAsset::operator=(AnimationAsset&& other) noexcept
+{
+	if (this != &other)
+	{
+		m_file = std::move(other.m_file);
+		m_buffer = std::move(other.m_buffer);
+		m_header = std::exchange(other.m_header, nullptr);
+		m_ranges = std::exchange(other.m_ranges, nullptr);
+		m_frames = std::exchange(other.m_frames, nullptr);
+		m_regions = std::exchange(other.m_regions, nullptr);
+		m_strings = std::exchange(other.m_strings, nullptr);
+	}
+	return *this;
+}
+
+AnimationAsset AnimationAsset::loadFromFile(const std::string& path)
+{
+	AnimationAsset asset;
+	asset.m_file = MappedFile(path);
+	asset.bind(asset.m_file.getData(), asset.m_file.getSize());
+	return asset;
+}
+
+AnimationAsset AnimationAsset::loadFromMemory(std::vector<char> data)
+{
+	AnimationAsset asset;
+	asset.m_buffer = std::move(data);
+	asset.bind(asset.m_buffer.data(), asset.m_buffer.size());
+	return asset;
+}
+
+void AnimationAsset::bind(const char* data, std::size_t size)
+{
+	if (size < sizeof(FileHeader) || std::memcmp(data, ASSET_MAGIC, sizeof(ASSET_MAGIC)) != 0)
+	{
+		throw std::runtime_error("The data is not an animation asset.");
+	}
+	// Every section is read in place, so the data must be aligned like its fields
+	if (reinterpret_cast<std::uintptr_t>(data) % alignof(FileHeader) != 0)
+	{
+		throw std::runtime_error("The animation asset is not aligned to 4 bytes.");
+	}
+
+	const auto* header = reinterpret_cast<const FileHeader*>(data);
+	if (header->byteOrder != BYTE_ORDER_MARK)
+	{
+		throw std::runtime_error("The animation asset was written with a different byte order.");
+	}
+	if (header->version == 0 || header->version > FormatVersion)
+	{
+		throw std::runtime_error("The animation asset version " + std::to_string(header->version) + " is not supported.");
+	}
+
+	// Sizes are computed in 64 bits so that a corrupt header cannot overflow them
+	const std::uint64_t rangesOffset = sizeof(FileHeader);
+	const std::uint64_t framesOffset = rangesOffset + std::uint64_t{ header->animationCount } * sizeof(AnimationRange);
+	const std::uint64_t regionsOffset = framesOffset + std::uint64_t{ header->frameCount } * sizeof(sf::IntRect);
+	const std::uint64_t stringsOffset = regionsOffset + std::uint64_t{ header->regionCount } * sizeof(RegionRecord);
+	const std::uint64_t totalSize = stringsOffset + padToFourBytes(header->stringSize);
+	if (totalSize != size)
+	{
+		throw std::runtime_error("The animation asset is " + std::to_string(size) + " bytes but its header describes " +
+			std::to_string(totalSize) + " bytes.");
+	}
+
+	const auto* ranges = reinterpret_cast<const AnimationRange*>(data + rangesOffset);
+	for (std::uint32_t ii = 0; ii < header->animationCount; ++ii)
+	{
+		if (std::uint64_t{ ranges[ii].offset } + ranges[ii].size > header->frameCount)
+		{
+			throw std::runtime_error("Animation " + std::to_string(ii) + " of the animation asset is out of bounds.");
+		}
+	}
+	const auto* regions = reinterpret_cast<const RegionRecord*>(data + regionsOffset);
+	const auto getName = [data, stringsOffset](const RegionRecord& region) {
+		return std::string_view(data + stringsOffset + region.nameOffset, region.nameSize);
+	};
+	for (std::uint32_t ii = 0; ii < header->regionCount; ++ii)
+	{
+		if (std::uint64_t{ regions[ii].nameOffset } + regions[ii].nameSize > header->stringSize)
+		{
+			throw std::runtime_error("Region " + std::to_string(ii) + " of the animation asset is out of bounds.");
+		}
+		// Regions are found by binary search on their names
+		if (ii > 0 && !(getName(regions[ii - 1]) < getName(regions[ii])))
+		{
+			throw std::runtime_error("Region " + std::to_string(ii) + " of the animation asset is not sorted by name.");
+		}
+	}
+
+	m_header = header;
+	m_ranges = ranges;
+	m_frames = reinterpret_cast<const sf::IntRect*>(data + framesOffset);
+	m_regions = regions;
+	m_strings = data + stringsOffset;
+}
+
+std::size_t AnimationAsset::getAnimationCount() const noexcept
+{
+	return m_header == nullptr ? 0 : m_header->animationCount;
+}
+
+std::size_t AnimationAsset::getFrameCount() const noexcept
+{
+	return m_header == nullptr ? 0 : m_header->frameCount;
+}
+
+AnimationView AnimationAsset::at(std::size_t animationIndex) const
+{
+	if (animationIndex >= getAnimationCount())
+	{
+		throw std::out_of_range("The animation asset has no animation " + std::to_string(animationIndex) + ".");
+	}
+	return (*this)[animationIndex];
+}
+
+std::size_t AnimationAsset::getRegionCount() const noexcept
+{
+	return m_header == nullptr ? 0 : m_header->regionCount;
+}
+
+std::string_view AnimationAsset::getRegionName(const RegionRecord& region) const noexcept
+{
+	return std::string_view(m_strings + region.nameOffset, region.nameSize);
+}
+
+AnimationAsset::Region AnimationAsset::getRegion(std::size_t regionIndex) const
+{
+	if (regionIndex >= getRegionCount())
+	{
+		throw std::out_of_range("The animation asset has no region " + std::to_string(regionIndex) + ".");
+	}
+	const RegionRecord& region = m_regions[regionIndex];
+	return Region{
+		getRegionName(region),
+		region.page,
+		sf::IntRect(region.left, region.top, region.width, region.height)
+	};
+}
+
+AnimationAsset::Region AnimationAsset::getRegion(std::string_view name) const
+{
+	const RegionRecord* regionsEnd = m_regions + getRegionCount();
+	const RegionRecord* region = std::lower_bound(m_regions, regionsEnd, name,
+		[this](const RegionRecord& record, std::string_view value) { return getRegionName(record) < value; });
+	if (region == regionsEnd || getRegionName(*region) != name)
+	{
+		throw std::out_of_range("The animation asset has no region named " + std::string(name) + ".");
+	}
+	return getRegion(static_cast<std::size_t>(region - m_regions));
+}
+
+bool AnimationAsset::containsRegion(std::string_view name) const
+{
+	const RegionRecord* regionsEnd = m_regions + getRegionCount();
+	const RegionRecord* region = std::lower_bound(m_regions, regionsEnd, name,
+		[this](const RegionRecord& record, std::string_view value) { return getRegionName(record) < value; });
+	return region != regionsEnd && getRegionName(*region) == name;
+}
+
+AnimationSet::Ptr AnimationAsset::makeAnimationSet() const
+{
+	auto animations = std::make_shared<AnimationSet>();
+	animations->reserve(getAnimationCount(), getFrameCount());
+	for (std::size_t ii = 0; ii < getAnimationCount(); ++ii)
+	{
+		const AnimationView animation = (*this)[ii];
+		animations->addAnimation(animation.begin(), animation.end());
+	}
+	return animations;
+}
+
+AnimationAssetBuilder::AnimationAssetBuilder(const AnimationAsset& asset)
+{
+	m_animations.reserve(asset.getAnimationCount(), asset.getFrameCount());
+	for (std::size_t ii = 0; ii < asset.getAnimationCount(); ++ii)
+	{
+		const AnimationView animation = asset[ii];
+		m_animations.addAnimation(animation.begin(), animation.end());
+	}
+
+	// The asset's regions are already sorted
+	m_regions.reserve(asset.getRegionCount());
+	for (std::size_t ii = 0; ii < asset.getRegionCount(); ++ii)
+	{
+		const AnimationAsset::Region region = asset.getRegion(ii);
+		m_regions.push_back(RegionEntry{ std::string(region.name), region.page, region.bounds });
+	}
+}
+
+AnimationAssetBuilder AnimationAssetBuilder::readText(std::istream& input)
+{
+	AnimationAssetBuilder builder;
+	Animation animation;
+	bool hasAnimation = false;
+	sf::Vector2i frameSize(0, 0);
+
+	std::string text;
+	std::size_t lineNumber = 0;
+	while (std::getline(input, text))
+	{
+		++lineNumber;
+		text = text.substr(0, text.find('#'));
+		std::istringstream line(text);
+		std::string keyword;
+		if (!(line >> keyword))
+		{
+			continue;
+		}
+
+		if (keyword == "version")
+		{
+			int version[1];
+			readIntegers(line, lineNumber, "version", version);
+			if (version[0] <= 0 || static_cast<std::uint32_t>(version[0]) > AnimationAsset::FormatVersion)
+			{
+				throwTextError(lineNumber, "version " + std::to_string(version[0]) + " is not supported.");
+			}
+		}
+		else if (keyword == "frameSize")
+		{
+			int size[2];
+			readIntegers(line, lineNumber, "frameSize", size);
+			frameSize = sf::Vector2i(size[0], size[1]);
+		}
+		else if (keyword == "animation")
+		{
+			expectEndOfLine(line, lineNumber, keyword);
+			if (hasAnimation)
+			{
+				builder.addAnimation(animation);
+			}
+			animation.clear();
+			hasAnimation = true;
+		}
+		else if (keyword == "frame" || keyword == "cell")
+		{
+			if (!hasAnimation)
+			{
+				throwTextError(lineNumber, keyword + " must follow animation.");
+			}
+			if (keyword == "frame")
+			{
+				int frame[4];
+				readIntegers(line, lineNumber, "frame", frame);
+				animation.emplace_back(frame[0], frame[1], frame[2], frame[3]);
+			}
+			else
+			{
+				if (frameSize.x <= 0 || frameSize.y <= 0)
+				{
+					throwTextError(lineNumber, "cell needs a positive frameSize.");
+				}
+				int cell[2];
+				readIntegers(line, lineNumber, "cell", cell);
+				animation.emplace_back(cell[0] * frameSize.x, cell[1] * frameSize.y, frameSize.x, frameSize.y);
+			}
+		}
+		else if (keyword == "region")
+		{
+			std::string name;
+			int bounds[5];
+			if (!(line >> name))
+			{
+				throwTextError(lineNumber, "region expects a name.");
+			}
+			readIntegers(line, lineNumber, "region", bounds);
+			if (bounds[0] < 0)
+			{
+				throwTextError(lineNumber, "region page cannot be negative.");
+			}
+			try
+			{
+				builder.addRegion(std::move(name), static_cast<std::size_t>(bounds[0]), sf::IntRect(bounds[1], bounds[2], bounds[3], bounds[4]));
+			}
+			catch (const std::invalid_argument& error)
+			{
+				throwTextError(lineNumber, error.what());
+			}
+		}
+		else
+		{
+			throwTextError(lineNumber, "unknown keyword " + keyword + ".");
+		}
+	}
+	if (hasAnimation)
+	{
+		builder.addAnimation(animation);
+	}
+	return builder;
+}
+
+void AnimationAssetBuilder::addAnimation(const Animation& animation)
+{
+	m_animations.addAnimation(animation);
+}
+
+void AnimationAssetBuilder::addRegion(std::string name, std::size_t page, sf::IntRect bounds)
+{
+	auto isSpace = [](char character) { return std::isspace(static_cast<unsigned char>(character)) != 0; };
+	if (name.empty() || std::any_of(name.begin(), name.end(), isSpace))
+	{
+		throw std::invalid_argument("The region name \"" + name + "\" must not be empty or contain whitespace.");
+	}
+
+	auto position = std::lower_bound(m_regions.begin(), m_regions.end(), name,
+		[](const RegionEntry& entry, const std::string& value) { return entry.name < value; });
+	if (position != m_regions.end() && position->name == name)
+	{
+		throw std::invalid_argument("A region named " + name + " was already added to the animation asset.");
+	}
+	m_regions.insert(position, RegionEntry{ std::move(name), page, bounds });
+}
+
+const AnimationSet& AnimationAssetBuilder::getAnimations() const noexcept
+{
+	return m_animations;
+}
+
+std::size_t AnimationAssetBuilder::getRegionCount() const noexcept
+{
+	return m_regions.size();
+}
+
+void AnimationAssetBuilder::writeBinary(std::ostream& output) const
+{
+	std::size_t stringSize = 0;
+	for (const RegionEntry& region : m_regions)
+	{
+		stringSize += region.name.size();
+	}
+
+	AnimationAsset::FileHeader header{};
+	std::memcpy(header.magic, ASSET_MAGIC, sizeof(ASSET_MAGIC));
+	header.byteOrder = BYTE_ORDER_MARK;
+	header.version = AnimationAsset::FormatVersion;
+	header.animationCount = toFileCount(m_animations.getSize());
+	header.frameCount = toFileCount(m_animations.getFrameCount());
+	header.regionCount = toFileCount(m_regions.size());
+	header.stringSize = toFileCount(stringSize);
+	writeValue(output, header);
+
+	std::uint32_t frameOffset = 0;
+	for (const AnimationView& animation : m_animations)
+	{
+		const AnimationAsset::AnimationRange range{ frameOffset, static_cast<std::uint32_t>(animation.size()) };
+		writeValue(output, range);
+		frameOffset += range.size;
+	}
+	for (const AnimationView& animation : m_animations)
+	{
+		output.write(reinterpret_cast<const char*>(animation.data()), static_cast<std::streamsize>(animation.size() * sizeof(sf::IntRect)));
+	}
+
+	std::uint32_t nameOffset = 0;
+	for (const RegionEntry& region : m_regions)
+	{
+		const AnimationAsset::RegionRecord record{
+			nameOffset,
+			static_cast<std::uint32_t>(region.name.size()),
+			toFileCount(region.page),
+			0,
+			region.bounds.left,
+			region.bounds.top,
+			region.bounds.width,
+			region.bounds.height
+		};
+		writeValue(output, record);
+		nameOffset += record.nameSize;
+	}
+	for (const RegionEntry& region : m_regions)
+	{
+		output.write(region.name.data(), static_cast<std::streamsize>(region.name.size()));
+	}
+	const char padding[4] = {};
+	output.write(padding, static_cast<std::streamsize>(padToFourBytes(stringSize) - stringSize));
+}
+
+std::vector<char> AnimationAssetBuilder::toBinary() const
+{
+	std::ostringstream output(std::ios::binary);
+	writeBinary(output);
+	const std::string bytes = output.str();
+	return std::vector<char>(bytes.begin(), bytes.end());
+}
+
+void AnimationAssetBuilder::writeText(std::ostream& output) const
+{
+	output << "version " << AnimationAsset::FormatVersion << '\n';
+	for (const AnimationView& animation : m_animations)
+	{
+		output << "animation\n";
+		for (const sf::IntRect& frame : animation)
+		{
+			output << "frame " << frame.left << ' ' << frame.top << ' ' << frame.width << ' ' << frame.height << '\n';
+		}
+	}
+	for (const RegionEntry& region : m_regions)
+	{
+		output << "region " << region.name << ' ' << region.page << ' '
+			<< region.bounds.left << ' ' << region.bounds.top << ' ' << region.bounds.width << ' ' << region.bounds.height << '\n';
+	}
+}
@@ -0,0 +1,183 @@
+#include <GameBackbone/Core/AnimationRegistry.h>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+using namespace GB;
+
+namespace
+{
+	/// @brief Mixes value into seed.
+	void hashCombine(std::size_t& seed, int value)
+	{
+		seed ^= std::hash<int>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+
+	/// @brief Returns the frame at frameIndex of a UniformAnimationSet with frames of frameSize.
+	sf::IntRect makeUniformFrame(sf::Vector2i frameSize, sf::Vector2i frameIndex)
+	{
+		return sf::IntRect(sf::Vector2i(frameIndex.x * frameSize.x, frameIndex.y * frameSize.y), frameSize);
+	}
+
+	/// @brief Hashes the frames of animations. makeFrame turns an element of an animation into its frame.
+	template <class AnimationType, class MakeFrame>
+	std::size_t hashAnimations(const std::vector<AnimationType>& animations, MakeFrame makeFrame)
+	{
+		std::size_t seed = animations.size();
+		for (const AnimationType& animation : animations)
+		{
+			hashCombine(seed, static_cast<int>(animation.size()));
+			for (const auto& element : animation)
+			{
+				const sf::IntRect frame = makeFrame(element);
+				hashCombine(seed, frame.left);
+				hashCombine(seed, frame.top);
+				hashCombine(seed, frame.width);
+				hashCombine(seed, frame.height);
+			}
+		}
+		return seed;
+	}
+
+	/// @brief True if the AnimationSet holds exactly the frames of animations. makeFrame turns an element of an animation into its frame.
+	template <class AnimationType, class MakeFrame>
+	bool isEqual(const AnimationSet& animationSet, const std::vector<AnimationType>& animations, MakeFrame makeFrame)
+	{
+		return std::equal(animationSet.begin(), animationSet.end(), animations.begin(), animations.end(),
+			[&makeFrame](const AnimationView& setAnimation, const AnimationType& animation) {
+				return std::equal(setAnimation.begin(), setAnimation.end(), animation.begin(), animation.end(),
+					[&makeFrame](const sf::IntRect& setFrame, const auto& element) {
+						return setFrame == makeFrame(element);
+					});
+			});
+	}
+
+	/// @brief Returns the interned AnimationSet with the frames of animations. Inserts a new one if there is none.
+	///		Must be called while holding the registry's mutex.
+	template <class AnimationType, class MakeFrame>
+	AnimationSet::ConstPtr findOrInsert(
+		std::unordered_multimap<std::size_t, AnimationSet::ConstPtr>& sets,
+		const std::vector<AnimationType>& animations,
+		MakeFrame makeFrame)
+	{
+		const std::size_t hash = hashAnimations(animations, makeFrame);
+		auto range = sets.equal_range(hash);
+		for (auto setIter = range.first; setIter != range.second; ++setIter)
+		{
+			if (isEqual(*setIter->second, animations, makeFrame))
+			{
+				return setIter->second;
+			}
+		}
+
+		std::size_t frameCount = 0;
+		for (const AnimationType& animation : animations)
+		{
+			frameCount += animation.size();
+		}
+
+		auto animationSet = std::make_shared<AnimationSet>();
+		animationSet->reserve(animations.size(), frameCount);
+		Animation frames;
+		for (const AnimationType& animation : animations)
+		{
+			frames.clear();
+			std::transform(animation.begin(), animation.end(), std::back_inserter(frames), makeFrame);
+			animationSet->addAnimation(frames);
+		}
+
+		sets.emplace(hash, animationSet);
+		return animationSet;
+	}
+}
+
+AnimationRegistry& AnimationRegistry::getGlobal()
+{
+	static AnimationRegistry globalRegistry;
+	return globalRegistry;
+}
+
+AnimationSet::ConstPtr AnimationRegistry::getAnimationSet(const std::vector<Animation>& animations)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return findOrInsert(m_sets, animations, [](const sf::IntRect& frame) { return frame; });
+}
+
+AnimationSet::ConstPtr AnimationRegistry::getUniformAnimationSet(sf::Vector2i frameSize, const std::vector<UniformAnimation>& animations)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return findOrInsert(m_sets, animations, [frameSize](sf::Vector2i frameIndex) { return makeUniformFrame(frameSize, frameIndex); });
+}
+
+std::size_t AnimationRegistry::getSetCount() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_sets.size();
+}
+
+std::size_t AnimationRegistry::getFrameCount() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::size_t frameCount = 0;
+	for (const auto& set : m_sets)
+	{
+		frameCount += set.second->getFrameCount();
+	}
+	return frameCount;
+}
+
+std::size_t AnimationRegistry::getMemoryUsage() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::size_t memoryUsage = 0;
+	for (const auto& set : m_sets)
+	{
+		memoryUsage += set.second->getMemoryUsage();
+	}
+	return memoryUsage;
+}
+
+std::size_t AnimationRegistry::getMemorySaved() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::size_t memorySaved = 0;
+	for (const auto& set : m_sets)
+	{
+		// The registry holds one reference. Every user past the first would have needed its own copy.
+		const long userCount = set.second.use_count() - 1;
+		if (userCount > 1)
+		{
+			memorySaved += static_cast<std::size_t>(userCount - 1) * set.second->getMemoryUsage();
+		}
+	}
+	return memorySaved;
+}
+
+std::size_t AnimationRegistry::removeUnused()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::size_t removedCount = 0;
+	for (auto setIter = m_sets.begin(); setIter != m_sets.end();)
+	{
+		if (setIter->second.use_count() == 1)
+		{
+			setIter = m_sets.erase(setIter);
+			++removedCount;
+		}
+		else
+		{
+			++setIter;
+		}
+	}
+	return removedCount;
+}
+
+void AnimationRegistry::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_sets.clear();
+}
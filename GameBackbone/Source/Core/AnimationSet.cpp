@@ -3,92 +3,129 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <algorithm>
 #include <cstddef>
-#include <exception>
+#include <stdexcept>
 #include <vector>
 
 using namespace GB;
 
-AnimationSet::AnimationSet(std::vector<Animation> animations) {
-    this->animations = std::move(animations);
+const sf::IntRect& AnimationView::at(std::size_t frameIndex) const {
+    if (frameIndex >= m_size) {
+        throw std::out_of_range("The requested frame does not exist.");
+    }
+    return m_frames[frameIndex];
 }
 
-void AnimationSet::addAnimation(Animation animation) {
-    animations.emplace_back(std::move(animation));
+bool GB::operator==(const AnimationView& left, const AnimationView& right) noexcept {
+    return std::equal(left.begin(), left.end(), right.begin(), right.end());
+}
+
+bool GB::operator!=(const AnimationView& left, const AnimationView& right) noexcept {
+    return !(left == right);
+}
+
+AnimationSet::AnimationSet(const std::vector<Animation>& animations) {
+    std::size_t frameCount = 0;
+    for (const Animation& animation : animations) {
+        frameCount += animation.size();
+    }
+    reserve(animations.size(), frameCount);
+
+    for (const Animation& animation : animations) {
+        addAnimation(animation);
+    }
+}
+
+void AnimationSet::addAnimation(const Animation& animation) {
+    m_ranges.push_back(AnimationRange{ m_frames.size(), animation.size() });
+    m_frames.insert(m_frames.end(), animation.begin(), animation.end());
 }
 
 void AnimationSet::eraseAnimation(const_iterator animation) {
-    animations.erase(animation);
+    eraseAnimations(animation, animation + 1);
 }
 
 void AnimationSet::eraseAnimations(const_iterator first, const_iterator last) {
-    animations.erase(first, last);
+    const std::size_t firstIndex = first.getIndex();
+    const std::size_t lastIndex = last.getIndex();
+    if (firstIndex >= lastIndex) {
+        return;
+    }
+
+    // The frames of consecutive animations are consecutive in the buffer
+    const std::size_t frameBegin = m_ranges[firstIndex].offset;
+    const std::size_t frameEnd = lastIndex < m_ranges.size() ? m_ranges[lastIndex].offset : m_frames.size();
+    const auto erasedFrameCount = static_cast<std::ptrdiff_t>(frameEnd - frameBegin);
+    m_frames.erase(m_frames.begin() + static_cast<std::ptrdiff_t>(frameBegin), m_frames.begin() + static_cast<std::ptrdiff_t>(frameEnd));
+
+    m_ranges.erase(m_ranges.begin() + static_cast<std::ptrdiff_t>(firstIndex), m_ranges.begin() + static_cast<std::ptrdiff_t>(lastIndex));
+    for (std::size_t ii = firstIndex; ii < m_ranges.size(); ++ii) {
+        m_ranges[ii].offset -= static_cast<std::size_t>(erasedFrameCount);
+    }
 }
 
 void AnimationSet::clearAnimations() {
-    animations.clear();
+    m_frames.clear();
+    m_ranges.clear();
 }
 
-const Animation& AnimationSet::operator[](std::size_t animationIndex) const noexcept {
-    return animations[animationIndex];
+void AnimationSet::reserve(std::size_t animationCount, std::size_t frameCount) {
+    m_ranges.reserve(animationCount);
+    m_frames.reserve(frameCount);
 }
 
-const Animation& AnimationSet::at(std::size_t animationIndex) const {
-    return animations.at(animationIndex);
+AnimationView AnimationSet::at(std::size_t animationIndex) const {
+    if (animationIndex >= m_ranges.size()) {
+        throw std::out_of_range("The requested Animation does not exist.");
+    }
+    return (*this)[animationIndex];
 }
 
 std::size_t AnimationSet::getSize() const {
-    return animations.size();
+    return m_ranges.size();
 }
 
-bool AnimationSet::isEmpty() const {
-    return animations.empty();
+std::size_t AnimationSet::getFrameCount() const noexcept {
+    return m_frames.size();
 }
 
-AnimationSet::iterator AnimationSet::begin() {
-    return animations.begin();
+std::size_t AnimationSet::getMemoryUsage() const noexcept {
+    return sizeof(AnimationSet) + m_frames.capacity() * sizeof(sf::IntRect) + m_ranges.capacity() * sizeof(AnimationRange);
 }
 
-AnimationSet::const_iterator AnimationSet::begin() const noexcept{
-    return animations.begin();
-}
-
-AnimationSet::const_iterator AnimationSet::cbegin() const noexcept{
-    return animations.cbegin();
+bool AnimationSet::isEmpty() const {
+    return m_ranges.empty();
 }
 
-AnimationSet::iterator AnimationSet::end() {
-    return animations.end();
+AnimationSet::const_iterator AnimationSet::begin() const noexcept {
+    return const_iterator(this, 0);
 }
 
-AnimationSet::const_iterator AnimationSet::end() const noexcept{
-    return animations.end();
+AnimationSet::const_iterator AnimationSet::cbegin() const noexcept {
+    return begin();
 }
 
-AnimationSet::const_iterator AnimationSet::cend() const noexcept{
-    return animations.cend();
+AnimationSet::const_iterator AnimationSet::end() const noexcept {
+    return const_iterator(this, m_ranges.size());
 }
 
-AnimationSet::reverse_iterator AnimationSet::rbegin(){
-    return animations.rbegin();
+AnimationSet::const_iterator AnimationSet::cend() const noexcept {
+    return end();
 }
 
-AnimationSet::const_reverse_iterator AnimationSet::rbegin() const noexcept{
-    return animations.rbegin();
+AnimationSet::const_reverse_iterator AnimationSet::rbegin() const noexcept {
+    return const_reverse_iterator(end());
 }
 
-AnimationSet::const_reverse_iterator AnimationSet::crbegin() const noexcept{
-    return animations.crbegin();
+AnimationSet::const_reverse_iterator AnimationSet::crbegin() const noexcept {
+    return rbegin();
 }
 
-AnimationSet::reverse_iterator AnimationSet::rend(){
-    return animations.rend();
+AnimationSet::const_reverse_iterator AnimationSet::rend() const noexcept {
+    return const_reverse_iterator(begin());
 }
 
-AnimationSet::const_reverse_iterator AnimationSet::rend() const noexcept{
-    return animations.rend();
+AnimationSet::const_reverse_iterator AnimationSet::crend() const noexcept {
+    return rend();
 }
-
-AnimationSet::const_reverse_iterator AnimationSet::crend() const noexcept{
-    return animations.crend();
-}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include <GameBackbone/Core/AnimationSystem.h>
+
+#include <stdexcept>
+#include <utility>
+
+using namespace GB;
+
+namespace
+{
+	/// @brief Moves the element at index to the back of the vector and removes it.
+	template <class T>
+	void swapRemove(std::vector<T>& values, std::size_t index)
+	{
+		if (index != values.size() - 1)
+		{
+			values[index] = std::move(values.back());
+		}
+		values.pop_back();
+	}
+}
+
+void AnimationSystem::addSprite(sf::Sprite& sprite, AnimationSet::ConstPtr animations)
+{
+	if (animations == nullptr)
+	{
+		throw std::out_of_range("AnimationSystem requires an AnimationSet.");
+	}
+	// Throws if there is no first frame to show
+	const sf::IntRect& firstFrame = animations->at(0).at(0);
+
+	auto indexIter = m_indices.find(&sprite);
+	std::size_t index = 0;
+	if (indexIter == m_indices.end())
+	{
+		index = m_sprites.size();
+		m_indices.emplace(&sprite, index);
+		m_sprites.push_back(&sprite);
+		m_animationSets.push_back(nullptr);
+		m_frameRects.push_back(nullptr);
+		m_frameCounts.push_back(0);
+		m_currentAnimationIds.push_back(0);
+		m_currentFrames.push_back(0);
+		m_framesSpent.push_back(0);
+		m_timers.push_back(0);
+		m_delays.push_back(0);
+		m_endTypes.push_back(ANIMATION_END_TYPE::ANIMATION_LOOP);
+		m_isReverse.push_back(false);
+		m_isAnimating.push_back(false);
+		m_isDue.push_back(false);
+	}
+	else
+	{
+		index = indexIter->second;
+	}
+
+	m_animationSets[index] = std::move(animations);
+	startAnimation(index, 0, ANIMATION_END_TYPE::ANIMATION_LOOP);
+	m_timers[index] = 0;
+	m_isAnimating[index] = false;
+	sprite.setTextureRect(firstFrame);
+}
+
+void AnimationSystem::removeSprite(const sf::Sprite& sprite)
+{
+	auto indexIter = m_indices.find(&sprite);
+	if (indexIter == m_indices.end())
+	{
+		return;
+	}
+
+	// Fill the hole with the last sprite so that the arrays stay contiguous
+	const std::size_t index = indexIter->second;
+	m_indices.erase(indexIter);
+	if (index != m_sprites.size() - 1)
+	{
+		m_indices[m_sprites.back()] = index;
+	}
+
+	swapRemove(m_sprites, index);
+	swapRemove(m_animationSets, index);
+	swapRemove(m_frameRects, index);
+	swapRemove(m_frameCounts, index);
+	swapRemove(m_currentAnimationIds, index);
+	swapRemove(m_currentFrames, index);
+	swapRemove(m_framesSpent, index);
+	swapRemove(m_timers, index);
+	swapRemove(m_delays, index);
+	swapRemove(m_endTypes, index);
+	swapRemove(m_isReverse, index);
+	swapRemove(m_isAnimating, index);
+	swapRemove(m_isDue, index);
+}
+
+void AnimationSystem::clearSprites()
+{
+	m_indices.clear();
+	m_sprites.clear();
+	m_animationSets.clear();
+	m_frameRects.clear();
+	m_frameCounts.clear();
+	m_currentAnimationIds.clear();
+	m_currentFrames.clear();
+	m_framesSpent.clear();
+	m_timers.clear();
+	m_delays.clear();
+	m_endTypes.clear();
+	m_isReverse.clear();
+	m_isAnimating.clear();
+	m_isDue.clear();
+	m_lastChangedCount = 0;
+}
+
+bool AnimationSystem::containsSprite(const sf::Sprite& sprite) const
+{
+	return m_indices.find(&sprite) != m_indices.end();
+}
+
+std::size_t AnimationSystem::getSpriteCount() const noexcept
+{
+	return m_sprites.size();
+}
+
+void AnimationSystem::runAnimation(const sf::Sprite& sprite, unsigned int animationId, ANIMATION_END_TYPE endStyle)
+{
+	const std::size_t index = getIndex(sprite);
+	startAnimation(index, animationId, endStyle);
+	m_isAnimating[index] = true;
+	m_sprites[index]->setTextureRect(m_frameRects[index][0]);
+}
+
+void AnimationSystem::setAnimating(const sf::Sprite& sprite, bool animating)
+{
+	m_isAnimating[getIndex(sprite)] = animating;
+}
+
+void AnimationSystem::setAnimationDelay(const sf::Sprite& sprite, sf::Time delay)
+{
+	m_delays[getIndex(sprite)] = delay.asMicroseconds();
+}
+
+bool AnimationSystem::isAnimating(const sf::Sprite& sprite) const
+{
+	return m_isAnimating[getIndex(sprite)] != 0;
+}
+
+sf::Time AnimationSystem::getAnimationDelay(const sf::Sprite& sprite) const
+{
+	return sf::microseconds(m_delays[getIndex(sprite)]);
+}
+
+unsigned int AnimationSystem::getCurrentAnimationId(const sf::Sprite& sprite) const
+{
+	return m_currentAnimationIds[getIndex(sprite)];
+}
+
+unsigned int AnimationSystem::getCurrentFrame(const sf::Sprite& sprite) const
+{
+	return m_currentFrames[getIndex(sprite)];
+}
+
+unsigned int AnimationSystem::getFramesSpentInCurrentAnimation(const sf::Sprite& sprite) const
+{
+	return m_framesSpent[getIndex(sprite)];
+}
+
+void AnimationSystem::setFrameSkippingEnabled(bool frameSkipping) noexcept
+{
+	m_isFrameSkippingEnabled = frameSkipping;
+}
+
+bool AnimationSystem::isFrameSkippingEnabled() const noexcept
+{
+	return m_isFrameSkippingEnabled;
+}
+
+std::size_t AnimationSystem::getLastChangedCount() const noexcept
+{
+	return m_lastChangedCount;
+}
+
+void AnimationSystem::update(sf::Int64 elapsedTime)
+{
+	// Advance every timer in one tight loop over the timing arrays. The time of due frames is consumed below.
+	// Local pointers keep the compiler from reloading the vectors after every store.
+	// The conditions are combined with & so that the loop has no branches.
+	const std::size_t spriteCount = m_sprites.size();
+	sf::Int64* const timers = m_timers.data();
+	const sf::Int64* const delays = m_delays.data();
+	const std::uint32_t* const isAnimating = m_isAnimating.data();
+	std::uint32_t* const isDue = m_isDue.data();
+	for (std::size_t ii = 0; ii < spriteCount; ++ii)
+	{
+		const sf::Int64 timer = timers[ii] + elapsedTime;
+		timers[ii] = timer;
+		isDue[ii] = (isAnimating[ii] != 0) & (timer > delays[ii]);
+	}
+
+	// Only step the animations that are due, and only rebuild the vertices of the sprites that show a new frame
+	m_lastChangedCount = 0;
+	for (std::size_t ii = 0; ii < spriteCount; ++ii)
+	{
+		if (isDue[ii] == 0)
+		{
+			continue;
+		}
+
+		const std::uint64_t frameCount = consumeAnimationTime(timers[ii], delays[ii], m_isFrameSkippingEnabled);
+		m_framesSpent[ii] += static_cast<unsigned int>(frameCount);
+
+		const unsigned int frame = m_currentFrames[ii];
+		bool isReverse = m_isReverse[ii] != 0;
+		const unsigned int nextFrame = advanceAnimationFrame(frame, m_frameCounts[ii], m_endTypes[ii], frameCount, isReverse);
+		m_isReverse[ii] = isReverse;
+		if (nextFrame != frame)
+		{
+			++m_lastChangedCount;
+			m_currentFrames[ii] = nextFrame;
+			m_sprites[ii]->setTextureRect(m_frameRects[ii][nextFrame]);
+		}
+	}
+}
+
+std::size_t AnimationSystem::getIndex(const sf::Sprite& sprite) const
+{
+	auto indexIter = m_indices.find(&sprite);
+	if (indexIter == m_indices.end())
+	{
+		throw std::out_of_range("The sprite was not added to the AnimationSystem.");
+	}
+	return indexIter->second;
+}
+
+void AnimationSystem::startAnimation(std::size_t index, unsigned int animationId, ANIMATION_END_TYPE endStyle)
+{
+	// Empty animations cannot be run. What frame would be displayed?
+	const AnimationView animation = m_animationSets[index]->at(animationId);
+	if (animation.empty())
+	{
+		throw std::out_of_range("The requested Animation does not exist.");
+	}
+
+	m_frameRects[index] = animation.data();
+	m_frameCounts[index] = static_cast<unsigned int>(animation.size());
+	m_currentAnimationIds[index] = animationId;
+	m_currentFrames[index] = 0;
+	m_framesSpent[index] = 0;
+	m_endTypes[index] = endStyle;
+	m_isReverse[index] = false;
+}
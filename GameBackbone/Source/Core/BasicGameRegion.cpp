@@ -8,6 +8,16 @@
 
 using namespace GB;
 
+void PreloadProgress::setProgress(float progress) noexcept
+{
+	m_progress.store(std::clamp(progress, 0.f, 1.f), std::memory_order_relaxed);
+}
+
+float PreloadProgress::getProgress() const noexcept
+{
+	return m_progress.load(std::memory_order_relaxed);
+}
+
 BasicGameRegion::BasicGameRegion() : m_nextRegion(*this) {}
 
 BasicGameRegion& BasicGameRegion::getNextRegion()
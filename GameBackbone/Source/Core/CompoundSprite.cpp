@@ -2,10 +2,14 @@
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -13,16 +17,53 @@
 
 using namespace GB;
 
+namespace
+{
+	/// @brief Appends the two triangles that make up the sprite's quad to the vertex array.
+	/// @param vertices The vertex array to append to. Must use the sf::Triangles primitive type.
+	/// @param sprite The sprite to append.
+	void appendSpriteVertices(sf::VertexArray& vertices, const sf::Sprite& sprite)
+	{
+		const sf::Transform& transform = sprite.getTransform();
+		const sf::FloatRect bounds = sprite.getLocalBounds();
+		const sf::IntRect& textureRect = sprite.getTextureRect();
+		const sf::Color& color = sprite.getColor();
+
+		const float left = static_cast<float>(textureRect.left);
+		const float right = left + static_cast<float>(textureRect.width);
+		const float top = static_cast<float>(textureRect.top);
+		const float bottom = top + static_cast<float>(textureRect.height);
+
+		// Same corner order as sf::Sprite so the texture is mapped identically.
+		const sf::Vertex topLeft{ transform.transformPoint(0.f, 0.f), color, sf::Vector2f{ left, top } };
+		const sf::Vertex bottomLeft{ transform.transformPoint(0.f, bounds.height), color, sf::Vector2f{ left, bottom } };
+		const sf::Vertex topRight{ transform.transformPoint(bounds.width, 0.f), color, sf::Vector2f{ right, top } };
+		const sf::Vertex bottomRight{ transform.transformPoint(bounds.width, bounds.height), color, sf::Vector2f{ right, bottom } };
+
+		vertices.append(topLeft);
+		vertices.append(bottomLeft);
+		vertices.append(topRight);
+		vertices.append(topRight);
+		vertices.append(bottomLeft);
+		vertices.append(bottomRight);
+	}
+}
+
 CompoundSprite::CompoundSprite(sf::Vector2f position){
 	setPosition(position);
 }
 
 CompoundSprite::CompoundSprite(const CompoundSprite& other) : CompoundSprite()
 {
-	this->setPosition(other.getPosition());
-	this->setRotation(other.getRotation());
-	this->setScale(other.getScale());
-	this->setOrigin(other.getOrigin());
+	// The copied components must include every transform made to the other CompoundSprite
+	other.applyPendingTransform();
+
+	this->m_isBatchDrawingEnabled = other.m_isBatchDrawingEnabled;
+	this->m_isDeferredTransformsEnabled = other.m_isDeferredTransformsEnabled;
+	this->Transformable::setPosition(other.getPosition());
+	this->Transformable::setRotation(other.getRotation());
+	this->Transformable::setScale(other.getScale());
+	this->Transformable::setOrigin(other.getOrigin());
 
 	for (auto& priorityComponent : other.m_prioritizedComponents)
 	{
@@ -41,13 +82,31 @@ CompoundSprite& CompoundSprite::operator=(const CompoundSprite& other)
 }
 
 CompoundSprite::CompoundSprite(CompoundSprite&& other) noexcept
-	: Transformable(other), m_prioritizedComponents(std::move(other.m_prioritizedComponents))
-{}
+	: Transformable(other),
+	m_prioritizedComponents(std::move(other.m_prioritizedComponents)),
+	m_isBatchDrawingEnabled(other.m_isBatchDrawingEnabled),
+	m_isDeferredTransformsEnabled(other.m_isDeferredTransformsEnabled),
+	m_hasPendingTransform(other.m_hasPendingTransform),
+	m_pendingTransform(other.m_pendingTransform)
+{
+	// The batch and pending transform of the moved from CompoundSprite refer to the moved components
+	other.invalidateBatch();
+	other.m_hasPendingTransform = false;
+	other.m_pendingTransform = PendingTransform{};
+}
 
 CompoundSprite& CompoundSprite::operator=(CompoundSprite&& other) noexcept
 {
 	// Move the CompoundSprite members from the other
 	this->m_prioritizedComponents = std::move(other.m_prioritizedComponents);
+	this->m_isBatchDrawingEnabled = other.m_isBatchDrawingEnabled;
+	this->m_isDeferredTransformsEnabled = other.m_isDeferredTransformsEnabled;
+	this->m_hasPendingTransform = other.m_hasPendingTransform;
+	this->m_pendingTransform = other.m_pendingTransform;
+	invalidateBatch();
+	other.invalidateBatch();
+	other.m_hasPendingTransform = false;
+	other.m_pendingTransform = PendingTransform{};
 
 	// Copy the Transformable members from the other, since it cannot be moved.
 	this->Transformable::setPosition(other.getPosition());
@@ -67,6 +126,9 @@ std::size_t CompoundSprite::getComponentCount(int priority) const {
 }
 
 std::vector<CompoundSprite::ComponentWrapper*> CompoundSprite::getComponentsWithPriorty(int priority) {
+	// The components may be modified through the returned pointers. Changes to sprites are found when the batch is next drawn.
+	applyPendingTransform();
+
 	std::vector<ComponentWrapper*> components;
 	for (iterator iter = m_prioritizedComponents.begin(); iter != m_prioritizedComponents.end(); ++iter)
 	{
@@ -80,21 +142,26 @@ std::vector<CompoundSprite::ComponentWrapper*> CompoundSprite::getComponentsWith
 
 CompoundSprite::iterator CompoundSprite::begin()
 {
+	// The components may be modified through the returned iterator. Changes to sprites are found when the batch is next drawn.
+	applyPendingTransform();
 	return this->m_prioritizedComponents.begin();
 }
 
 CompoundSprite::iterator CompoundSprite::end()
 {
+	applyPendingTransform();
 	return m_prioritizedComponents.end();
 }
 
 const CompoundSprite::const_iterator CompoundSprite::cbegin()
 {
+	applyPendingTransform();
 	return m_prioritizedComponents.cbegin();
 }
 
 const CompoundSprite::const_iterator CompoundSprite::cend()
 {
+	applyPendingTransform();
 	return m_prioritizedComponents.cend();
 }
 
@@ -115,6 +182,40 @@ bool CompoundSprite::isEmpty() const {
 
 void CompoundSprite::clearComponents() {
 	m_prioritizedComponents.clear();
+	invalidateBatch();
+}
+
+void CompoundSprite::setBatchDrawingEnabled(bool enabled) {
+	m_isBatchDrawingEnabled = enabled;
+}
+
+bool CompoundSprite::isBatchDrawingEnabled() const {
+	return m_isBatchDrawingEnabled;
+}
+
+std::size_t CompoundSprite::getBatchedDrawCount() const {
+	applyPendingTransform();
+	if (!isBatchCurrent())
+	{
+		rebuildBatch();
+	}
+	return m_batchDrawSteps.size();
+}
+
+void CompoundSprite::setDeferredTransformsEnabled(bool enabled) {
+	if (!enabled)
+	{
+		applyPendingTransform();
+	}
+	m_isDeferredTransformsEnabled = enabled;
+}
+
+bool CompoundSprite::isDeferredTransformsEnabled() const {
+	return m_isDeferredTransformsEnabled;
+}
+
+void CompoundSprite::applyDeferredTransforms() {
+	applyPendingTransform();
 }
 
 
@@ -129,6 +230,18 @@ void CompoundSprite::setPosition(const sf::Vector2f& position) {
 }
 
 void CompoundSprite::setRotation(float angle) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		// Replaces any earlier rotation
+		m_pendingTransform.rotation = angle;
+		m_pendingTransform.isRotationAbsolute = true;
+		m_hasPendingTransform = true;
+		sf::Transformable::setRotation(angle);
+		return;
+	}
+
 	// Lambda for rotating components
 	auto setRotationFunction = [angle](auto& componentPair) {
 		componentPair.second->setRotation(angle);
@@ -142,6 +255,18 @@ void CompoundSprite::setRotation(float angle) {
 }
 
 void CompoundSprite::setScale(float factorX, float factorY) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		// Replaces any earlier scale
+		m_pendingTransform.scale = sf::Vector2f{ factorX, factorY };
+		m_pendingTransform.isScaleAbsolute = true;
+		m_hasPendingTransform = true;
+		sf::Transformable::setScale(factorX, factorY);
+		return;
+	}
+
 	// Lambda function for scaling components
 	auto setScaleFunction = [factorX, factorY](auto& componentPair) {
 		componentPair.second->setScale(factorX, factorY);
@@ -159,6 +284,16 @@ void CompoundSprite::setScale(const sf::Vector2f& factors) {
 }
 
 void CompoundSprite::setOrigin(float x, float y) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		m_pendingTransform.originOffset += sf::Vector2f{ x - getOrigin().x, y - getOrigin().y };
+		m_hasPendingTransform = true;
+		sf::Transformable::setOrigin(x, y);
+		return;
+	}
+
 	// function to update the origin of a component
 	auto setOriginFunction = [x, y, this](auto& componentPair) {
 
@@ -181,6 +316,16 @@ void CompoundSprite::setOrigin(const sf::Vector2f& origin) {
 }
 
 void CompoundSprite::move(float offsetX, float offsetY) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		m_pendingTransform.positionOffset += sf::Vector2f{ offsetX, offsetY };
+		m_hasPendingTransform = true;
+		sf::Transformable::move(offsetX, offsetY);
+		return;
+	}
+
 	// function for moving a component
 	auto moveFunction = [offsetX, offsetY](auto& componentPair) {
 		componentPair.second->move(offsetX, offsetY);
@@ -198,6 +343,16 @@ void CompoundSprite::move(const sf::Vector2f& offset) {
 }
 
 void CompoundSprite::rotate(float angle) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		m_pendingTransform.rotation += angle;
+		m_hasPendingTransform = true;
+		sf::Transformable::rotate(angle);
+		return;
+	}
+
 	// Lambda for rotating components
 	auto rotateFunction = [angle](auto& componentPair) {
 		componentPair.second->rotate(angle);
@@ -211,6 +366,17 @@ void CompoundSprite::rotate(float angle) {
 }
 
 void CompoundSprite::scale(float factorX, float factorY) {
+	invalidateBatch();
+
+	if (m_isDeferredTransformsEnabled)
+	{
+		m_pendingTransform.scale.x *= factorX;
+		m_pendingTransform.scale.y *= factorY;
+		m_hasPendingTransform = true;
+		sf::Transformable::scale(factorX, factorY);
+		return;
+	}
+
 	// Lambda function for scaling components
 	auto scaleFunction = [factorX, factorY](auto& componentPair) {
 		componentPair.second->scale(factorX, factorY);
@@ -228,13 +394,21 @@ void CompoundSprite::scale(const sf::Vector2f& factor) {
 }
 
 void CompoundSprite::update(sf::Int64 elapsedTime) {
-	// Forward the update to each component
+	// Forward the update to each component. Changes to sprites are found when the batch is next drawn.
 	for (auto& componentPair : m_prioritizedComponents) {
 		componentPair.second->update(elapsedTime);
 	}
 }
 
 void CompoundSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+	applyPendingTransform();
+
+	if (m_isBatchDrawingEnabled)
+	{
+		drawBatched(target, states);
+		return;
+	}
+
 	// lambda function to draw a component
 	auto drawFunction = [&target, &states](auto& componentPair) {
 		target.draw(componentPair.second->getDataAsDrawable(), states);
@@ -244,3 +418,146 @@ void CompoundSprite::draw(sf::RenderTarget& target, sf::RenderStates states) con
 	std::for_each(std::begin(m_prioritizedComponents), std::end(m_prioritizedComponents), drawFunction);
 }
 
+void CompoundSprite::invalidateBatch() {
+	m_isBatchDirty = true;
+}
+
+bool CompoundSprite::isBatchCurrent() const {
+	if (m_isBatchDirty)
+	{
+		return false;
+	}
+
+	// Every sprite must still look the way it did when the batch was built
+	auto stateIter = m_batchedSpriteStates.cbegin();
+	for (const auto& componentPair : m_prioritizedComponents)
+	{
+		const sf::Sprite* sprite = componentPair.second->getDataAsSprite();
+		if (sprite == nullptr)
+		{
+			continue;
+		}
+		if (stateIter == m_batchedSpriteStates.cend() || !(*stateIter == BatchedSpriteState{ *sprite }))
+		{
+			return false;
+		}
+		++stateIter;
+	}
+	return stateIter == m_batchedSpriteStates.cend();
+}
+
+void CompoundSprite::rebuildBatch() const {
+	m_batchDrawSteps.clear();
+	m_batchedSpriteStates.clear();
+
+	// Batch each priority separately so that priorities are still drawn in order
+	auto priorityBegin = m_prioritizedComponents.begin();
+	while (priorityBegin != m_prioritizedComponents.end())
+	{
+		const auto priorityEnd = m_prioritizedComponents.upper_bound(priorityBegin->first);
+		const std::size_t firstStepOfPriority = m_batchDrawSteps.size();
+
+		for (auto iter = priorityBegin; iter != priorityEnd; ++iter)
+		{
+			ComponentWrapper& component = *iter->second;
+			const sf::Sprite* sprite = component.getDataAsSprite();
+			if (sprite != nullptr)
+			{
+				m_batchedSpriteStates.emplace_back(*sprite);
+			}
+
+			// Components that are not textured sprites cannot be batched. Draw them individually.
+			if (sprite == nullptr || sprite->getTexture() == nullptr)
+			{
+				m_batchDrawSteps.push_back(BatchDrawStep{ nullptr, sf::VertexArray{}, &component.getDataAsDrawable() });
+				continue;
+			}
+
+			// Find the batch of this priority that uses the sprite's texture. Create it if it does not exist yet.
+			const sf::Texture* texture = sprite->getTexture();
+			auto batchIter = std::find_if(m_batchDrawSteps.begin() + static_cast<std::ptrdiff_t>(firstStepOfPriority), m_batchDrawSteps.end(),
+				[texture](const BatchDrawStep& step) -> bool {
+					return step.drawable == nullptr && step.texture == texture;
+				});
+			if (batchIter == m_batchDrawSteps.end())
+			{
+				m_batchDrawSteps.push_back(BatchDrawStep{ texture, sf::VertexArray{ sf::Triangles }, nullptr });
+				batchIter = std::prev(m_batchDrawSteps.end());
+			}
+
+			appendSpriteVertices(batchIter->vertices, *sprite);
+		}
+
+		priorityBegin = priorityEnd;
+	}
+
+	m_isBatchDirty = false;
+}
+
+void CompoundSprite::drawBatched(sf::RenderTarget& target, sf::RenderStates states) const {
+	if (!isBatchCurrent())
+	{
+		rebuildBatch();
+	}
+
+	for (const BatchDrawStep& step : m_batchDrawSteps)
+	{
+		if (step.drawable != nullptr)
+		{
+			target.draw(*step.drawable, states);
+		}
+		else
+		{
+			sf::RenderStates batchStates{ states };
+			batchStates.texture = step.texture;
+			target.draw(step.vertices, batchStates);
+		}
+	}
+}
+
+void CompoundSprite::applyPendingTransform() const {
+	if (!m_hasPendingTransform)
+	{
+		return;
+	}
+
+	const PendingTransform& pending = m_pendingTransform;
+	const bool hasMove = pending.positionOffset != sf::Vector2f{ 0.f, 0.f };
+	const bool hasOriginChange = pending.originOffset != sf::Vector2f{ 0.f, 0.f };
+	const bool hasRotation = pending.isRotationAbsolute || pending.rotation != 0.f;
+	const bool hasScale = pending.isScaleAbsolute || pending.scale != sf::Vector2f{ 1.f, 1.f };
+
+	// Each part of the transform is independent, so the order they are applied in does not matter
+	for (auto& componentPair : m_prioritizedComponents)
+	{
+		ComponentWrapper& component = *componentPair.second;
+		if (hasMove)
+		{
+			component.move(pending.positionOffset);
+		}
+		if (hasOriginChange)
+		{
+			component.setOrigin(component.getOrigin() + pending.originOffset);
+		}
+		if (hasRotation && pending.isRotationAbsolute)
+		{
+			component.setRotation(pending.rotation);
+		}
+		else if (hasRotation)
+		{
+			component.rotate(pending.rotation);
+		}
+		if (hasScale && pending.isScaleAbsolute)
+		{
+			component.setScale(pending.scale);
+		}
+		else if (hasScale)
+		{
+			component.scale(pending.scale);
+		}
+	}
+
+	m_pendingTransform = PendingTransform{};
+	m_hasPendingTransform = false;
+	m_isBatchDirty = true;
+}
@@ -3,8 +3,102 @@
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <condition_variable>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
 using namespace GB;
 
+namespace
+{
+	/// @brief Runs one task at a time on its own thread.
+	class BackgroundWorker
+	{
+	public:
+		BackgroundWorker() : m_thread([this]() { runTasks(); }) {}
+
+		BackgroundWorker(const BackgroundWorker&) = delete;
+		BackgroundWorker& operator=(const BackgroundWorker&) = delete;
+		BackgroundWorker(BackgroundWorker&&) = delete;
+		BackgroundWorker& operator=(BackgroundWorker&&) = delete;
+
+		~BackgroundWorker()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_shouldStop = true;
+			}
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		/// @brief Starts running the task on the worker thread. The previous task must have been waited for.
+		/// @param task The task to run.
+		void start(std::function<void()> task)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_task = std::move(task);
+			}
+			m_condition.notify_all();
+		}
+
+		/// @brief Blocks until the current task is done. Rethrows anything the task threw.
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return !m_task; });
+			if (m_error)
+			{
+				std::rethrow_exception(std::exchange(m_error, nullptr));
+			}
+		}
+
+	private:
+		void runTasks()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			while (true)
+			{
+				m_condition.wait(lock, [this]() { return m_task || m_shouldStop; });
+				if (!m_task)
+				{
+					return;
+				}
+
+				// Run the task without holding the lock so that wait can check on it
+				lock.unlock();
+				try
+				{
+					m_task();
+				}
+				catch (...)
+				{
+					m_error = std::current_exception();
+				}
+				lock.lock();
+
+				m_task = nullptr;
+				m_condition.notify_all();
+			}
+		}
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::function<void()> m_task;
+		std::exception_ptr m_error;
+		bool m_shouldStop = false;
+		std::thread m_thread;
+	};
+}
+
 static const int DEFAULT_WINDOW_HEIGHT = 700;
 static const int DEFAULT_WINDOW_WIDTH = 700;
 static const std::string DEFAULT_WINDOW_NAME = "GameBackbone";
@@ -33,16 +127,229 @@ void CoreEventController::runLoop()
 		continue;
 	}
 
+	if (m_isPipelinedExecutionEnabled)
+	{
+		runPipelinedLoop();
+		return;
+	}
+
 	while (m_window.isOpen())
 	{
 		sf::Time elapsedTime = m_updateClock.restart();
-		handleEvents(elapsedTime.asMicroseconds());
-		update(elapsedTime.asMicroseconds());
+		runLoopIteration(elapsedTime.asMicroseconds());
+	}
+}
+
+void CoreEventController::runPipelinedLoop()
+{
+	BackgroundWorker updateWorker;
+	bool isUpdating = false;
+
+	while (m_window.isOpen())
+	{
+		FrameProfiler::ScopedTimer frameTimer(m_profiler.get(), LoopPhase::Frame);
+		sf::Time elapsedTime = m_updateClock.restart();
+
+		// Nothing else touches the region until the next update starts
+		if (isUpdating)
+		{
+			updateWorker.wait();
+			isUpdating = false;
+		}
+		{
+			FrameProfiler::ScopedTimer swapTimer(m_profiler.get(), LoopPhase::SwapRegion);
+			swapRegion();
+		}
+		// Uploaded before the update starts, since a finished texture may call back into the region
+		uploadTextures();
+		getActiveRegion()->publishRenderState();
+		interpolateActiveRegion();
+
+		{
+			FrameProfiler::ScopedTimer handleEventsTimer(m_profiler.get(), LoopPhase::HandleEvents);
+			handleEvents(elapsedTime.asMicroseconds());
+		}
+
+		// Update the next frame while drawing this one. The update phase is recorded from the worker thread.
+		updateWorker.start([this, elapsedTime]() {
+			FrameProfiler::ScopedTimer updateTimer(m_profiler.get(), LoopPhase::Update);
+			runUpdate(elapsedTime.asMicroseconds());
+		});
+		isUpdating = true;
+		{
+			FrameProfiler::ScopedTimer repaintTimer(m_profiler.get(), LoopPhase::Repaint);
+			repaint();
+		}
+	}
+
+	if (isUpdating)
+	{
+		updateWorker.wait();
+	}
+}
+
+void CoreEventController::runLoopIteration(sf::Int64 elapsedTime)
+{
+	FrameProfiler* profiler = m_profiler.get();
+	FrameProfiler::ScopedTimer frameTimer(profiler, LoopPhase::Frame);
+	{
+		FrameProfiler::ScopedTimer handleEventsTimer(profiler, LoopPhase::HandleEvents);
+		handleEvents(elapsedTime);
+	}
+	{
+		FrameProfiler::ScopedTimer updateTimer(profiler, LoopPhase::Update);
+		runUpdate(elapsedTime);
+	}
+	// Not part of any phase, the same as while pipelined
+	uploadTextures();
+	interpolateActiveRegion();
+	{
+		FrameProfiler::ScopedTimer repaintTimer(profiler, LoopPhase::Repaint);
 		repaint();
+	}
+	{
+		FrameProfiler::ScopedTimer swapTimer(profiler, LoopPhase::SwapRegion);
 		swapRegion();
 	}
 }
 
+void CoreEventController::runUpdate(sf::Int64 elapsedTime)
+{
+	if (isFixedTimestepEnabled())
+	{
+		updateFixed(elapsedTime);
+	}
+	else
+	{
+		update(elapsedTime);
+	}
+}
+
+void CoreEventController::updateFixed(sf::Int64 elapsedTime)
+{
+	m_accumulatedTime += elapsedTime;
+
+	int updateCount = 0;
+	while (m_accumulatedTime >= m_fixedTimestep && updateCount < m_maxUpdatesPerFrame)
+	{
+		update(m_fixedTimestep);
+		m_accumulatedTime -= m_fixedTimestep;
+		++updateCount;
+	}
+
+	// Drop the full timesteps that could not be caught up. Keep the partial one for interpolation.
+	m_accumulatedTime %= m_fixedTimestep;
+	m_interpolationAlpha = static_cast<float>(m_accumulatedTime) / static_cast<float>(m_fixedTimestep);
+}
+
+void CoreEventController::interpolateActiveRegion()
+{
+	m_drawInterpolationAlpha = m_interpolationAlpha;
+
+	// Let the region blend between its last two updates
+	if (isFixedTimestepEnabled() && m_activeRegion != nullptr)
+	{
+		m_activeRegion->interpolate(m_drawInterpolationAlpha);
+	}
+}
+
+void CoreEventController::setFixedTimestep(sf::Int64 timestep, int maxUpdatesPerFrame)
+{
+	if (timestep <= 0)
+	{
+		throw std::invalid_argument("The fixed timestep must be positive.");
+	}
+	if (maxUpdatesPerFrame <= 0)
+	{
+		throw std::invalid_argument("The max updates per frame must be positive.");
+	}
+
+	m_fixedTimestep = timestep;
+	m_maxUpdatesPerFrame = maxUpdatesPerFrame;
+	m_accumulatedTime = 0;
+	m_interpolationAlpha = 0.f;
+	m_drawInterpolationAlpha = 0.f;
+}
+
+void CoreEventController::disableFixedTimestep()
+{
+	m_fixedTimestep = 0;
+	m_accumulatedTime = 0;
+	m_interpolationAlpha = 0.f;
+	m_drawInterpolationAlpha = 0.f;
+}
+
+bool CoreEventController::isFixedTimestepEnabled() const
+{
+	return m_fixedTimestep > 0;
+}
+
+sf::Int64 CoreEventController::getFixedTimestep() const
+{
+	return m_fixedTimestep;
+}
+
+float CoreEventController::getInterpolationAlpha() const
+{
+	return m_drawInterpolationAlpha;
+}
+
+void CoreEventController::setPipelinedExecutionEnabled(bool enabled)
+{
+	m_isPipelinedExecutionEnabled = enabled;
+}
+
+bool CoreEventController::isPipelinedExecutionEnabled() const
+{
+	return m_isPipelinedExecutionEnabled;
+}
+
+void CoreEventController::setTextureLoader(TextureLoader* textureLoader, std::size_t uploadBudget)
+{
+	m_textureLoader = textureLoader;
+	m_textureUploadBudget = uploadBudget;
+}
+
+TextureLoader* CoreEventController::getTextureLoader()
+{
+	return m_textureLoader;
+}
+
+void CoreEventController::uploadTextures()
+{
+	if (m_textureLoader != nullptr)
+	{
+		m_textureLoader->uploadPending(m_textureUploadBudget);
+	}
+}
+
+void CoreEventController::setProfilingEnabled(bool enabled, std::size_t capacity)
+{
+	if (!enabled)
+	{
+		m_profiler.reset();
+	}
+	else if (m_profiler == nullptr || m_profiler->getCapacity() != capacity)
+	{
+		m_profiler = std::make_unique<FrameProfiler>(capacity);
+	}
+}
+
+bool CoreEventController::isProfilingEnabled() const
+{
+	return m_profiler != nullptr;
+}
+
+FrameProfiler* CoreEventController::getProfiler()
+{
+	return m_profiler.get();
+}
+
+const FrameProfiler* CoreEventController::getProfiler() const
+{
+	return m_profiler.get();
+}
+
 BasicGameRegion* CoreEventController::getActiveRegion()
 {
 	return m_activeRegion;
@@ -55,7 +362,111 @@ sf::RenderWindow& CoreEventController::getWindow()
 
 void CoreEventController::setActiveRegion(BasicGameRegion* activeRegion)
 {
-	m_activeRegion = activeRegion;
+	if (m_activeRegion == activeRegion)
+	{
+		return;
+	}
+	waitForPreload(*activeRegion);
+	activateRegion(*activeRegion);
+}
+
+void CoreEventController::activateRegion(BasicGameRegion& region)
+{
+	if (m_activeRegion != nullptr)
+	{
+		m_activeRegion->deactivate();
+		m_activeRegion->m_lifecycle.state = RegionState::Ready;
+	}
+	m_activeRegion = &region;
+	region.m_lifecycle.state = RegionState::Active;
+	region.activate();
+}
+
+void CoreEventController::preloadRegion(BasicGameRegion& region)
+{
+	BasicGameRegion::Lifecycle& lifecycle = region.m_lifecycle;
+	if (lifecycle.state != RegionState::Unloaded)
+	{
+		return;
+	}
+
+	lifecycle.state = RegionState::Preloading;
+	lifecycle.progress = std::make_shared<PreloadProgress>();
+	// Captures the region and progress rather than the controller so that the controller can be moved while preloading
+	lifecycle.preload = std::async(std::launch::async, [&region, progress = lifecycle.progress]() {
+		region.preload(*progress);
+	});
+}
+
+void CoreEventController::waitForPreload(BasicGameRegion& region)
+{
+	BasicGameRegion::Lifecycle& lifecycle = region.m_lifecycle;
+	if (lifecycle.state == RegionState::Ready || lifecycle.state == RegionState::Active)
+	{
+		return;
+	}
+
+	try
+	{
+		if (lifecycle.state == RegionState::Preloading)
+		{
+			lifecycle.preload.get();
+		}
+		else
+		{
+			lifecycle.progress = std::make_shared<PreloadProgress>();
+			region.preload(*lifecycle.progress);
+		}
+	}
+	catch (...)
+	{
+		lifecycle.state = RegionState::Unloaded;
+		throw;
+	}
+	lifecycle.progress->setProgress(1.f);
+	lifecycle.state = RegionState::Ready;
+}
+
+void CoreEventController::unloadRegion(BasicGameRegion& region)
+{
+	if (&region == m_activeRegion)
+	{
+		throw std::invalid_argument("The active region cannot be unloaded.");
+	}
+	if (region.m_lifecycle.state == RegionState::Unloaded)
+	{
+		return;
+	}
+
+	waitForPreload(region);
+	region.unload();
+	region.m_lifecycle.state = RegionState::Unloaded;
+}
+
+bool CoreEventController::isPreloadFinished(const BasicGameRegion& region)
+{
+	const BasicGameRegion::Lifecycle& lifecycle = region.m_lifecycle;
+	return lifecycle.state == RegionState::Preloading && lifecycle.preload.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+RegionState CoreEventController::getRegionState(const BasicGameRegion& region) const
+{
+	return isPreloadFinished(region) ? RegionState::Ready : region.m_lifecycle.state;
+}
+
+float CoreEventController::getPreloadProgress(const BasicGameRegion& region) const
+{
+	switch (getRegionState(region))
+	{
+	case RegionState::Unloaded:
+		return 0.f;
+	case RegionState::Preloading:
+		return region.m_lifecycle.progress->getProgress();
+	case RegionState::Ready:
+	case RegionState::Active:
+		return 1.f;
+	}
+	return 0.f;
 }
 
 void CoreEventController::repaint()
@@ -98,7 +509,14 @@ void CoreEventController::swapRegion()
 	BasicGameRegion& newRegion = getActiveRegion()->getNextRegion();
 	if (m_activeRegion != &newRegion)
 	{
+		// Keep running the active region until the new one has finished preloading in the background
+		if (newRegion.m_lifecycle.state == RegionState::Preloading && !isPreloadFinished(newRegion))
+		{
+			return;
+		}
+
+		waitForPreload(newRegion);
 		m_activeRegion->setNextRegion(*m_activeRegion);
-		m_activeRegion = &newRegion;
+		activateRegion(newRegion);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <GameBackbone/Core/FrameProfiler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace GB;
+
+FrameProfiler::FrameProfiler(std::size_t capacity) : m_capacity(capacity), m_creationTime(std::chrono::steady_clock::now())
+{
+	if (capacity == 0)
+	{
+		throw std::invalid_argument("FrameProfiler capacity must be positive");
+	}
+
+	// One extra slot is kept so that the slot being overwritten is never one of the capacity samples being read
+	for (PhaseBuffer& buffer : m_buffers)
+	{
+		buffer.samples = std::make_unique<AtomicSample[]>(m_capacity + 1);
+	}
+}
+
+std::size_t FrameProfiler::getCapacity() const noexcept
+{
+	return m_capacity;
+}
+
+sf::Int64 FrameProfiler::now() const noexcept
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_creationTime).count();
+}
+
+void FrameProfiler::record(LoopPhase phase, sf::Int64 start, sf::Int64 duration) noexcept
+{
+	PhaseBuffer& buffer = m_buffers[static_cast<std::size_t>(phase)];
+	const std::size_t writeCount = buffer.writeCount.load(std::memory_order_relaxed);
+	AtomicSample& sample = buffer.samples[writeCount % (m_capacity + 1)];
+
+	// Readers that see any part of this write also see every sample before it as published
+	std::atomic_thread_fence(std::memory_order_release);
+	sample.start.store(start, std::memory_order_relaxed);
+	sample.duration.store(duration, std::memory_order_relaxed);
+	buffer.writeCount.store(writeCount + 1, std::memory_order_release);
+}
+
+std::vector<PhaseSample> FrameProfiler::getSamples(LoopPhase phase) const
+{
+	const PhaseBuffer& buffer = m_buffers[static_cast<std::size_t>(phase)];
+	const std::size_t slotCount = m_capacity + 1;
+
+	const std::size_t writeCount = buffer.writeCount.load(std::memory_order_acquire);
+	const std::size_t firstIndex = writeCount > m_capacity ? writeCount - m_capacity : 0;
+
+	std::vector<PhaseSample> samples;
+	samples.reserve(writeCount - firstIndex);
+	for (std::size_t index = firstIndex; index < writeCount; ++index)
+	{
+		const AtomicSample& sample = buffer.samples[index % slotCount];
+		samples.push_back(PhaseSample{
+			phase,
+			sample.start.load(std::memory_order_relaxed),
+			sample.duration.load(std::memory_order_relaxed)
+		});
+	}
+
+	// Drop the samples that were overwritten while they were being read. This is a seqlock over the whole buffer.
+	std::atomic_thread_fence(std::memory_order_acquire);
+	const std::size_t laterWriteCount = buffer.writeCount.load(std::memory_order_relaxed);
+	if (laterWriteCount > writeCount && laterWriteCount > m_capacity)
+	{
+		const std::size_t firstValidIndex = laterWriteCount - m_capacity;
+		if (firstValidIndex > firstIndex)
+		{
+			samples.erase(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(std::min(firstValidIndex - firstIndex, samples.size())));
+		}
+	}
+
+	return samples;
+}
+
+PhaseStatistics FrameProfiler::getStatistics(LoopPhase phase) const
+{
+	const std::vector<PhaseSample> samples = getSamples(phase);
+
+	PhaseStatistics statistics;
+	statistics.sampleCount = samples.size();
+	if (samples.empty())
+	{
+		return statistics;
+	}
+
+	std::vector<sf::Int64> durations;
+	durations.reserve(samples.size());
+	double total = 0.0;
+	for (const PhaseSample& sample : samples)
+	{
+		durations.push_back(sample.duration);
+		total += static_cast<double>(sample.duration);
+	}
+
+	const auto minMax = std::minmax_element(durations.begin(), durations.end());
+	statistics.min = *minMax.first;
+	statistics.max = *minMax.second;
+	statistics.average = total / static_cast<double>(durations.size());
+
+	// Nearest rank percentile
+	const auto p99Rank = static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(durations.size())));
+	const auto p99Iter = durations.begin() + static_cast<std::ptrdiff_t>(p99Rank - 1);
+	std::nth_element(durations.begin(), p99Iter, durations.end());
+	statistics.p99 = *p99Iter;
+
+	return statistics;
+}
+
+void FrameProfiler::clear() noexcept
+{
+	for (PhaseBuffer& buffer : m_buffers)
+	{
+		buffer.writeCount.store(0, std::memory_order_release);
+	}
+}
+
+void FrameProfiler::writeCsv(std::ostream& out) const
+{
+	out << "phase,start_us,duration_us\n";
+	for (std::size_t phaseIndex = 0; phaseIndex < PHASE_COUNT; ++phaseIndex)
+	{
+		const LoopPhase phase = static_cast<LoopPhase>(phaseIndex);
+		for (const PhaseSample& sample : getSamples(phase))
+		{
+			out << getPhaseName(phase) << ',' << sample.start << ',' << sample.duration << '\n';
+		}
+	}
+}
+
+void FrameProfiler::writeChromeTrace(std::ostream& out) const
+{
+	out << "{\"traceEvents\":[";
+	bool isFirstEvent = true;
+	auto beginEvent = [&out, &isFirstEvent]() {
+		out << (isFirstEvent ? "\n" : ",\n");
+		isFirstEvent = false;
+	};
+
+	// Each phase gets its own track so that phases that run at the same time on different threads do not overlap
+	for (std::size_t phaseIndex = 0; phaseIndex < PHASE_COUNT; ++phaseIndex)
+	{
+		const LoopPhase phase = static_cast<LoopPhase>(phaseIndex);
+		const char* phaseName = getPhaseName(phase);
+
+		beginEvent();
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << phaseIndex
+			<< ",\"args\":{\"name\":\"" << phaseName << "\"}}";
+
+		for (const PhaseSample& sample : getSamples(phase))
+		{
+			beginEvent();
+			out << "{\"name\":\"" << phaseName << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << phaseIndex
+				<< ",\"ts\":" << sample.start << ",\"dur\":" << sample.duration << '}';
+		}
+	}
+	out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+const char* FrameProfiler::getPhaseName(LoopPhase phase) noexcept
+{
+	switch (phase)
+	{
+	case LoopPhase::HandleEvents:
+		return "HandleEvents";
+	case LoopPhase::Update:
+		return "Update";
+	case LoopPhase::Repaint:
+		return "Repaint";
+	case LoopPhase::SwapRegion:
+		return "SwapRegion";
+	case LoopPhase::Frame:
+		return "Frame";
+	}
+	return "Unknown";
+}
@@ -3,20 +3,48 @@
 #include <GameBackbone/Core/BasicGameRegion.h>
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/View.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <exception>
+#include <iterator>
+#include <tuple>
 #include <utility>
 
 using namespace GB;
 
+namespace {
+	// Flush the draw list once more than 1 / REMOVED_ENTRY_COMPACTION_RATIO of it has been removed
+	constexpr std::size_t REMOVED_ENTRY_COMPACTION_RATIO = 4;
+
+	constexpr float PI = 3.14159265358979f;
+
+	/// <summary>
+	/// Returns the axis aligned rectangle that contains everything the view can see.
+	/// </summary>
+	/// <param name="view"> The view. </param>
+	sf::FloatRect getViewBounds(const sf::View& view) {
+		const float radians = view.getRotation() * PI / 180.f;
+		const float cosine = std::abs(std::cos(radians));
+		const float sine = std::abs(std::sin(radians));
+		const sf::Vector2f& size = view.getSize();
+		const sf::Vector2f& center = view.getCenter();
+
+		// A rotated view sees more of the world along each axis
+		const float width = size.x * cosine + size.y * sine;
+		const float height = size.x * sine + size.y * cosine;
+		return sf::FloatRect{ center.x - width / 2.f, center.y - height / 2.f, width, height };
+	}
+}
+
 
 /// <summary>
 /// Returns the count of all drawables stored on this GameRegion.
 /// </summary>
 /// <return> The number of drawables </param>
 std::size_t GameRegion::getDrawableCount() const  noexcept {
-	return prioritizedDrawables.size();
+	return m_drawableKeys.size();
 }
 
 /// <summary>
@@ -25,23 +53,78 @@ std::size_t GameRegion::getDrawableCount() const  noexcept {
 /// <param name="priority"> The priority of drawables to count </param>
 /// <return> The number of drawables </param>
 std::size_t GameRegion::getDrawableCount(int priority) const noexcept {
-	return prioritizedDrawables.count(priority);
+	auto it = m_priorityCounts.find(priority);
+	return (it == m_priorityCounts.end()) ? 0 : it->second;
+}
+
+
+/// <summary>
+/// Enables or disables culling. While enabled, drawables whose global bounds are known and
+/// do not intersect the view of the render target are not drawn.
+/// </summary>
+/// <param name="enabled"> True to cull drawables outside of the view. False to draw every drawable. </param>
+void GameRegion::setCullingEnabled(bool enabled) noexcept {
+	m_isCullingEnabled = enabled;
+}
+
+/// <summary>
+/// Returns true if culling is enabled. False otherwise.
+/// </summary>
+bool GameRegion::isCullingEnabled() const noexcept {
+	return m_isCullingEnabled;
+}
+
+/// <summary>
+/// Returns the number of drawables drawn by the last draw of this GameRegion.
+/// </summary>
+std::size_t GameRegion::getLastDrawnCount() const noexcept {
+	return m_lastDrawnCount;
+}
+
+/// <summary>
+/// Returns the number of drawables skipped by culling in the last draw of this GameRegion.
+/// </summary>
+std::size_t GameRegion::getLastCulledCount() const noexcept {
+	return m_lastCulledCount;
 }
 
 
 /// <summary>
 /// Add a drawable with a given priority to this GameRegion.
-/// If the drawable already exists, it will be drawn multiple times.
-/// 
+/// If the drawable already exists, it is moved to the given priority and drawn after the other drawables of that priority.
+/// The drawable is never culled.
 /// </summary>
 /// <param name="priority"> The priority of the drawable </param>
 /// <param name="drawablesToRemove"> The drawable that will be added </param>
 void GameRegion::addDrawable(int priority, sf::Drawable& drawableToAdd) {
+	addDrawable(priority, drawableToAdd, nullptr);
+}
+
+/// <summary>
+/// Add a drawable with a given priority to this GameRegion.
+/// If the drawable already exists, it is moved to the given priority and drawn after the other drawables of that priority.
+/// </summary>
+/// <param name="priority"> The priority of the drawable </param>
+/// <param name="drawablesToRemove"> The drawable that will be added </param>
+/// <param name="getBounds"> Returns the global bounds of the drawable for culling. nullptr if the drawable should never be culled. </param>
+void GameRegion::addDrawable(int priority, sf::Drawable& drawableToAdd, BoundsFunction getBounds) {
 	// Remove any instances of the drawable before adding it again
 	removeDrawable(drawableToAdd);
 
-	// Add the drawable to the internal map
-	prioritizedDrawables.emplace(priority, &drawableToAdd);
+	// New drawables are merged into the sorted draw list the next time it is drawn
+	const DrawListKey key{ priority, m_nextSequence++ };
+	m_pendingDrawables.push_back(DrawListEntry{ key, &drawableToAdd, getBounds });
+	m_drawableKeys.emplace(&drawableToAdd, key);
+	++m_priorityCounts[priority];
+
+	if (m_spatialIndex) {
+		if (getBounds != nullptr) {
+			m_spatialIndex->insert(drawableToAdd, getBounds(drawableToAdd));
+		}
+		else {
+			m_unboundedDrawables.insert(&drawableToAdd);
+		}
+	}
 }
 
 /// <summary>
@@ -50,24 +133,47 @@ void GameRegion::addDrawable(int priority, sf::Drawable& drawableToAdd) {
 /// </summary>
 /// <param name="drawablesToRemove"> The drawable that will be removed </param>
 void GameRegion::removeDrawable(sf::Drawable& drawableToRemove) {
-	// Find the drawable inside of the internal map.
-	auto it = std::find_if(prioritizedDrawables.begin(), prioritizedDrawables.end(),
-		[&drawableToRemove](const std::pair<int, sf::Drawable*>& possibleRemoval) -> bool {
-			return possibleRemoval.second == &drawableToRemove;
-		});
+	// Find the drawable in the reverse index
+	auto keyIt = m_drawableKeys.find(&drawableToRemove);
+	if (keyIt == m_drawableKeys.end())
+	{
+		return;
+	}
+	const DrawListKey key = keyIt->second;
+	m_drawableKeys.erase(keyIt);
+
+	if (m_spatialIndex) {
+		m_spatialIndex->remove(drawableToRemove);
+		m_unboundedDrawables.erase(&drawableToRemove);
+		m_movedDrawables.erase(&drawableToRemove);
+	}
 
-	// If the drawable was found, erase it.
-	if (it != prioritizedDrawables.end())
+	auto countIt = m_priorityCounts.find(key.priority);
+	if (--countIt->second == 0)
 	{
-		prioritizedDrawables.erase(it);
+		m_priorityCounts.erase(countIt);
 	}
+
+	// Leave a hole in the draw list. It is removed the next time the draw list is flushed.
+	findDrawListEntry(key)->drawable = nullptr;
+	++m_removedDrawListEntryCount;
 }
 
 /// <summary>
 /// Removes all drawable objects from this GameRegion.
 /// </summary>
 void GameRegion::clearDrawables() {
-	prioritizedDrawables.clear();
+	m_drawList.clear();
+	m_pendingDrawables.clear();
+	m_removedDrawListEntryCount = 0;
+	m_drawableKeys.clear();
+	m_priorityCounts.clear();
+
+	if (m_spatialIndex) {
+		m_spatialIndex->clear();
+		m_unboundedDrawables.clear();
+		m_movedDrawables.clear();
+	}
 }
 
 /// <summary>
@@ -75,7 +181,272 @@ void GameRegion::clearDrawables() {
 /// </summary>
 /// <param name="priority"> The priority of drawables clear</param>
 void GameRegion::clearDrawables(int priority) {
-	prioritizedDrawables.erase(priority);
+	auto removeEntry = [this](DrawListEntry& entry) {
+		if (entry.drawable != nullptr)
+		{
+			if (m_spatialIndex) {
+				m_spatialIndex->remove(*entry.drawable);
+				m_unboundedDrawables.erase(entry.drawable);
+				m_movedDrawables.erase(entry.drawable);
+			}
+			m_drawableKeys.erase(entry.drawable);
+			entry.drawable = nullptr;
+			++m_removedDrawListEntryCount;
+		}
+	};
+
+	// The drawables of a priority are contiguous in the sorted draw list
+	auto lowerPriority = [](const DrawListEntry& entry, int value) { return entry.key.priority < value; };
+	auto higherPriority = [](int value, const DrawListEntry& entry) { return value < entry.key.priority; };
+	auto first = std::lower_bound(m_drawList.begin(), m_drawList.end(), priority, lowerPriority);
+	auto last = std::upper_bound(first, m_drawList.end(), priority, higherPriority);
+	std::for_each(first, last, removeEntry);
+
+	for (DrawListEntry& entry : m_pendingDrawables)
+	{
+		if (entry.key.priority == priority)
+		{
+			removeEntry(entry);
+		}
+	}
+
+	m_priorityCounts.erase(priority);
+}
+
+/// <summary>
+/// Keeps drawables in a spatial index so that culling and the drawable queries do not have to look at every drawable.
+/// Any existing index is rebuilt with the new cell size.
+/// The index does not see drawables move. Call markDrawableMoved or updateDrawableBounds after moving one,
+/// or updateSpatialIndex or rebuildSpatialIndex after moving many.
+/// </summary>
+/// <param name="cellSize"> The width and height of each cell of the index. Should be around the size of a typical drawable. </param>
+void GameRegion::enableSpatialIndex(float cellSize) {
+	m_spatialIndex.emplace(cellSize);
+	rebuildSpatialIndex();
+}
+
+/// <summary>
+/// Stops keeping drawables in a spatial index.
+/// </summary>
+void GameRegion::disableSpatialIndex() {
+	m_spatialIndex.reset();
+	m_unboundedDrawables.clear();
+	m_movedDrawables.clear();
+}
+
+/// <summary>
+/// Returns true if drawables are kept in a spatial index. False otherwise.
+/// </summary>
+bool GameRegion::isSpatialIndexEnabled() const noexcept {
+	return m_spatialIndex.has_value();
+}
+
+/// <summary>
+/// Appends every drawable whose bounds intersect the area to results.
+/// Drawables without bounds are never found.
+/// </summary>
+/// <param name="area"> The area to search. </param>
+/// <param name="results"> The vector to append to. </param>
+void GameRegion::getDrawablesInArea(const sf::FloatRect& area, std::vector<const sf::Drawable*>& results) const {
+	if (m_spatialIndex) {
+		applyMovedDrawables();
+		m_spatialIndex->queryArea(area, results);
+		return;
+	}
+
+	forEachBoundedDrawable([&area, &results](const sf::Drawable& drawable, BoundsFunction getBounds) {
+		if (getBounds(drawable).intersects(area)) {
+			results.push_back(&drawable);
+		}
+	});
+}
+
+/// <summary>
+/// Appends every drawable whose bounds contain the point to results.
+/// Drawables without bounds are never found.
+/// </summary>
+/// <param name="point"> The point to search. </param>
+/// <param name="results"> The vector to append to. </param>
+void GameRegion::getDrawablesAtPoint(const sf::Vector2f& point, std::vector<const sf::Drawable*>& results) const {
+	if (m_spatialIndex) {
+		applyMovedDrawables();
+		m_spatialIndex->queryPoint(point, results);
+		return;
+	}
+
+	forEachBoundedDrawable([&point, &results](const sf::Drawable& drawable, BoundsFunction getBounds) {
+		if (getBounds(drawable).contains(point)) {
+			results.push_back(&drawable);
+		}
+	});
+}
+
+/// <summary>
+/// Appends every drawable whose bounds are within radius of the center to results.
+/// Drawables without bounds are never found.
+/// </summary>
+/// <param name="center"> The center of the searched circle. </param>
+/// <param name="radius"> The radius of the searched circle. </param>
+/// <param name="results"> The vector to append to. </param>
+void GameRegion::getDrawablesInRadius(const sf::Vector2f& center, float radius, std::vector<const sf::Drawable*>& results) const {
+	if (m_spatialIndex) {
+		applyMovedDrawables();
+		m_spatialIndex->queryRadius(center, radius, results);
+		return;
+	}
+
+	forEachBoundedDrawable([&center, radius, &results](const sf::Drawable& drawable, BoundsFunction getBounds) {
+		if (SpatialGrid::isWithinRadius(getBounds(drawable), center, radius)) {
+			results.push_back(&drawable);
+		}
+	});
+}
+
+/// <summary>
+/// Marks a drawable as moved. Its bounds are updated in the spatial index by the next draw or query,
+/// which only look at the drawables marked since the last one. Cheap to call every time the drawable moves.
+/// Does nothing if the spatial index is disabled or the drawable has no bounds.
+/// </summary>
+/// <param name="movedDrawable"> The drawable that moved. </param>
+void GameRegion::markDrawableMoved(const sf::Drawable& movedDrawable) {
+	if (!m_spatialIndex) {
+		return;
+	}
+
+	auto keyIt = m_drawableKeys.find(&movedDrawable);
+	if (keyIt == m_drawableKeys.end()) {
+		return;
+	}
+
+	const DrawListEntry* entry = findDrawListEntry(keyIt->second);
+	if (entry->getBounds != nullptr) {
+		m_movedDrawables.emplace(&movedDrawable, entry->getBounds);
+	}
+}
+
+/// <summary>
+/// Updates the bounds of a single drawable in the spatial index right away. Call after moving the drawable.
+/// Does nothing if the spatial index is disabled or the drawable has no bounds.
+/// </summary>
+/// <param name="movedDrawable"> The drawable that moved. </param>
+void GameRegion::updateDrawableBounds(const sf::Drawable& movedDrawable) {
+	if (!m_spatialIndex) {
+		return;
+	}
+
+	auto keyIt = m_drawableKeys.find(&movedDrawable);
+	if (keyIt == m_drawableKeys.end()) {
+		return;
+	}
+
+	const DrawListEntry* entry = findDrawListEntry(keyIt->second);
+	if (entry->getBounds != nullptr) {
+		m_spatialIndex->insert(movedDrawable, entry->getBounds(movedDrawable));
+		m_movedDrawables.erase(&movedDrawable);
+	}
+}
+
+/// <summary>
+/// Updates the bounds of every drawable in the spatial index. Use after moving many drawables.
+/// Only drawables that moved to different cells of the index are moved within it.
+/// </summary>
+void GameRegion::updateSpatialIndex() {
+	if (!m_spatialIndex) {
+		return;
+	}
+
+	forEachBoundedDrawable([this](const sf::Drawable& drawable, BoundsFunction getBounds) {
+		m_spatialIndex->insert(drawable, getBounds(drawable));
+	});
+	m_movedDrawables.clear();
+}
+
+/// <summary>
+/// Rebuilds the spatial index from scratch. Use after adding or moving many drawables at once, such as when loading a level.
+/// </summary>
+void GameRegion::rebuildSpatialIndex() {
+	if (!m_spatialIndex) {
+		return;
+	}
+
+	m_spatialIndex->clear();
+	m_unboundedDrawables.clear();
+	m_movedDrawables.clear();
+	for (const std::vector<DrawListEntry>* entries : { &m_drawList, &m_pendingDrawables }) {
+		for (const DrawListEntry& entry : *entries) {
+			if (entry.drawable == nullptr) {
+				continue;
+			}
+			if (entry.getBounds != nullptr) {
+				m_spatialIndex->insert(*entry.drawable, entry.getBounds(*entry.drawable));
+			}
+			else {
+				m_unboundedDrawables.insert(entry.drawable);
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Updates the bounds of the drawables marked as moved in the spatial index.
+/// </summary>
+void GameRegion::applyMovedDrawables() const {
+	for (const auto& [drawable, getBounds] : m_movedDrawables) {
+		m_spatialIndex->insert(*drawable, getBounds(*drawable));
+	}
+	m_movedDrawables.clear();
+}
+
+/// <summary>
+/// Finds the entry of a drawable that is in the draw list.
+/// </summary>
+/// <param name="key"> The key of the drawable. </param>
+/// <return> The entry with the key. </return>
+GameRegion::DrawListEntry* GameRegion::findDrawListEntry(const DrawListKey& key) {
+	// Pending drawables were added after everything in m_drawList and are in the order they were added
+	if (!m_pendingDrawables.empty() && key.sequence >= m_pendingDrawables.front().key.sequence)
+	{
+		auto it = std::lower_bound(m_pendingDrawables.begin(), m_pendingDrawables.end(), key.sequence,
+			[](const DrawListEntry& entry, std::uint64_t sequence) { return entry.key.sequence < sequence; });
+		return &(*it);
+	}
+
+	auto it = std::lower_bound(m_drawList.begin(), m_drawList.end(), key,
+		[](const DrawListEntry& entry, const DrawListKey& value) {
+			return std::tie(entry.key.priority, entry.key.sequence) < std::tie(value.priority, value.sequence);
+		});
+	return &(*it);
+}
+
+/// <summary>
+/// Merges the pending drawables into the draw list and drops removed drawables.
+/// Does nothing if there are no pending drawables and few removed drawables.
+/// </summary>
+void GameRegion::flushDrawList() const {
+	const std::size_t totalEntryCount = m_drawList.size() + m_pendingDrawables.size();
+	if (m_pendingDrawables.empty() && m_removedDrawListEntryCount * REMOVED_ENTRY_COMPACTION_RATIO <= totalEntryCount)
+	{
+		return;
+	}
+
+	auto isBefore = [](const DrawListEntry& lhs, const DrawListEntry& rhs) {
+		return std::tie(lhs.key.priority, lhs.key.sequence) < std::tie(rhs.key.priority, rhs.key.sequence);
+	};
+	auto isRemoved = [](const DrawListEntry& entry) { return entry.drawable == nullptr; };
+
+	// The pending drawables are already in sequence order, so sorting by key only needs to sort by priority
+	std::stable_sort(m_pendingDrawables.begin(), m_pendingDrawables.end(),
+		[](const DrawListEntry& lhs, const DrawListEntry& rhs) { return lhs.key.priority < rhs.key.priority; });
+
+	m_drawListScratch.clear();
+	m_drawListScratch.reserve(totalEntryCount);
+	std::merge(m_drawList.begin(), m_drawList.end(), m_pendingDrawables.begin(), m_pendingDrawables.end(),
+		std::back_inserter(m_drawListScratch), isBefore);
+	m_drawListScratch.erase(std::remove_if(m_drawListScratch.begin(), m_drawListScratch.end(), isRemoved), m_drawListScratch.end());
+
+	m_drawList.swap(m_drawListScratch);
+	m_pendingDrawables.clear();
+	m_removedDrawListEntryCount = 0;
 }
 
 
@@ -86,10 +457,65 @@ void GameRegion::clearDrawables(int priority) {
 /// <param name="states"> Current render states </param>
 void GameRegion::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	// Loop through each priority of the drawables
-	for (const auto& priorityPair : prioritizedDrawables) {
-		const sf::Drawable* drawable = priorityPair.second;
-		// Draw each drawable stored in the vector
-		target.draw(*drawable, states);
+	flushDrawList();
+
+	const sf::FloatRect viewBounds = getViewBounds(target.getView());
+	if (m_isCullingEnabled && m_spatialIndex) {
+		drawIndexed(target, states, viewBounds);
+		return;
 	}
+
+	m_lastDrawnCount = 0;
+	m_lastCulledCount = 0;
+
+	// Draw each drawable in priority order
+	for (const DrawListEntry& entry : m_drawList) {
+		// Skip drawables that were removed since the last flush
+		if (entry.drawable == nullptr) {
+			continue;
+		}
+
+		// Skip drawables that are outside of the view
+		if (m_isCullingEnabled && entry.getBounds != nullptr &&
+			!viewBounds.intersects(states.transform.transformRect(entry.getBounds(*entry.drawable)))) {
+			++m_lastCulledCount;
+			continue;
+		}
+
+		target.draw(*entry.drawable, states);
+		++m_lastDrawnCount;
+	}
+}
+
+/// <summary>
+/// Draws the drawables that the spatial index finds in the view and every drawable without bounds.
+/// </summary>
+/// <param name="target"> The SFML render target to draw on. </param>
+/// <param name="states"> Current render states </param>
+/// <param name="viewBounds"> The area that the view of the target can see. </param>
+void GameRegion::drawIndexed(sf::RenderTarget& target, sf::RenderStates states, const sf::FloatRect& viewBounds) const
+{
+	applyMovedDrawables();
+
+	// The index holds bounds before states.transform is applied
+	m_queryResults.clear();
+	m_spatialIndex->queryArea(states.transform.getInverse().transformRect(viewBounds), m_queryResults);
+	m_queryResults.insert(m_queryResults.end(), m_unboundedDrawables.begin(), m_unboundedDrawables.end());
+
+	// Restore the draw order
+	m_visibleDrawables.clear();
+	for (const sf::Drawable* drawable : m_queryResults) {
+		m_visibleDrawables.emplace_back(m_drawableKeys.at(drawable), drawable);
+	}
+	std::sort(m_visibleDrawables.begin(), m_visibleDrawables.end(),
+		[](const auto& lhs, const auto& rhs) {
+			return std::tie(lhs.first.priority, lhs.first.sequence) < std::tie(rhs.first.priority, rhs.first.sequence);
+		});
+
+	for (const auto& visibleDrawable : m_visibleDrawables) {
+		target.draw(*visibleDrawable.second, states);
+	}
+
+	m_lastDrawnCount = m_visibleDrawables.size();
+	m_lastCulledCount = getDrawableCount() - m_lastDrawnCount;
 }
@@ -0,0 +1,101 @@
+#include <GameBackbone/Core/LoadingSprite.h>
+
+#include <utility>
+
+using namespace GB;
+
+LoadingSprite::LoadingSprite(TextureHandle texture)
+{
+	setTexture(std::move(texture));
+}
+
+LoadingSprite::LoadingSprite(const LoadingSprite& other) :
+	sf::Sprite(other),
+	m_textureHandle(other.m_textureHandle),
+	m_initialTextureRect(other.m_initialTextureRect)
+{
+	watchTexture();
+}
+
+LoadingSprite& LoadingSprite::operator=(const LoadingSprite& other)
+{
+	if (this != &other)
+	{
+		sf::Sprite::operator=(other);
+		m_textureHandle = other.m_textureHandle;
+		m_initialTextureRect = other.m_initialTextureRect;
+		watchTexture();
+	}
+	return *this;
+}
+
+LoadingSprite::LoadingSprite(LoadingSprite&& other) noexcept :
+	sf::Sprite(std::move(other)),
+	m_textureHandle(std::move(other.m_textureHandle)),
+	m_initialTextureRect(other.m_initialTextureRect),
+	m_self(std::move(other.m_self))
+{
+	// The callbacks already given to the texture now resize this sprite
+	if (m_self)
+	{
+		*m_self = this;
+	}
+}
+
+LoadingSprite& LoadingSprite::operator=(LoadingSprite&& other) noexcept
+{
+	if (this != &other)
+	{
+		sf::Sprite::operator=(std::move(other));
+		m_textureHandle = std::move(other.m_textureHandle);
+		m_initialTextureRect = other.m_initialTextureRect;
+		m_self = std::move(other.m_self);
+		if (m_self)
+		{
+			*m_self = this;
+		}
+	}
+	return *this;
+}
+
+void LoadingSprite::setTexture(TextureHandle texture)
+{
+	sf::Sprite::setTexture(texture.getTexture(), true);
+	m_textureHandle = std::move(texture);
+	m_initialTextureRect = getTextureRect();
+	watchTexture();
+}
+
+const TextureHandle& LoadingSprite::getTextureHandle() const noexcept
+{
+	return m_textureHandle;
+}
+
+void LoadingSprite::watchTexture()
+{
+	// Callbacks given out for an earlier texture no longer do anything
+	m_self.reset();
+	if (!m_textureHandle || m_textureHandle.getState() != TextureLoadState::Loading)
+	{
+		return;
+	}
+
+	m_self = std::make_shared<LoadingSprite*>(this);
+	m_textureHandle.addLoadedCallback([weakSelf = std::weak_ptr<LoadingSprite*>(m_self)](const TextureHandle& texture) {
+		if (std::shared_ptr<LoadingSprite*> self = weakSelf.lock())
+		{
+			(*self)->onTextureLoaded(texture);
+		}
+	});
+}
+
+void LoadingSprite::onTextureLoaded(const TextureHandle& texture)
+{
+	m_self.reset();
+
+	// Leave sprites that were given another texture or rect alone
+	if (texture.getState() == TextureLoadState::Loaded && getTexture() == &texture.getTexture() && getTextureRect() == m_initialTextureRect)
+	{
+		sf::Sprite::setTexture(texture.getTexture(), true);
+	}
+}
@@ -0,0 +1,304 @@
+#include <GameBackbone/Core/SpatialGrid.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace GB;
+
+namespace
+{
+	// Cell coordinates are clamped to this range so that they always fit in an int
+	constexpr int MIN_CELL_COORDINATE = std::numeric_limits<int>::min() / 2;
+	constexpr int MAX_CELL_COORDINATE = std::numeric_limits<int>::max() / 2;
+
+	/// @brief Returns a unique key for the cell at the coordinates.
+	std::uint64_t getCellKey(int x, int y)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	/// @brief Returns the rectangle with a non negative width and height that covers the same area.
+	sf::FloatRect normalize(const sf::FloatRect& rect)
+	{
+		const float left = std::min(rect.left, rect.left + rect.width);
+		const float top = std::min(rect.top, rect.top + rect.height);
+		return sf::FloatRect{ left, top, std::abs(rect.width), std::abs(rect.height) };
+	}
+}
+
+SpatialGrid::SpatialGrid(float cellSize) : m_cellSize(cellSize)
+{
+	if (!(cellSize > 0.f))
+	{
+		throw std::invalid_argument("SpatialGrid cell size must be positive");
+	}
+}
+
+float SpatialGrid::getCellSize() const noexcept
+{
+	return m_cellSize;
+}
+
+std::size_t SpatialGrid::getDrawableCount() const noexcept
+{
+	return m_items.size();
+}
+
+bool SpatialGrid::contains(const sf::Drawable& drawable) const
+{
+	return m_itemIndices.find(&drawable) != m_itemIndices.end();
+}
+
+void SpatialGrid::insert(const sf::Drawable& drawable, const sf::FloatRect& bounds)
+{
+	const sf::FloatRect normalizedBounds = normalize(bounds);
+	const CellRange cells = getCellRange(normalizedBounds);
+
+	auto indexIter = m_itemIndices.find(&drawable);
+	if (indexIter == m_itemIndices.end())
+	{
+		m_itemIndices.emplace(&drawable, m_items.size());
+		m_items.push_back(Item{ &drawable, normalizedBounds, cells, 0 });
+		addToCells(m_items.size() - 1);
+		return;
+	}
+
+	// Only move the drawable between cells if it has left any of its cells
+	Item& item = m_items[indexIter->second];
+	item.bounds = normalizedBounds;
+	if (item.cells.left != cells.left || item.cells.top != cells.top || item.cells.right != cells.right || item.cells.bottom != cells.bottom)
+	{
+		removeFromCells(indexIter->second);
+		item.cells = cells;
+		addToCells(indexIter->second);
+	}
+}
+
+void SpatialGrid::remove(const sf::Drawable& drawable)
+{
+	auto indexIter = m_itemIndices.find(&drawable);
+	if (indexIter == m_itemIndices.end())
+	{
+		return;
+	}
+
+	const std::size_t removedIndex = indexIter->second;
+	const std::size_t lastIndex = m_items.size() - 1;
+	removeFromCells(removedIndex);
+	m_itemIndices.erase(indexIter);
+
+	// Fill the hole with the last item so that the items stay contiguous
+	if (removedIndex != lastIndex)
+	{
+		removeFromCells(lastIndex);
+		m_items[removedIndex] = m_items[lastIndex];
+		m_itemIndices[m_items[removedIndex].drawable] = removedIndex;
+		addToCells(removedIndex);
+	}
+	m_items.pop_back();
+}
+
+void SpatialGrid::clear()
+{
+	m_items.clear();
+	m_itemIndices.clear();
+	m_cells.clear();
+	m_oversizedItems.clear();
+}
+
+template <class Func>
+void SpatialGrid::forEachItemInArea(const sf::FloatRect& area, Func&& func) const
+{
+	const CellRange cells = getCellRange(area);
+
+	// Looking at every item is cheaper than looking up more cells than are occupied
+	if (getCellCount(cells) > static_cast<std::int64_t>(m_cells.size()))
+	{
+		std::for_each(m_items.begin(), m_items.end(), func);
+		return;
+	}
+
+	// Oversized items are not in any cell
+	for (std::size_t itemIndex : m_oversizedItems)
+	{
+		func(m_items[itemIndex]);
+	}
+
+	const std::uint64_t query = ++m_queryCount;
+
+	for (int x = cells.left; x <= cells.right; ++x)
+	{
+		for (int y = cells.top; y <= cells.bottom; ++y)
+		{
+			auto cellIter = m_cells.find(getCellKey(x, y));
+			if (cellIter == m_cells.end())
+			{
+				continue;
+			}
+
+			for (std::size_t itemIndex : cellIter->second)
+			{
+				const Item& item = m_items[itemIndex];
+				if (item.lastQuery != query)
+				{
+					item.lastQuery = query;
+					func(item);
+				}
+			}
+		}
+	}
+}
+
+void SpatialGrid::queryArea(const sf::FloatRect& area, std::vector<const sf::Drawable*>& results) const
+{
+	const sf::FloatRect normalizedArea = normalize(area);
+	forEachItemInArea(normalizedArea, [&normalizedArea, &results](const Item& item) {
+		if (item.bounds.intersects(normalizedArea))
+		{
+			results.push_back(item.drawable);
+		}
+	});
+}
+
+void SpatialGrid::queryPoint(const sf::Vector2f& point, std::vector<const sf::Drawable*>& results) const
+{
+	for (std::size_t itemIndex : m_oversizedItems)
+	{
+		const Item& item = m_items[itemIndex];
+		if (item.bounds.contains(point))
+		{
+			results.push_back(item.drawable);
+		}
+	}
+
+	// A point that is not a number is in no cell
+	if (std::isnan(point.x) || std::isnan(point.y))
+	{
+		return;
+	}
+
+	// A point is only ever in one cell, so there is nothing to deduplicate
+	auto cellIter = m_cells.find(getCellKey(getCellCoordinate(point.x), getCellCoordinate(point.y)));
+	if (cellIter == m_cells.end())
+	{
+		return;
+	}
+
+	for (std::size_t itemIndex : cellIter->second)
+	{
+		const Item& item = m_items[itemIndex];
+		if (item.bounds.contains(point))
+		{
+			results.push_back(item.drawable);
+		}
+	}
+}
+
+void SpatialGrid::queryRadius(const sf::Vector2f& center, float radius, std::vector<const sf::Drawable*>& results) const
+{
+	const sf::FloatRect area{ center.x - radius, center.y - radius, radius * 2.f, radius * 2.f };
+	forEachItemInArea(area, [&center, radius, &results](const Item& item) {
+		if (isWithinRadius(item.bounds, center, radius))
+		{
+			results.push_back(item.drawable);
+		}
+	});
+}
+
+bool SpatialGrid::isWithinRadius(const sf::FloatRect& bounds, const sf::Vector2f& center, float radius) noexcept
+{
+	const sf::FloatRect normalizedBounds = normalize(bounds);
+
+	// Distance from the center to the closest point of the bounds
+	const float closestX = std::clamp(center.x, normalizedBounds.left, normalizedBounds.left + normalizedBounds.width);
+	const float closestY = std::clamp(center.y, normalizedBounds.top, normalizedBounds.top + normalizedBounds.height);
+	const float distanceX = center.x - closestX;
+	const float distanceY = center.y - closestY;
+	return distanceX * distanceX + distanceY * distanceY <= radius * radius;
+}
+
+SpatialGrid::CellRange SpatialGrid::getCellRange(const sf::FloatRect& bounds) const
+{
+	const float right = bounds.left + bounds.width;
+	const float bottom = bounds.top + bounds.height;
+
+	// Bounds that are not a number could be anywhere
+	if (std::isnan(bounds.left) || std::isnan(bounds.top) || std::isnan(right) || std::isnan(bottom))
+	{
+		return CellRange{ MIN_CELL_COORDINATE, MIN_CELL_COORDINATE, MAX_CELL_COORDINATE, MAX_CELL_COORDINATE };
+	}
+
+	return CellRange{
+		getCellCoordinate(bounds.left),
+		getCellCoordinate(bounds.top),
+		getCellCoordinate(right),
+		getCellCoordinate(bottom)
+	};
+}
+
+int SpatialGrid::getCellCoordinate(float position) const
+{
+	// Infinite and huge positions are clamped instead of overflowing the int
+	const double cell = std::floor(static_cast<double>(position) / static_cast<double>(m_cellSize));
+	return static_cast<int>(std::clamp(cell, static_cast<double>(MIN_CELL_COORDINATE), static_cast<double>(MAX_CELL_COORDINATE)));
+}
+
+std::int64_t SpatialGrid::getCellCount(const CellRange& cells) noexcept
+{
+	return (static_cast<std::int64_t>(cells.right) - cells.left + 1) * (static_cast<std::int64_t>(cells.bottom) - cells.top + 1);
+}
+
+bool SpatialGrid::isOversized(const CellRange& cells) noexcept
+{
+	return getCellCount(cells) > MAX_CELLS_PER_DRAWABLE;
+}
+
+void SpatialGrid::addToCells(std::size_t itemIndex)
+{
+	const CellRange& cells = m_items[itemIndex].cells;
+	if (isOversized(cells))
+	{
+		m_oversizedItems.push_back(itemIndex);
+		return;
+	}
+
+	for (int x = cells.left; x <= cells.right; ++x)
+	{
+		for (int y = cells.top; y <= cells.bottom; ++y)
+		{
+			m_cells[getCellKey(x, y)].push_back(itemIndex);
+		}
+	}
+}
+
+void SpatialGrid::removeFromCells(std::size_t itemIndex)
+{
+	const CellRange& cells = m_items[itemIndex].cells;
+	if (isOversized(cells))
+	{
+		auto itemIter = std::find(m_oversizedItems.begin(), m_oversizedItems.end(), itemIndex);
+		*itemIter = m_oversizedItems.back();
+		m_oversizedItems.pop_back();
+		return;
+	}
+
+	for (int x = cells.left; x <= cells.right; ++x)
+	{
+		for (int y = cells.top; y <= cells.bottom; ++y)
+		{
+			auto cellIter = m_cells.find(getCellKey(x, y));
+			std::vector<std::size_t>& cell = cellIter->second;
+
+			// Order within a cell does not matter. Swap the item to the back and remove it.
+			auto itemIter = std::find(cell.begin(), cell.end(), itemIndex);
+			*itemIter = cell.back();
+			cell.pop_back();
+			if (cell.empty())
+			{
+				m_cells.erase(cellIter);
+			}
+		}
+	}
+}
@@ -0,0 +1,252 @@
+#include <GameBackbone/Core/TextureAtlas.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+using namespace GB;
+
+namespace
+{
+	/// @brief A row of images in a page. Every image in the shelf is at most as tall as the shelf.
+	struct Shelf {
+		unsigned int top;
+		unsigned int height;
+		unsigned int usedWidth;
+	};
+
+	/// @brief A page being packed.
+	struct PageLayout {
+		std::vector<Shelf> shelves;
+		unsigned int usedHeight = 0;
+		sf::Vector2u extent{ 0, 0 };
+	};
+
+	/// @brief Returns the first shelf of the page with room for an image of size. Opens a new shelf if no shelf has room.
+	///		Returns nullptr if the page is full.
+	Shelf* findShelf(PageLayout& page, sf::Vector2u size, unsigned int paddedHeight, unsigned int maxPageSize)
+	{
+		for (Shelf& shelf : page.shelves)
+		{
+			if (shelf.height >= size.y && maxPageSize - shelf.usedWidth >= size.x)
+			{
+				return &shelf;
+			}
+		}
+		if (maxPageSize - page.usedHeight >= size.y)
+		{
+			page.shelves.push_back(Shelf{ page.usedHeight, paddedHeight, 0 });
+			page.usedHeight = std::min(page.usedHeight + paddedHeight, maxPageSize);
+			return &page.shelves.back();
+		}
+		return nullptr;
+	}
+
+	/// @brief Returns frame moved into region. Throws if frame is not inside the region.
+	sf::IntRect moveIntoRegion(const sf::IntRect& frame, const sf::IntRect& region)
+	{
+		if (frame.left < 0 || frame.top < 0 || frame.width < 0 || frame.height < 0 ||
+			frame.left + frame.width > region.width || frame.top + frame.height > region.height)
+		{
+			throw std::out_of_range("The frame is not inside of the atlas image.");
+		}
+		return sf::IntRect(frame.left + region.left, frame.top + region.top, frame.width, frame.height);
+	}
+}
+
+std::size_t TextureAtlas::getPageCount() const noexcept
+{
+	return m_textures.size();
+}
+
+const sf::Texture& TextureAtlas::getTexture(std::size_t page) const
+{
+	return m_textures.at(page);
+}
+
+const sf::Image& TextureAtlas::getPageImage(std::size_t page) const
+{
+	return m_pageImages.at(page);
+}
+
+void TextureAtlas::releasePageImages()
+{
+	m_pageImages.clear();
+	m_pageImages.shrink_to_fit();
+}
+
+bool TextureAtlas::containsImage(const std::string& name) const
+{
+	return m_regions.find(name) != m_regions.end();
+}
+
+const TextureAtlas::Region& TextureAtlas::getRegion(const std::string& name) const
+{
+	auto regionIter = m_regions.find(name);
+	if (regionIter == m_regions.end())
+	{
+		throw std::out_of_range("There is no image named " + name + " in the atlas.");
+	}
+	return regionIter->second;
+}
+
+const sf::Texture& TextureAtlas::getTexture(const std::string& name) const
+{
+	return m_textures[getRegion(name).page];
+}
+
+AnimationSet::Ptr TextureAtlas::makeAnimationSet(const std::string& name, const AnimationSet& animations) const
+{
+	const sf::IntRect& bounds = getRegion(name).bounds;
+
+	auto atlasAnimations = std::make_shared<AnimationSet>();
+	atlasAnimations->reserve(animations.getSize(), animations.getFrameCount());
+	Animation frames;
+	for (const AnimationView& animation : animations)
+	{
+		frames.clear();
+		for (const sf::IntRect& frame : animation)
+		{
+			frames.push_back(moveIntoRegion(frame, bounds));
+		}
+		atlasAnimations->addAnimation(frames);
+	}
+	return atlasAnimations;
+}
+
+UniformAnimationSet::Ptr TextureAtlas::makeUniformAnimationSet(const std::string& name, sf::Vector2i frameSize, const std::vector<UniformAnimation>& animations) const
+{
+	const sf::IntRect& bounds = getRegion(name).bounds;
+
+	auto atlasAnimations = std::make_shared<UniformAnimationSet>(frameSize);
+	Animation frames;
+	for (const UniformAnimation& animation : animations)
+	{
+		frames.clear();
+		for (const sf::Vector2i& frameIndex : animation)
+		{
+			const sf::IntRect frame(sf::Vector2i(frameIndex.x * frameSize.x, frameIndex.y * frameSize.y), frameSize);
+			frames.push_back(moveIntoRegion(frame, bounds));
+		}
+		atlasAnimations->addAnimation(frames);
+	}
+	return atlasAnimations;
+}
+
+TextureAtlasBuilder::TextureAtlasBuilder(unsigned int maxPageSize, unsigned int padding) :
+	m_maxPageSize(maxPageSize),
+	m_padding(padding)
+{
+}
+
+void TextureAtlasBuilder::addImage(std::string name, sf::Image image)
+{
+	const sf::Vector2u size = image.getSize();
+	if (size.x == 0 || size.y == 0)
+	{
+		throw std::invalid_argument("Cannot add the empty image " + name + " to an atlas.");
+	}
+	if (size.x > m_maxPageSize || size.y > m_maxPageSize)
+	{
+		throw std::invalid_argument("The image " + name + " is larger than an atlas page.");
+	}
+	auto sameName = [&name](const PendingImage& pending) { return pending.name == name; };
+	if (std::any_of(m_images.begin(), m_images.end(), sameName))
+	{
+		throw std::invalid_argument("An image named " + name + " was already added to the atlas.");
+	}
+
+	m_images.push_back(PendingImage{ std::move(name), std::move(image) });
+}
+
+void TextureAtlasBuilder::addImageFromFile(std::string name, const std::string& path)
+{
+	sf::Image image;
+	if (!image.loadFromFile(path))
+	{
+		throw std::runtime_error("Could not load the atlas image " + path + ".");
+	}
+	addImage(std::move(name), std::move(image));
+}
+
+std::size_t TextureAtlasBuilder::getImageCount() const noexcept
+{
+	return m_images.size();
+}
+
+TextureAtlas TextureAtlasBuilder::build()
+{
+	// Place the tallest images first so that each shelf wastes little height
+	std::vector<std::size_t> order(m_images.size());
+	std::iota(order.begin(), order.end(), std::size_t{ 0 });
+	std::stable_sort(order.begin(), order.end(), [this](std::size_t left, std::size_t right) {
+		const sf::Vector2u leftSize = m_images[left].image.getSize();
+		const sf::Vector2u rightSize = m_images[right].image.getSize();
+		return leftSize.y != rightSize.y ? leftSize.y > rightSize.y : leftSize.x > rightSize.x;
+	});
+
+	TextureAtlas atlas;
+	std::vector<PageLayout> pages;
+	for (std::size_t imageIndex : order)
+	{
+		const sf::Vector2u size = m_images[imageIndex].image.getSize();
+		const unsigned int paddedWidth = std::min(size.x + m_padding, m_maxPageSize);
+		const unsigned int paddedHeight = std::min(size.y + m_padding, m_maxPageSize);
+
+		// First fit: the first page with room, then a new page
+		std::size_t pageIndex = 0;
+		Shelf* targetShelf = nullptr;
+		for (; pageIndex < pages.size(); ++pageIndex)
+		{
+			targetShelf = findShelf(pages[pageIndex], size, paddedHeight, m_maxPageSize);
+			if (targetShelf != nullptr)
+			{
+				break;
+			}
+		}
+		if (targetShelf == nullptr)
+		{
+			// Every image fits on an empty page
+			targetShelf = findShelf(pages.emplace_back(), size, paddedHeight, m_maxPageSize);
+		}
+
+		const sf::Vector2u position(targetShelf->usedWidth, targetShelf->top);
+		targetShelf->usedWidth = std::min(targetShelf->usedWidth + paddedWidth, m_maxPageSize);
+
+		PageLayout& page = pages[pageIndex];
+		page.extent.x = std::max(page.extent.x, position.x + size.x);
+		page.extent.y = std::max(page.extent.y, position.y + size.y);
+
+		atlas.m_regions.emplace(m_images[imageIndex].name, TextureAtlas::Region{
+			pageIndex,
+			sf::IntRect(static_cast<int>(position.x), static_cast<int>(position.y), static_cast<int>(size.x), static_cast<int>(size.y))
+		});
+	}
+
+	// Copy the pixels of every image into its page. Pages are cropped to the images on them.
+	atlas.m_pageImages.resize(pages.size());
+	for (std::size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex)
+	{
+		atlas.m_pageImages[pageIndex].create(pages[pageIndex].extent.x, pages[pageIndex].extent.y, sf::Color::Transparent);
+	}
+	for (const PendingImage& pending : m_images)
+	{
+		const TextureAtlas::Region& region = atlas.m_regions.at(pending.name);
+		atlas.m_pageImages[region.page].copy(pending.image,
+			static_cast<unsigned int>(region.bounds.left), static_cast<unsigned int>(region.bounds.top));
+	}
+
+	atlas.m_textures.resize(pages.size());
+	for (std::size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex)
+	{
+		if (!atlas.m_textures[pageIndex].loadFromImage(atlas.m_pageImages[pageIndex]))
+		{
+			throw std::runtime_error("Could not create an atlas page texture.");
+		}
+	}
+
+	m_images.clear();
+	return atlas;
+}
@@ -0,0 +1,280 @@
+#include <GameBackbone/Core/TextureLoader.h>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+using namespace GB;
+
+/// @brief A texture shared by every TextureHandle to it.
+struct TextureHandle::Entry {
+	std::string path;
+	sf::Texture texture;
+	std::atomic<TextureLoadState> state{ TextureLoadState::Loading };
+	// Only touched by the thread that draws
+	std::vector<TextureLoader::LoadedCallback> callbacks;
+};
+
+namespace
+{
+	/// @brief Returns the placeholder used when none is provided.
+	sf::Image makeTransparentPlaceholder()
+	{
+		sf::Image placeholder;
+		placeholder.create(1, 1, sf::Color::Transparent);
+		return placeholder;
+	}
+}
+
+TextureHandle::TextureHandle(std::shared_ptr<Entry> entry) : m_entry(std::move(entry))
+{
+}
+
+const sf::Texture& TextureHandle::getTexture() const
+{
+	if (!m_entry)
+	{
+		throw std::runtime_error("The TextureHandle does not refer to a texture.");
+	}
+	return m_entry->texture;
+}
+
+TextureLoadState TextureHandle::getState() const
+{
+	if (!m_entry)
+	{
+		throw std::runtime_error("The TextureHandle does not refer to a texture.");
+	}
+	return m_entry->state.load(std::memory_order_acquire);
+}
+
+const std::string& TextureHandle::getPath() const
+{
+	if (!m_entry)
+	{
+		throw std::runtime_error("The TextureHandle does not refer to a texture.");
+	}
+	return m_entry->path;
+}
+
+TextureHandle::operator bool() const noexcept
+{
+	return m_entry != nullptr;
+}
+
+void TextureHandle::addLoadedCallback(std::function<void(const TextureHandle&)> onLoaded) const
+{
+	if (getState() == TextureLoadState::Loading)
+	{
+		m_entry->callbacks.push_back(std::move(onLoaded));
+	}
+	else
+	{
+		onLoaded(*this);
+	}
+}
+
+TextureLoader::TextureLoader(std::size_t workerCount) : TextureLoader(workerCount, makeTransparentPlaceholder())
+{
+}
+
+TextureLoader::TextureLoader(std::size_t workerCount, const sf::Image& placeholder) :
+	m_placeholder(placeholder)
+{
+	if (workerCount == 0)
+	{
+		// Leave a hardware thread for the thread that draws
+		const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+		workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	m_workers.reserve(workerCount);
+	for (std::size_t ii = 0; ii < workerCount; ++ii)
+	{
+		m_workers.emplace_back([this]() { decodeImages(); });
+	}
+}
+
+TextureLoader::~TextureLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shouldStop = true;
+	}
+	m_decodeCondition.notify_all();
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+TextureHandle TextureLoader::load(const std::string& path, LoadedCallback onLoaded)
+{
+	auto entryIter = m_entries.find(path);
+	if (entryIter != m_entries.end())
+	{
+		if (std::shared_ptr<TextureHandle::Entry> entry = entryIter->second.lock())
+		{
+			TextureHandle handle(std::move(entry));
+			if (onLoaded)
+			{
+				handle.addLoadedCallback(std::move(onLoaded));
+			}
+			return handle;
+		}
+	}
+
+	auto entry = std::make_shared<TextureHandle::Entry>();
+	entry->path = path;
+	// Show the placeholder until the image is uploaded
+	entry->texture.loadFromImage(m_placeholder);
+	if (onLoaded)
+	{
+		entry->callbacks.push_back(std::move(onLoaded));
+	}
+	m_entries[path] = entry;
+	++m_pendingCount;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_decodeQueue.push_back(entry);
+	}
+	m_decodeCondition.notify_one();
+	return TextureHandle(std::move(entry));
+}
+
+void TextureLoader::decodeImages()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_decodeCondition.wait(lock, [this]() { return !m_decodeQueue.empty() || m_shouldStop; });
+		if (m_shouldStop)
+		{
+			return;
+		}
+
+		DecodedImage decoded{ std::move(m_decodeQueue.front()), sf::Image{}, false };
+		m_decodeQueue.pop_front();
+		++m_decodingCount;
+
+		// Decode without holding the lock so that other workers and the thread that draws can continue
+		lock.unlock();
+		decoded.isValid = decoded.image.loadFromFile(decoded.entry->path);
+		lock.lock();
+
+		--m_decodingCount;
+		m_decodedImages.push_back(std::move(decoded));
+		m_decodedCondition.notify_all();
+	}
+}
+
+std::size_t TextureLoader::uploadPending(std::size_t uploadBudget)
+{
+	std::size_t uploadedBytes = 0;
+	do
+	{
+		if (!m_upload)
+		{
+			DecodedImage decoded;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_decodedImages.empty())
+				{
+					break;
+				}
+				decoded = std::move(m_decodedImages.front());
+				m_decodedImages.pop_front();
+			}
+
+			const sf::Vector2u size = decoded.image.getSize();
+			if (!decoded.isValid || size.x == 0 || size.y == 0)
+			{
+				finishEntry(decoded.entry, TextureLoadState::Failed);
+				continue;
+			}
+
+			// Nobody is waiting for the texture anymore
+			if (decoded.entry.use_count() == 1)
+			{
+				finishEntry(decoded.entry, TextureLoadState::Failed);
+				continue;
+			}
+
+			m_upload = std::make_unique<Upload>();
+			m_upload->decoded = std::move(decoded);
+			m_upload->nextRow = 0;
+			if (!m_upload->staging.create(size.x, size.y))
+			{
+				finishEntry(std::exchange(m_upload, nullptr)->decoded.entry, TextureLoadState::Failed);
+				continue;
+			}
+		}
+
+		uploadedBytes += continueUpload(uploadBudget > uploadedBytes ? uploadBudget - uploadedBytes : 0);
+	} while (uploadedBytes < uploadBudget);
+
+	return uploadedBytes;
+}
+
+std::size_t TextureLoader::continueUpload(std::size_t uploadBudget)
+{
+	const sf::Image& image = m_upload->decoded.image;
+	const sf::Vector2u size = image.getSize();
+	const std::size_t rowBytes = std::size_t{ size.x } * 4;
+
+	// Always copy at least one row so that a small budget cannot stall loading
+	const std::size_t remainingRows = size.y - m_upload->nextRow;
+	const std::size_t rowCount = std::min(remainingRows, std::max<std::size_t>(uploadBudget / rowBytes, 1));
+	m_upload->staging.update(image.getPixelsPtr() + m_upload->nextRow * rowBytes,
+		size.x, static_cast<unsigned int>(rowCount), 0, m_upload->nextRow);
+	m_upload->nextRow += static_cast<unsigned int>(rowCount);
+
+	if (m_upload->nextRow == size.y)
+	{
+		// Replace the placeholder all at once so that a half copied image is never drawn.
+		// Texture rects sized to the placeholder are reset by GB::LoadingSprite, not here.
+		std::unique_ptr<Upload> upload = std::move(m_upload);
+		upload->decoded.entry->texture.swap(upload->staging);
+		finishEntry(upload->decoded.entry, TextureLoadState::Loaded);
+	}
+	return rowCount * rowBytes;
+}
+
+void TextureLoader::finishEntry(const std::shared_ptr<TextureHandle::Entry>& entry, TextureLoadState state)
+{
+	entry->state.store(state, std::memory_order_release);
+	--m_pendingCount;
+
+	const TextureHandle handle(entry);
+	std::vector<LoadedCallback> callbacks = std::move(entry->callbacks);
+	for (const LoadedCallback& callback : callbacks)
+	{
+		callback(handle);
+	}
+}
+
+void TextureLoader::finishLoading()
+{
+	while (m_pendingCount > 0)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_decodedCondition.wait(lock, [this]() { return !m_decodedImages.empty() || m_upload != nullptr; });
+		}
+		uploadPending(static_cast<std::size_t>(-1));
+	}
+}
+
+std::size_t TextureLoader::getPendingCount() const
+{
+	return m_pendingCount;
+}
+
+std::size_t TextureLoader::getWorkerCount() const noexcept
+{
+	return m_workers.size();
+}
@@ -0,0 +1,248 @@
+#include <GameBackbone/Core/UpdateScheduler.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace GB;
+
+UpdateScheduler::UpdateScheduler(std::size_t threadCount) : m_phases(1)
+{
+	if (threadCount == 0)
+	{
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	m_queues.reserve(threadCount);
+	for (std::size_t ii = 0; ii < threadCount; ++ii)
+	{
+		m_queues.push_back(std::make_unique<WorkQueue>());
+	}
+
+	// The thread that calls update is the first thread
+	m_workers.reserve(threadCount - 1);
+	for (std::size_t ii = 1; ii < threadCount; ++ii)
+	{
+		m_workers.emplace_back([this, ii]() { runWorker(ii); });
+	}
+}
+
+UpdateScheduler::~UpdateScheduler()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_shouldStop = true;
+	}
+	m_startCondition.notify_all();
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+std::size_t UpdateScheduler::addPhase()
+{
+	m_phases.emplace_back();
+	return m_phases.size() - 1;
+}
+
+std::size_t UpdateScheduler::getPhaseCount() const noexcept
+{
+	return m_phases.size();
+}
+
+void UpdateScheduler::addUpdatable(Updatable& updatable, std::size_t phase)
+{
+	m_phases.at(phase).push_back(&updatable);
+}
+
+void UpdateScheduler::removeUpdatable(const Updatable& updatable)
+{
+	for (std::vector<Updatable*>& phase : m_phases)
+	{
+		phase.erase(std::remove(phase.begin(), phase.end(), &updatable), phase.end());
+	}
+}
+
+void UpdateScheduler::clearUpdatables()
+{
+	for (std::vector<Updatable*>& phase : m_phases)
+	{
+		phase.clear();
+	}
+}
+
+std::size_t UpdateScheduler::getUpdatableCount() const noexcept
+{
+	std::size_t count = 0;
+	for (const std::vector<Updatable*>& phase : m_phases)
+	{
+		count += phase.size();
+	}
+	return count;
+}
+
+std::size_t UpdateScheduler::getThreadCount() const noexcept
+{
+	return m_queues.size();
+}
+
+void UpdateScheduler::setChunkSize(std::size_t chunkSize)
+{
+	if (chunkSize == 0)
+	{
+		throw std::invalid_argument("The chunk size must be positive.");
+	}
+	m_chunkSize = chunkSize;
+}
+
+std::size_t UpdateScheduler::getChunkSize() const noexcept
+{
+	return m_chunkSize;
+}
+
+void UpdateScheduler::update(sf::Int64 elapsedTime)
+{
+	for (const std::vector<Updatable*>& phase : m_phases)
+	{
+		updatePhase(phase, elapsedTime);
+		if (m_error)
+		{
+			std::rethrow_exception(std::exchange(m_error, nullptr));
+		}
+	}
+}
+
+void UpdateScheduler::updatePhase(const std::vector<Updatable*>& phase, sf::Int64 elapsedTime)
+{
+	const std::size_t chunkCount = (phase.size() + m_chunkSize - 1) / m_chunkSize;
+	const std::size_t threadCount = m_queues.size();
+
+	// Waking the workers costs more than it saves for a single chunk
+	if (threadCount == 1 || chunkCount <= 1)
+	{
+		for (Updatable* updatable : phase)
+		{
+			try
+			{
+				updatable->update(elapsedTime);
+			}
+			catch (...)
+			{
+				if (!m_error)
+				{
+					m_error = std::current_exception();
+				}
+			}
+		}
+		return;
+	}
+
+	m_elapsedTime = elapsedTime;
+	m_remainingChunks.store(chunkCount, std::memory_order_relaxed);
+
+	// Give each thread an equal run of consecutive chunks so that most threads never need to steal
+	Updatable* const* phaseBegin = phase.data();
+	Updatable* const* phaseEnd = phase.data() + phase.size();
+	for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+	{
+		const std::size_t firstChunk = threadIndex * chunkCount / threadCount;
+		const std::size_t lastChunk = (threadIndex + 1) * chunkCount / threadCount;
+
+		WorkQueue& queue = *m_queues[threadIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		for (std::size_t chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex)
+		{
+			Updatable* const* first = phaseBegin + chunkIndex * m_chunkSize;
+			queue.chunks.push_back(Chunk{ first, std::min(first + m_chunkSize, phaseEnd) });
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_generation;
+	}
+	m_startCondition.notify_all();
+
+	runChunks(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCondition.wait(lock, [this]() { return m_remainingChunks.load(std::memory_order_acquire) == 0; });
+}
+
+void UpdateScheduler::runWorker(std::size_t threadIndex)
+{
+	std::uint64_t seenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_startCondition.wait(lock, [this, seenGeneration]() { return m_shouldStop || m_generation != seenGeneration; });
+			if (m_shouldStop)
+			{
+				return;
+			}
+			seenGeneration = m_generation;
+		}
+		runChunks(threadIndex);
+	}
+}
+
+void UpdateScheduler::runChunks(std::size_t threadIndex)
+{
+	Chunk chunk{};
+	while (takeChunk(threadIndex, chunk))
+	{
+		for (Updatable* const* updatable = chunk.first; updatable != chunk.last; ++updatable)
+		{
+			try
+			{
+				(*updatable)->update(m_elapsedTime);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_error)
+				{
+					m_error = std::current_exception();
+				}
+			}
+		}
+
+		// The last chunk wakes the thread that called update
+		if (m_remainingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_doneCondition.notify_all();
+		}
+	}
+}
+
+bool UpdateScheduler::takeChunk(std::size_t threadIndex, Chunk& chunk)
+{
+	{
+		WorkQueue& ownQueue = *m_queues[threadIndex];
+		std::lock_guard<std::mutex> lock(ownQueue.mutex);
+		if (!ownQueue.chunks.empty())
+		{
+			chunk = ownQueue.chunks.front();
+			ownQueue.chunks.pop_front();
+			return true;
+		}
+	}
+
+	// Steal from the back of the other queues, furthest from where their owners are working
+	const std::size_t threadCount = m_queues.size();
+	for (std::size_t offset = 1; offset < threadCount; ++offset)
+	{
+		WorkQueue& victimQueue = *m_queues[(threadIndex + offset) % threadCount];
+		std::lock_guard<std::mutex> lock(victimQueue.mutex);
+		if (!victimQueue.chunks.empty())
+		{
+			chunk = victimQueue.chunks.back();
+			victimQueue.chunks.pop_back();
+			return true;
+		}
+	}
+	return false;
+}
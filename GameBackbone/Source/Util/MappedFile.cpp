@@ -0,0 +1,138 @@
+#include <GameBackbone/Util/MappedFile.h>
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+using namespace GB;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+{
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw std::runtime_error("Could not open " + path + ".");
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		CloseHandle(file);
+		throw std::runtime_error("Could not read the size of " + path + ".");
+	}
+	m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+	// An empty file cannot be mapped
+	if (m_size != 0)
+	{
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping != nullptr)
+		{
+			m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			// The view keeps the mapping alive
+			CloseHandle(mapping);
+		}
+		if (m_data == nullptr)
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Could not map " + path + " into memory.");
+		}
+	}
+	CloseHandle(file);
+}
+
+void MappedFile::unmap() noexcept
+{
+	if (m_data != nullptr)
+	{
+		UnmapViewOfFile(m_data);
+	}
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+{
+	const int file = open(path.c_str(), O_RDONLY);
+	if (file == -1)
+	{
+		throw std::runtime_error("Could not open " + path + ".");
+	}
+
+	struct stat fileStatus {};
+	if (fstat(file, &fileStatus) == -1)
+	{
+		close(file);
+		throw std::runtime_error("Could not read the size of " + path + ".");
+	}
+	m_size = static_cast<std::size_t>(fileStatus.st_size);
+
+	// An empty file cannot be mapped
+	if (m_size != 0)
+	{
+		void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (data == MAP_FAILED)
+		{
+			close(file);
+			throw std::runtime_error("Could not map " + path + " into memory.");
+		}
+		m_data = static_cast<const char*>(data);
+	}
+	// The mapping stays valid after the file is closed
+	close(file);
+}
+
+void MappedFile::unmap() noexcept
+{
+	if (m_data != nullptr)
+	{
+		munmap(const_cast<char*>(m_data), m_size);
+	}
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+	m_data(std::exchange(other.m_data, nullptr)),
+	m_size(std::exchange(other.m_size, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		unmap();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+	}
+	return *this;
+}
+
+MappedFile::~MappedFile()
+{
+	unmap();
+}
+
+const char* MappedFile::getData() const noexcept
+{
+	return m_data;
+}
+
+std::size_t MappedFile::getSize() const noexcept
+{
+	return m_size;
+}
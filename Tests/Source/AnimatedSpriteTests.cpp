@@ -503,10 +503,91 @@ BOOST_FIXTURE_TEST_CASE(AnimatedSprite_multiple_updates_require_time_to_pass, Re
 BOOST_FIXTURE_TEST_CASE(AnimatedSprite_getCurrentAnimation_returns_correct_animation, ReusableObjects) {
 	const int animToRun = 0;
 	animSpriteWithAnim->runAnimation(animToRun);
-	BOOST_CHECK(animSpriteWithAnim->getCurrentAnimation() == &animSet->at(animToRun));
+	BOOST_REQUIRE(animSpriteWithAnim->getCurrentAnimation() != nullptr);
+	BOOST_CHECK(animSpriteWithAnim->getCurrentAnimation()->data() == animSet->at(animToRun).data());
 }
 
 BOOST_AUTO_TEST_SUITE_END() // end AnimatedSprite_Animations
 
+// Contains all of the tests for AnimatedSprite frame skipping
+BOOST_AUTO_TEST_SUITE(AnimatedSprite_FrameSkipping)
+
+// Ensure that frame skipping is disabled by default and only one frame is advanced per update
+BOOST_FIXTURE_TEST_CASE(AnimatedSprite_FrameSkipping_Disabled_By_Default, ReusableObjects) {
+	BOOST_CHECK(!animSpriteWithAnim->isFrameSkippingEnabled());
+	animSpriteWithAnim->runAnimation(0);
+	animSpriteWithAnim->setAnimationDelay(sf::microseconds(10));
+	animSpriteWithAnim->update(35);
+
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getCurrentFrame(), 1u);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getFramesSpentInCurrentAnimation(), 1u);
+}
+
+// Ensure that one frame is advanced for every elapsed delay and that the left over time is kept
+BOOST_FIXTURE_TEST_CASE(AnimatedSprite_FrameSkipping_Carries_Leftover_Time, ReusableObjects) {
+	animSpriteWithAnim->setFrameSkippingEnabled(true);
+	animSpriteWithAnim->runAnimation(0);
+	animSpriteWithAnim->setAnimationDelay(sf::microseconds(10));
+
+	// three full delays and 5us left over
+	animSpriteWithAnim->update(35);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getCurrentFrame(), 3u);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getFramesSpentInCurrentAnimation(), 3u);
+	BOOST_CHECK(animSpriteWithAnim->getTextureRect() == animSpriteAnimTextureFrameRects[3]);
+
+	// the left over time plus 5us is not more than the delay
+	animSpriteWithAnim->update(5);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getCurrentFrame(), 3u);
+
+	// the left over time pushes the animation over the edge and loops it
+	animSpriteWithAnim->update(1);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getCurrentFrame(), 0u);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getFramesSpentInCurrentAnimation(), 4u);
+}
+
+// Ensure that a stopping animation does not move past its last frame however much time passes
+BOOST_FIXTURE_TEST_CASE(AnimatedSprite_FrameSkipping_Stop, ReusableObjects) {
+	animSpriteWithAnim->setFrameSkippingEnabled(true);
+	animSpriteWithAnim->runAnimation(0, ANIMATION_STOP);
+	animSpriteWithAnim->setAnimationDelay(sf::microseconds(1));
+	animSpriteWithAnim->update(100);
+
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getCurrentFrame(), animSet->at(0).size() - 1);
+	BOOST_CHECK_EQUAL(animSpriteWithAnim->getFramesSpentInCurrentAnimation(), 99u);
+}
+
+// Ensure that advancing many frames in one update is the same as advancing one frame per update
+BOOST_FIXTURE_TEST_CASE(AnimatedSprite_FrameSkipping_Matches_Single_Frame_Updates, ReusableObjects) {
+	for (ANIMATION_END_TYPE endType : { ANIMATION_LOOP, ANIMATION_REVERSE, ANIMATION_STOP })
+	{
+		AnimatedSprite singleFrameSprite(*aSpriteTexture, animSet);
+		singleFrameSprite.runAnimation(0, endType);
+		singleFrameSprite.setAnimationDelay(sf::microseconds(10));
+
+		for (unsigned int frameCount = 1; frameCount < 20; ++frameCount)
+		{
+			singleFrameSprite.update(11);
+
+			AnimatedSprite skippingSprite(*aSpriteTexture, animSet);
+			skippingSprite.setFrameSkippingEnabled(true);
+			skippingSprite.runAnimation(0, endType);
+			skippingSprite.setAnimationDelay(sf::microseconds(10));
+			skippingSprite.update(frameCount * 10 + 1);
+
+			BOOST_CHECK_EQUAL(skippingSprite.getCurrentFrame(), singleFrameSprite.getCurrentFrame());
+			BOOST_CHECK_EQUAL(skippingSprite.getFramesSpentInCurrentAnimation(), frameCount);
+			BOOST_CHECK(skippingSprite.getTextureRect() == singleFrameSprite.getTextureRect());
+
+			// both sprites must keep moving the same way afterwards
+			AnimatedSprite nextSingleFrameSprite = singleFrameSprite;
+			nextSingleFrameSprite.update(11);
+			skippingSprite.update(10);
+			BOOST_CHECK_EQUAL(skippingSprite.getCurrentFrame(), nextSingleFrameSprite.getCurrentFrame());
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end AnimatedSprite_FrameSkipping
+
 // Keep at end of file
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
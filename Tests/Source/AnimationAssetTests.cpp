@@ -0,0 +1,200 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/AnimationAsset.h>
+#include <GameBackbone/Core/AnimationSet.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(AnimationAssetTests)
+
+	/// @brief Returns a builder with two animations and two regions.
+	AnimationAssetBuilder makeBuilder()
+	{
+		AnimationAssetBuilder builder;
+		builder.addAnimation(Animation{ { 0, 0, 16, 16 }, { 16, 0, 16, 16 }, { 32, 0, 16, 16 } });
+		builder.addAnimation(Animation{ { 0, 16, 32, 16 } });
+		builder.addRegion("sheet", 0, sf::IntRect(0, 0, 64, 32));
+		builder.addRegion("hero", 1, sf::IntRect(64, 0, 16, 16));
+		return builder;
+	}
+
+	/// @brief Checks that the asset holds the contents of makeBuilder.
+	void checkAsset(const AnimationAsset& asset)
+	{
+		BOOST_REQUIRE_EQUAL(asset.getAnimationCount(), 2u);
+		BOOST_CHECK_EQUAL(asset.getFrameCount(), 4u);
+		BOOST_CHECK(asset.at(0) == Animation({ { 0, 0, 16, 16 }, { 16, 0, 16, 16 }, { 32, 0, 16, 16 } }));
+		BOOST_CHECK(asset.at(1) == Animation({ { 0, 16, 32, 16 } }));
+
+		BOOST_REQUIRE_EQUAL(asset.getRegionCount(), 2u);
+		const AnimationAsset::Region hero = asset.getRegion("hero");
+		BOOST_CHECK(hero.name == "hero");
+		BOOST_CHECK_EQUAL(hero.page, 1u);
+		BOOST_CHECK(hero.bounds == sf::IntRect(64, 0, 16, 16));
+		BOOST_CHECK(asset.getRegion("sheet").bounds == sf::IntRect(0, 0, 64, 32));
+		// Regions are sorted by name
+		BOOST_CHECK(asset.getRegion(std::size_t{ 0 }).name == "hero");
+	}
+
+	BOOST_AUTO_TEST_SUITE(AnimationAsset_Binary)
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_LoadFromMemory_RoundTrips)
+		{
+			const AnimationAsset asset = AnimationAsset::loadFromMemory(makeBuilder().toBinary());
+			checkAsset(asset);
+			BOOST_CHECK(asset.containsRegion("sheet"));
+			BOOST_CHECK(!asset.containsRegion("she"));
+			BOOST_CHECK_THROW(static_cast<void>(asset.getRegion("missing")), std::out_of_range);
+			BOOST_CHECK_THROW(static_cast<void>(asset.at(2)), std::out_of_range);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_Frames_PointIntoAsset)
+		{
+			const std::vector<char> binary = makeBuilder().toBinary();
+			const AnimationAsset asset = AnimationAsset::loadFromMemory(binary);
+
+			// The second animation starts right after the three frames of the first
+			BOOST_CHECK(asset[1].data() == asset[0].data() + 3);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_LoadFromFile_MapsFile)
+		{
+			const std::string path = "AnimationAssetTests.gbanim";
+			{
+				std::ofstream output(path, std::ios::binary);
+				makeBuilder().writeBinary(output);
+			}
+
+			{
+				AnimationAsset asset = AnimationAsset::loadFromFile(path);
+				checkAsset(asset);
+
+				// Moving the asset keeps the mapping alive
+				const AnimationAsset movedAsset = std::move(asset);
+				checkAsset(movedAsset);
+				BOOST_CHECK_EQUAL(asset.getAnimationCount(), 0u);
+			}
+			std::remove(path.c_str());
+
+			BOOST_CHECK_THROW(AnimationAsset::loadFromFile("missing.gbanim"), std::runtime_error);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_MakeAnimationSet_CopiesAnimations)
+		{
+			AnimationSet::Ptr animations;
+			{
+				const AnimationAsset asset = AnimationAsset::loadFromMemory(makeBuilder().toBinary());
+				animations = asset.makeAnimationSet();
+			}
+
+			BOOST_REQUIRE_EQUAL(animations->getSize(), 2u);
+			BOOST_CHECK(animations->at(0).at(2) == sf::IntRect(32, 0, 16, 16));
+			BOOST_CHECK(animations->at(1) == Animation({ { 0, 16, 32, 16 } }));
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_Empty)
+		{
+			const AnimationAsset asset = AnimationAsset::loadFromMemory(AnimationAssetBuilder{}.toBinary());
+			BOOST_CHECK_EQUAL(asset.getAnimationCount(), 0u);
+			BOOST_CHECK_EQUAL(asset.getRegionCount(), 0u);
+			BOOST_CHECK(!asset.containsRegion("sheet"));
+			BOOST_CHECK(asset.makeAnimationSet()->isEmpty());
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAsset_InvalidData_Throws)
+		{
+			const std::vector<char> binary = makeBuilder().toBinary();
+
+			std::vector<char> wrongMagic = binary;
+			wrongMagic[0] = 'X';
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory(wrongMagic), std::runtime_error);
+
+			std::vector<char> truncated = binary;
+			truncated.pop_back();
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory(truncated), std::runtime_error);
+
+			// The version follows the magic and the byte order mark
+			std::vector<char> newerVersion = binary;
+			newerVersion[8] = static_cast<char>(AnimationAsset::FormatVersion + 1);
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory(newerVersion), std::runtime_error);
+
+			// The first animation range follows the 32 byte header
+			std::vector<char> badRange = binary;
+			badRange[32] = 3;
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory(badRange), std::runtime_error);
+
+			// The two 32 byte region records follow the ranges and frames. Swapping them breaks the name order.
+			std::vector<char> unsortedRegions = binary;
+			std::swap_ranges(unsortedRegions.begin() + 112, unsortedRegions.begin() + 144, unsortedRegions.begin() + 144);
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory(unsortedRegions), std::runtime_error);
+
+			BOOST_CHECK_THROW(AnimationAsset::loadFromMemory({}), std::runtime_error);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationAsset_Binary
+
+	BOOST_AUTO_TEST_SUITE(AnimationAsset_Text)
+
+		BOOST_AUTO_TEST_CASE(AnimationAssetBuilder_ReadText_ReadsFile)
+		{
+			std::ifstream input("TestFiles/TestAnimations.txt");
+			BOOST_REQUIRE(input);
+
+			const AnimationAssetBuilder builder = AnimationAssetBuilder::readText(input);
+			checkAsset(AnimationAsset::loadFromMemory(builder.toBinary()));
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAssetBuilder_WriteText_RoundTrips)
+		{
+			const AnimationAsset asset = AnimationAsset::loadFromMemory(makeBuilder().toBinary());
+
+			std::stringstream text;
+			AnimationAssetBuilder{ asset }.writeText(text);
+			const AnimationAssetBuilder builder = AnimationAssetBuilder::readText(text);
+
+			BOOST_CHECK(builder.toBinary() == makeBuilder().toBinary());
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAssetBuilder_ReadText_Invalid_Throws)
+		{
+			const std::vector<std::string> invalidTexts{
+				"frame 0 0 1 1",
+				"animation\nframe 0 0 1",
+				"animation\nframe 0 0 1 1 1",
+				"animation\ncell 0 0",
+				"version 2",
+				"unknown",
+				"region sheet 0 0 0 1 1\nregion sheet 0 0 0 1 1",
+				"region sheet -1 0 0 1 1"
+			};
+			for (const std::string& invalidText : invalidTexts)
+			{
+				std::istringstream text(invalidText);
+				BOOST_CHECK_THROW(AnimationAssetBuilder::readText(text), std::runtime_error);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationAssetBuilder_AddRegion_InvalidName_Throws)
+		{
+			AnimationAssetBuilder builder;
+			builder.addRegion("sheet", 0, sf::IntRect(0, 0, 1, 1));
+
+			BOOST_CHECK_THROW(builder.addRegion("sheet", 1, sf::IntRect(0, 0, 1, 1)), std::invalid_argument);
+			BOOST_CHECK_THROW(builder.addRegion("", 0, sf::IntRect(0, 0, 1, 1)), std::invalid_argument);
+			BOOST_CHECK_THROW(builder.addRegion("two words", 0, sf::IntRect(0, 0, 1, 1)), std::invalid_argument);
+			BOOST_CHECK_EQUAL(builder.getRegionCount(), 1u);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationAsset_Text
+
+BOOST_AUTO_TEST_SUITE_END() // end AnimationAssetTests
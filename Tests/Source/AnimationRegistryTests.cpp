@@ -0,0 +1,132 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationRegistry.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/UniformAnimationSet.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(AnimationRegistryTests)
+
+	BOOST_AUTO_TEST_SUITE(AnimationRegistry_Interning)
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_GetAnimationSet_SameAnimations_ReturnsSameSet)
+		{
+			AnimationRegistry registry;
+			const std::vector<Animation> animations{ Animation{ { 0, 0, 8, 8 }, { 8, 0, 8, 8 } } };
+
+			AnimationSet::ConstPtr first = registry.getAnimationSet(animations);
+			AnimationSet::ConstPtr second = registry.getAnimationSet(animations);
+
+			BOOST_CHECK(first == second);
+			BOOST_CHECK_EQUAL(registry.getSetCount(), 1u);
+			BOOST_CHECK(first->at(0) == animations[0]);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_GetAnimationSet_DifferentAnimations_ReturnsDifferentSets)
+		{
+			AnimationRegistry registry;
+			AnimationSet::ConstPtr first = registry.getAnimationSet({ Animation{ { 0, 0, 8, 8 } } });
+			AnimationSet::ConstPtr second = registry.getAnimationSet({ Animation{ { 0, 0, 8, 9 } } });
+			AnimationSet::ConstPtr third = registry.getAnimationSet({ Animation{ { 0, 0, 8, 8 } }, Animation{} });
+
+			BOOST_CHECK(first != second);
+			BOOST_CHECK(first != third);
+			BOOST_CHECK_EQUAL(registry.getSetCount(), 3u);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_GetUniformAnimationSet_MatchesUniformAnimationSet)
+		{
+			AnimationRegistry registry;
+			const std::vector<UniformAnimation> animations{ { { 0, 0 }, { 1, 0 } }, { { 2, 1 } } };
+			const UniformAnimationSet expected{ { 16, 8 }, animations };
+
+			AnimationSet::ConstPtr animationSet = registry.getUniformAnimationSet({ 16, 8 }, animations);
+
+			BOOST_REQUIRE_EQUAL(animationSet->getSize(), expected.getSize());
+			BOOST_CHECK(animationSet->at(0) == expected.at(0));
+			BOOST_CHECK(animationSet->at(1) == expected.at(1));
+			BOOST_CHECK(registry.getUniformAnimationSet({ 16, 8 }, animations) == animationSet);
+		}
+
+		// Tests that a uniform definition and explicit frames that describe the same frames share one AnimationSet
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_SameFrames_DifferentDefinitions_ShareSet)
+		{
+			AnimationRegistry registry;
+			AnimationSet::ConstPtr uniform = registry.getUniformAnimationSet({ 8, 8 }, { { { 1, 0 }, { 0, 1 } } });
+			AnimationSet::ConstPtr frames = registry.getAnimationSet({ Animation{ { 8, 0, 8, 8 }, { 0, 8, 8, 8 } } });
+
+			BOOST_CHECK(uniform == frames);
+			BOOST_CHECK_EQUAL(registry.getSetCount(), 1u);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_Sets_UsableByAnimatedSprite)
+		{
+			AnimationRegistry registry;
+			AnimationSet::ConstPtr animationSet = registry.getUniformAnimationSet({ 8, 8 }, { { { 0, 0 }, { 1, 0 } } });
+			const sf::Texture texture;
+			AnimatedSprite sprite{ texture, animationSet };
+			sprite.runAnimation(0);
+
+			BOOST_REQUIRE(sprite.getCurrentAnimation() != nullptr);
+			BOOST_CHECK(sprite.getCurrentAnimation()->data() == animationSet->at(0).data());
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_GetGlobal_ReturnsSameRegistry)
+		{
+			BOOST_CHECK(&AnimationRegistry::getGlobal() == &AnimationRegistry::getGlobal());
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationRegistry_Interning
+
+	BOOST_AUTO_TEST_SUITE(AnimationRegistry_Memory)
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_MemoryUsage_CountsEverySetOnce)
+		{
+			AnimationRegistry registry;
+			BOOST_CHECK_EQUAL(registry.getMemoryUsage(), 0u);
+
+			std::vector<AnimationSet::ConstPtr> users;
+			for (int ii = 0; ii < 10; ++ii)
+			{
+				users.push_back(registry.getUniformAnimationSet({ 8, 8 }, { { { 0, 0 }, { 1, 0 }, { 2, 0 } } }));
+			}
+
+			const std::size_t setMemory = users.front()->getMemoryUsage();
+			BOOST_CHECK_GE(setMemory, sizeof(AnimationSet) + 3 * sizeof(sf::IntRect));
+			BOOST_CHECK_EQUAL(registry.getFrameCount(), 3u);
+			BOOST_CHECK_EQUAL(registry.getMemoryUsage(), setMemory);
+			BOOST_CHECK_EQUAL(registry.getMemorySaved(), 9 * setMemory);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_RemoveUnused_KeepsUsedSets)
+		{
+			AnimationRegistry registry;
+			AnimationSet::ConstPtr used = registry.getAnimationSet({ Animation{ { 0, 0, 8, 8 } } });
+			registry.getAnimationSet({ Animation{ { 8, 0, 8, 8 } } });
+
+			BOOST_CHECK_EQUAL(registry.removeUnused(), 1u);
+			BOOST_CHECK_EQUAL(registry.getSetCount(), 1u);
+			BOOST_CHECK(registry.getAnimationSet({ Animation{ { 0, 0, 8, 8 } } }) == used);
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationRegistry_Clear_KeepsSetsValidForUsers)
+		{
+			AnimationRegistry registry;
+			AnimationSet::ConstPtr used = registry.getAnimationSet({ Animation{ { 0, 0, 8, 8 } } });
+			registry.clear();
+
+			BOOST_CHECK_EQUAL(registry.getSetCount(), 0u);
+			BOOST_CHECK_EQUAL(registry.getMemoryUsage(), 0u);
+			BOOST_CHECK(used->at(0).at(0) == sf::IntRect(0, 0, 8, 8));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationRegistry_Memory
+
+BOOST_AUTO_TEST_SUITE_END() // end AnimationRegistryTests
@@ -237,4 +237,57 @@ BOOST_FIXTURE_TEST_CASE(AnimationSet_const_reverse_iterator_works_with_algorithm
 
 BOOST_AUTO_TEST_SUITE_END() // AnimationSet_iterators
 
+BOOST_AUTO_TEST_SUITE(AnimationSet_flat_storage)
+
+// Ensure that the frames of consecutive animations are stored back to back
+BOOST_FIXTURE_TEST_CASE(AnimationSet_animations_are_contiguous, ReusableObjects)
+{
+	BOOST_CHECK(fixtureAnimSet[1].data() == fixtureAnimSet[0].data() + anim1.size());
+	BOOST_CHECK_EQUAL(fixtureAnimSet.getFrameCount(), anim1.size() + anim2.size());
+}
+
+// Ensure that erasing an animation keeps the frames of the animations after it
+BOOST_FIXTURE_TEST_CASE(AnimationSet_erase_middle_keeps_later_animations, ReusableObjects)
+{
+	fixtureAnimSet.addAnimation({frame3});
+	fixtureAnimSet.eraseAnimation(fixtureAnimSet.begin() + 1);
+
+	BOOST_CHECK_EQUAL(fixtureAnimSet.getSize(), 2u);
+	BOOST_CHECK(fixtureAnimSet[0] == anim1);
+	BOOST_CHECK(fixtureAnimSet[1] == Animation{frame3});
+	BOOST_CHECK_EQUAL(fixtureAnimSet.getFrameCount(), anim1.size() + 1);
+}
+
+// Ensure that an AnimationView compares frames, not addresses
+BOOST_FIXTURE_TEST_CASE(AnimationSet_view_equality, ReusableObjects)
+{
+	const AnimationSet copy = fixtureAnimSet;
+	BOOST_CHECK(copy[0] == fixtureAnimSet[0]);
+	BOOST_CHECK(copy[0] != fixtureAnimSet[1]);
+	BOOST_CHECK(AnimationView() == AnimationView());
+}
+
+// Ensure that AnimationView::at checks the frame index
+BOOST_FIXTURE_TEST_CASE(AnimationSet_view_at_throws_when_out_of_bounds, ReusableObjects)
+{
+	const AnimationView view = fixtureAnimSet.at(1);
+	BOOST_CHECK(view.at(1) == frame1);
+	BOOST_CHECK_THROW(static_cast<void>(view.at(anim2.size())), std::out_of_range);
+}
+
+// Ensure that reserving room means adding animations does not move the frames
+BOOST_FIXTURE_TEST_CASE(AnimationSet_reserve_keeps_views_valid, ReusableObjects)
+{
+	AnimationSet animSet;
+	animSet.reserve(2, anim1.size() + anim2.size());
+	animSet.addAnimation(anim1);
+	const AnimationView firstView = animSet[0];
+	animSet.addAnimation(anim2);
+
+	BOOST_CHECK(firstView.data() == animSet[0].data());
+	BOOST_CHECK(firstView == anim1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AnimationSet_flat_storage
+
 BOOST_AUTO_TEST_SUITE_END()// End AnimationSetTests
@@ -0,0 +1,194 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/AnimationSystem.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(AnimationSystemTests)
+
+	struct AnimationSystemFixture
+	{
+		AnimationSystemFixture() : sprites(3)
+		{
+			animations = std::make_shared<AnimationSet>(std::vector<Animation>{
+				Animation{ { 0, 0, 8, 8 }, { 8, 0, 8, 8 }, { 16, 0, 8, 8 }, { 24, 0, 8, 8 } },
+				Animation{ { 0, 8, 8, 8 } },
+				Animation{}
+			});
+			for (sf::Sprite& sprite : sprites)
+			{
+				system.addSprite(sprite, animations);
+			}
+		}
+
+		AnimationSet::Ptr animations;
+		std::vector<sf::Sprite> sprites;
+		AnimationSystem system;
+	};
+
+	BOOST_AUTO_TEST_SUITE(AnimationSystem_Sprites)
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_AddSprite_ShowsFirstFrame, AnimationSystemFixture)
+		{
+			BOOST_CHECK_EQUAL(system.getSpriteCount(), 3u);
+			BOOST_CHECK(system.containsSprite(sprites[0]));
+			BOOST_CHECK(sprites[0].getTextureRect() == animations->at(0).at(0));
+			BOOST_CHECK(!system.isAnimating(sprites[0]));
+		}
+
+		BOOST_AUTO_TEST_CASE(AnimationSystem_AddSprite_Invalid_Throws)
+		{
+			AnimationSystem system;
+			sf::Sprite sprite;
+			BOOST_CHECK_THROW(system.addSprite(sprite, nullptr), std::out_of_range);
+			BOOST_CHECK_THROW(system.addSprite(sprite, std::make_shared<AnimationSet>()), std::out_of_range);
+			BOOST_CHECK_EQUAL(system.getSpriteCount(), 0u);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_RemoveSprite_KeepsOthers, AnimationSystemFixture)
+		{
+			system.runAnimation(sprites[2], 0);
+			system.setAnimationDelay(sprites[2], sf::microseconds(5));
+			system.removeSprite(sprites[0]);
+
+			BOOST_CHECK_EQUAL(system.getSpriteCount(), 2u);
+			BOOST_CHECK(!system.containsSprite(sprites[0]));
+			BOOST_CHECK_THROW(static_cast<void>(system.getCurrentFrame(sprites[0])), std::out_of_range);
+
+			// The moved sprite keeps its state
+			BOOST_CHECK(system.isAnimating(sprites[2]));
+			BOOST_CHECK(system.getAnimationDelay(sprites[2]) == sf::microseconds(5));
+			system.update(10);
+			BOOST_CHECK_EQUAL(system.getCurrentFrame(sprites[2]), 1u);
+			BOOST_CHECK(sprites[2].getTextureRect() == animations->at(0).at(1));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_ClearSprites, AnimationSystemFixture)
+		{
+			system.clearSprites();
+			BOOST_CHECK_EQUAL(system.getSpriteCount(), 0u);
+			BOOST_CHECK(!system.containsSprite(sprites[1]));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationSystem_Sprites
+
+	BOOST_AUTO_TEST_SUITE(AnimationSystem_Update)
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_RunAnimation_Invalid_Throws, AnimationSystemFixture)
+		{
+			sf::Sprite notAdded;
+			BOOST_CHECK_THROW(system.runAnimation(notAdded, 0), std::out_of_range);
+			BOOST_CHECK_THROW(system.runAnimation(sprites[0], 2), std::out_of_range);
+			BOOST_CHECK_THROW(system.runAnimation(sprites[0], 3), std::out_of_range);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_Update_OnlyChangesDueSprites, AnimationSystemFixture)
+		{
+			system.runAnimation(sprites[0], 0);
+			system.runAnimation(sprites[1], 0);
+			system.setAnimationDelay(sprites[1], sf::microseconds(100));
+
+			system.update(10);
+			BOOST_CHECK_EQUAL(system.getLastChangedCount(), 1u);
+			BOOST_CHECK_EQUAL(system.getCurrentFrame(sprites[0]), 1u);
+			BOOST_CHECK_EQUAL(system.getCurrentFrame(sprites[1]), 0u);
+			BOOST_CHECK_EQUAL(system.getCurrentFrame(sprites[2]), 0u);
+			BOOST_CHECK(sprites[0].getTextureRect() == animations->at(0).at(1));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_Update_SingleFrame_DoesNotChange, AnimationSystemFixture)
+		{
+			system.runAnimation(sprites[0], 1, ANIMATION_END_TYPE::ANIMATION_REVERSE);
+			system.update(10);
+
+			BOOST_CHECK_EQUAL(system.getLastChangedCount(), 0u);
+			BOOST_CHECK_EQUAL(system.getFramesSpentInCurrentAnimation(sprites[0]), 1u);
+			BOOST_CHECK(sprites[0].getTextureRect() == animations->at(1).at(0));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(AnimationSystem_Update_Paused, AnimationSystemFixture)
+		{
+			system.runAnimation(sprites[0], 0);
+			system.setAnimating(sprites[0], false);
+			system.update(10);
+
+			BOOST_CHECK_EQUAL(system.getCurrentFrame(sprites[0]), 0u);
+			BOOST_CHECK_EQUAL(system.getFramesSpentInCurrentAnimation(sprites[0]), 0u);
+		}
+
+		// Tests that every end type steps through the same frames as an AnimatedSprite
+		BOOST_AUTO_TEST_CASE(AnimationSystem_Update_MatchesAnimatedSprite)
+		{
+			auto animations = std::make_shared<AnimationSet>(std::vector<Animation>{
+				Animation{ { 0, 0, 8, 8 }, { 8, 0, 8, 8 }, { 16, 0, 8, 8 }, { 24, 0, 8, 8 } }
+			});
+			const sf::Texture texture;
+
+			for (ANIMATION_END_TYPE endType : { ANIMATION_END_TYPE::ANIMATION_LOOP, ANIMATION_END_TYPE::ANIMATION_REVERSE, ANIMATION_END_TYPE::ANIMATION_STOP })
+			{
+				AnimatedSprite animatedSprite{ texture, animations };
+				animatedSprite.setAnimationDelay(sf::microseconds(15));
+				animatedSprite.runAnimation(0, endType);
+
+				sf::Sprite sprite{ texture };
+				AnimationSystem system;
+				system.addSprite(sprite, animations);
+				system.setAnimationDelay(sprite, sf::microseconds(15));
+				system.runAnimation(sprite, 0, endType);
+
+				for (int ii = 0; ii < 20; ++ii)
+				{
+					animatedSprite.update(10);
+					system.update(10);
+					BOOST_CHECK_EQUAL(system.getCurrentFrame(sprite), animatedSprite.getCurrentFrame());
+					BOOST_CHECK_EQUAL(system.getFramesSpentInCurrentAnimation(sprite), animatedSprite.getFramesSpentInCurrentAnimation());
+					BOOST_CHECK(sprite.getTextureRect() == animatedSprite.getTextureRect());
+				}
+			}
+		}
+
+		// Tests that frame skipping steps through the same frames as an AnimatedSprite with frame skipping
+		BOOST_AUTO_TEST_CASE(AnimationSystem_Update_FrameSkipping_MatchesAnimatedSprite)
+		{
+			auto animations = std::make_shared<AnimationSet>(std::vector<Animation>{
+				Animation{ { 0, 0, 8, 8 }, { 8, 0, 8, 8 }, { 16, 0, 8, 8 }, { 24, 0, 8, 8 }, { 32, 0, 8, 8 } }
+			});
+			const sf::Texture texture;
+
+			for (ANIMATION_END_TYPE endType : { ANIMATION_END_TYPE::ANIMATION_LOOP, ANIMATION_END_TYPE::ANIMATION_REVERSE, ANIMATION_END_TYPE::ANIMATION_STOP })
+			{
+				AnimatedSprite animatedSprite{ texture, animations };
+				animatedSprite.setFrameSkippingEnabled(true);
+				animatedSprite.setAnimationDelay(sf::microseconds(15));
+				animatedSprite.runAnimation(0, endType);
+
+				sf::Sprite sprite{ texture };
+				AnimationSystem system;
+				system.setFrameSkippingEnabled(true);
+				system.addSprite(sprite, animations);
+				system.setAnimationDelay(sprite, sf::microseconds(15));
+				system.runAnimation(sprite, 0, endType);
+
+				// Uneven update times so that some updates advance several frames and some none
+				for (sf::Int64 elapsedTime : { 7, 40, 3, 100, 15, 16, 61, 2, 200, 31 })
+				{
+					animatedSprite.update(elapsedTime);
+					system.update(elapsedTime);
+					BOOST_CHECK_EQUAL(system.getCurrentFrame(sprite), animatedSprite.getCurrentFrame());
+					BOOST_CHECK_EQUAL(system.getFramesSpentInCurrentAnimation(sprite), animatedSprite.getFramesSpentInCurrentAnimation());
+					BOOST_CHECK(sprite.getTextureRect() == animatedSprite.getTextureRect());
+				}
+			}
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end AnimationSystem_Update
+
+BOOST_AUTO_TEST_SUITE_END() // end AnimationSystemTests
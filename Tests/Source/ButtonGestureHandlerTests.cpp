@@ -421,6 +421,68 @@ BOOST_AUTO_TEST_SUITE(ButtonPressGestureHandlerTests)
 			BOOST_TEST(handler.getMatchSignalerCount() == count);
 		}
 
+		BOOST_FIXTURE_TEST_CASE(RemoveGestureKeepsLaterGesturesInProgress, InputHandlerConsumeEventFixture)
+		{
+			// Spread the gestures over more than one word of the open set
+			const std::size_t signalerCount = 100;
+			const std::size_t upGesturePosition = 70;
+			int fireCount = 0;
+			for (std::size_t ii = 0; ii < signalerCount; ++ii)
+			{
+				if (ii == upGesturePosition)
+				{
+					handler.addMatchSignaler(TestMatchSignaler({ upPressed, upPressed }, [&fireCount]() { ++fireCount; }));
+				}
+				else
+				{
+					handler.addMatchSignaler(TestMatchSignaler({ downPressed, downPressed }, []() {}));
+				}
+			}
+
+			BOOST_TEST(handler.handleEvent(0, upPressed));
+			handler.removeMatchSignaler(10);
+			BOOST_TEST(handler.getMatchSignaler(upGesturePosition - 1).getGesture()[0].key.code == sf::Keyboard::Up);
+
+			BOOST_TEST(handler.handleEvent(0, upPressed));
+			BOOST_TEST(fireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(CopiedHandlerMatchesIndependently, InputHandlerConsumeEventFixture)
+		{
+			int fireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ upPressed, upPressed }, [&fireCount]() { ++fireCount; }));
+			handler.handleEvent(0, upPressed);
+
+			ButtonGestureHandler<TestMatchSignaler> copy = handler;
+			BOOST_TEST(copy.handleEvent(0, upPressed));
+			BOOST_TEST(fireCount == 1);
+
+			// The original is still part way through the gesture
+			BOOST_TEST(handler.handleEvent(0, upPressed));
+			BOOST_TEST(fireCount == 2);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(FunctionObjectActionsFire, InputHandlerConsumeEventFixture)
+		{
+			struct CountAction
+			{
+				int* count;
+				void operator()() const { ++*count; }
+			};
+			using CountMatchSignaler = GestureMatchSignaler<KeyEventComparator, AnyEventFilter, CountAction>;
+			static_assert(std::is_trivially_copyable_v<CountMatchSignaler::ActionType>);
+
+			int fireCount = 0;
+			ButtonGestureHandler<CountMatchSignaler> countHandler;
+			countHandler.addMatchSignaler(CountMatchSignaler({ upPressed, downPressed }, CountAction{ &fireCount }));
+			countHandler.addMatchSignaler(CountMatchSignaler({ upPressed }, CountAction{ &fireCount }));
+
+			countHandler.handleEvent(0, upPressed);
+			BOOST_TEST(fireCount == 1);
+			countHandler.handleEvent(0, downPressed);
+			BOOST_TEST(fireCount == 2);
+		}
+
 	BOOST_AUTO_TEST_SUITE_END() // GestureAccess
 
 	BOOST_AUTO_TEST_SUITE(GestureIOCases)
@@ -0,0 +1,196 @@
+#include "stdafx.h"
+
+#include <GameBackbone/UserInput/ButtonGestureHandler.h>
+#include <GameBackbone/UserInput/CompactGesture.h>
+#include <GameBackbone/UserInput/EventComparator.h>
+#include <GameBackbone/UserInput/GestureMatchSignaler.h>
+#include <GameBackbone/UserInput/GestureTrieHandler.h>
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(CompactGestureTests)
+
+	struct CompactGestureFixture
+	{
+		static sf::Event makeKeyEvent(sf::Event::EventType type, sf::Keyboard::Key key)
+		{
+			sf::Event event{};
+			event.type = type;
+			event.key = sf::Event::KeyEvent{ key, false, false, false, false };
+			return event;
+		}
+
+		static EventKey makeKey(sf::Event::EventType type, std::uint16_t code)
+		{
+			return EventKey{ static_cast<std::uint16_t>(type), code };
+		}
+
+		sf::Event aPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::A);
+		sf::Event bPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::B);
+		sf::Event aReleased = makeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::A);
+		sf::Event unknownPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::Unknown);
+	};
+
+	BOOST_AUTO_TEST_SUITE(Construction)
+
+		BOOST_FIXTURE_TEST_CASE(DefaultConstructedGestureIsEmpty, CompactGestureFixture)
+		{
+			CompactGesture<> gesture;
+			BOOST_TEST(gesture.empty());
+			BOOST_TEST(gesture.size() == 0);
+			BOOST_TEST(gesture.capacity() == DEFAULT_COMPACT_GESTURE_CAPACITY);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(ConstructFromKeys, CompactGestureFixture)
+		{
+			CompactGesture<> gesture{ makeKey(sf::Event::KeyPressed, sf::Keyboard::A), makeKey(sf::Event::KeyPressed, sf::Keyboard::B) };
+			BOOST_TEST(gesture.size() == 2);
+			BOOST_TEST((gesture[0] == makeKey(sf::Event::KeyPressed, sf::Keyboard::A)));
+			BOOST_TEST((gesture[1] == makeKey(sf::Event::KeyPressed, sf::Keyboard::B)));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(ConstructFromEventsUsesComparatorKeys, CompactGestureFixture)
+		{
+			CompactGesture<> gesture{ aPressed, aReleased };
+			BOOST_TEST(gesture.size() == 2);
+			BOOST_TEST((gesture[0] == *KeyEventComparator{}.getEventKey(aPressed)));
+			BOOST_TEST((gesture[1] == *KeyEventComparator{}.getEventKey(aReleased)));
+			BOOST_TEST((gesture == CompactGesture<>(std::vector<sf::Event>{ aPressed, aReleased }, KeyEventComparator{})));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(ConstructFromTooManyEventsThrowsLengthError, CompactGestureFixture)
+		{
+			BOOST_CHECK_THROW((CompactGesture<2>{ aPressed, bPressed, aPressed }), std::length_error);
+			BOOST_CHECK_NO_THROW((CompactGesture<2>{ aPressed, bPressed }));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(ConstructFromEventWithoutKeyThrowsInvalidArgument, CompactGestureFixture)
+		{
+			BOOST_CHECK_THROW((CompactGesture<>{ aPressed, unknownPressed }), std::invalid_argument);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(PushBackPastCapacityThrowsLengthError, CompactGestureFixture)
+		{
+			CompactGesture<1> gesture;
+			gesture.push_back(makeKey(sf::Event::KeyPressed, sf::Keyboard::A));
+			BOOST_CHECK_THROW(gesture.push_back(makeKey(sf::Event::KeyPressed, sf::Keyboard::B)), std::length_error);
+			BOOST_TEST(gesture.size() == 1);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // Construction
+
+	BOOST_AUTO_TEST_SUITE(Storage)
+
+		BOOST_AUTO_TEST_CASE(GestureIsStoredInline)
+		{
+			static_assert(sizeof(CompactGesture<>) == 32);
+			static_assert(std::is_trivially_copyable_v<CompactGesture<>>);
+		}
+
+		BOOST_AUTO_TEST_CASE(SignalerWithFunctionPointerActionIsTriviallyCopyable)
+		{
+			static_assert(std::is_trivially_copyable_v<CompactKeyDownMatchSignaler<void(*)()>>);
+			static_assert(sizeof(CompactKeyDownMatchSignaler<void(*)()>) < sizeof(KeyDownMatchSignaler));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // Storage
+
+	BOOST_AUTO_TEST_SUITE(Matching)
+
+		BOOST_FIXTURE_TEST_CASE(CompactSignalerFiresOnGesture, CompactGestureFixture)
+		{
+			int fireCount = 0;
+			CompactKeyDownMatchSignaler<> signaler{ { aPressed, bPressed }, [&fireCount]() { ++fireCount; } };
+
+			BOOST_TEST(signaler.processEvent(0, aPressed).inputConsumed);
+			BOOST_TEST(signaler.processEvent(0, bPressed).actionFired);
+			BOOST_TEST(fireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(CompactSignalerDoesNotMatchDifferentEventType, CompactGestureFixture)
+		{
+			int fireCount = 0;
+			GestureMatchSignaler<KeyEventComparator, AnyEventFilter, std::function<void()>, CompactGesture<>> signaler{
+				{ aPressed }, [&fireCount]() { ++fireCount; } };
+
+			BOOST_TEST(!signaler.processEvent(0, aReleased).inputConsumed);
+			BOOST_TEST(!signaler.isReadyForInput());
+			BOOST_TEST(fireCount == 0);
+		}
+
+		/// @brief Feeds the same random events to handlers holding the same random gestures as std::vector<sf::Event>
+		///		and as GB::CompactGesture and checks that they consume the same events and fire the same actions in the same order.
+		template <template <class> class Handler>
+		void checkMatchesVectorGesture(unsigned int seed)
+		{
+			using VectorSignaler = KeyDownMatchSignaler;
+			using CompactSignaler = CompactKeyDownMatchSignaler<>;
+
+			const std::vector<sf::Event::EventType> eventTypes{ sf::Event::KeyPressed, sf::Event::KeyReleased };
+			const std::vector<sf::Keyboard::Key> keys{ sf::Keyboard::A, sf::Keyboard::B, sf::Keyboard::C };
+			const std::vector<GestureMatchBehavior> behaviors{
+				GestureMatchBehavior::Block, GestureMatchBehavior::Reset, GestureMatchBehavior::Penultimate };
+
+			std::mt19937 generator{ seed };
+			auto pick = [&generator](const auto& choices) {
+				return choices[std::uniform_int_distribution<std::size_t>{ 0, choices.size() - 1 }(generator)];
+			};
+
+			std::vector<std::size_t> expectedActions;
+			std::vector<std::size_t> actualActions;
+			Handler<VectorSignaler> expectedHandler;
+			Handler<CompactSignaler> actualHandler;
+			for (std::size_t ii = 0; ii < 40; ++ii)
+			{
+				std::vector<sf::Event> gesture;
+				const std::size_t gestureLength = std::uniform_int_distribution<std::size_t>{ 0, DEFAULT_COMPACT_GESTURE_CAPACITY }(generator);
+				for (std::size_t jj = 0; jj < gestureLength; ++jj)
+				{
+					gesture.push_back(CompactGestureFixture::makeKeyEvent(sf::Event::KeyPressed, pick(keys)));
+				}
+				const GestureMatchBehavior behavior = pick(behaviors);
+				const sf::Int64 maxTimeBetweenInputs = std::uniform_int_distribution<sf::Int64>{ 0, 12 }(generator);
+
+				expectedHandler.addMatchSignaler(VectorSignaler(gesture, [&expectedActions, ii]() { expectedActions.push_back(ii); },
+					behavior, maxTimeBetweenInputs));
+				actualHandler.addMatchSignaler(CompactSignaler(gesture, [&actualActions, ii]() { actualActions.push_back(ii); },
+					behavior, maxTimeBetweenInputs));
+			}
+
+			for (std::size_t ii = 0; ii < 5000; ++ii)
+			{
+				const sf::Event event = CompactGestureFixture::makeKeyEvent(pick(eventTypes), pick(keys));
+				const sf::Int64 elapsedTime = std::uniform_int_distribution<sf::Int64>{ 0, 12 }(generator);
+
+				const bool expectedConsumed = expectedHandler.handleEvent(elapsedTime, event);
+				const bool actualConsumed = actualHandler.handleEvent(elapsedTime, event);
+				BOOST_REQUIRE(expectedConsumed == actualConsumed);
+				BOOST_REQUIRE(expectedActions == actualActions);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(MatchesVectorGestureInButtonGestureHandler)
+		{
+			for (unsigned int seed = 0; seed < 20; ++seed)
+			{
+				checkMatchesVectorGesture<ButtonGestureHandler>(seed);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(MatchesVectorGestureInGestureTrieHandler)
+		{
+			for (unsigned int seed = 0; seed < 20; ++seed)
+			{
+				checkMatchesVectorGesture<GestureTrieHandler>(seed);
+			}
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // Matching
+
+BOOST_AUTO_TEST_SUITE_END() // CompactGestureTests
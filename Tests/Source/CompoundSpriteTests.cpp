@@ -909,6 +909,345 @@ BOOST_AUTO_TEST_SUITE(Transform)
 BOOST_AUTO_TEST_SUITE_END() // Transform
 
 
+BOOST_AUTO_TEST_SUITE(CompoundSprite_BatchDrawing)
+
+	class MockDrawable_ForDrawCounts : public sf::Drawable, public sf::Transformable {
+	public:
+		explicit MockDrawable_ForDrawCounts(int& drawCount) : m_drawCount(drawCount) {}
+
+	protected:
+		void draw([[maybe_unused]] sf::RenderTarget& target, [[maybe_unused]] sf::RenderStates states) const override
+		{
+			m_drawCount++;
+		}
+
+	private:
+		int& m_drawCount;
+	};
+
+	class MockSprite_SwapsTextureOnUpdate : public sf::Sprite, public GB::Updatable {
+	public:
+		MockSprite_SwapsTextureOnUpdate(const sf::Texture& texture, const sf::Texture& updatedTexture) :
+			sf::Sprite(texture), m_updatedTexture(&updatedTexture) {}
+
+		void update([[maybe_unused]] sf::Int64 elapsedTime) override
+		{
+			setTexture(*m_updatedTexture);
+		}
+
+	private:
+		const sf::Texture* m_updatedTexture;
+	};
+
+	BOOST_AUTO_TEST_CASE(BatchDrawing_DisabledByDefault)
+	{
+		CompoundSprite compoundSprite{};
+
+		BOOST_CHECK(compoundSprite.isBatchDrawingEnabled() == false);
+	}
+
+	BOOST_AUTO_TEST_CASE(BatchDrawing_SetEnabled)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+
+		BOOST_CHECK(compoundSprite.isBatchDrawingEnabled());
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_SameTextureSamePriority_OneDraw, ReusableObjectsForOperations)
+	{
+		compoundSprite.setBatchDrawingEnabled(true);
+
+		BOOST_CHECK(compoundSprite.getComponentCount() == 4);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_SameTextureDifferentPriority_OneDrawPerPriority, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		compoundSprite.addComponent(0, sprite2);
+		compoundSprite.addComponent(1, animSpriteWithAnim1);
+		compoundSprite.addComponent(1, animSpriteWithAnim2);
+
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 2);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_DifferentTexture_OneDrawPerTexture, ReusableObjects)
+	{
+		sf::Texture otherTexture;
+		otherTexture.loadFromFile("Textures/testSprite.png");
+		sf::Sprite otherSprite{ otherTexture };
+
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		compoundSprite.addComponent(0, otherSprite);
+		compoundSprite.addComponent(0, sprite2);
+
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 2);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_NonSpriteComponents_DrawnIndividually, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		compoundSprite.addComponent(0, sf::RectangleShape{});
+		compoundSprite.addComponent(0, sf::RectangleShape{});
+		compoundSprite.addComponent(0, sprite2);
+
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 3);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_AddAndRemove_RebuildsBatch, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+
+		auto& rectangle = compoundSprite.addComponent(1, sf::RectangleShape{});
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 2);
+
+		compoundSprite.removeComponent(rectangle);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+
+		compoundSprite.clearComponents();
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 0);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_UpdateChangingSprite_RebuildsBatch, ReusableObjects)
+	{
+		sf::Texture otherTexture;
+		otherTexture.loadFromFile("Textures/testSprite.png");
+
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		compoundSprite.addComponent(0, MockSprite_SwapsTextureOnUpdate{ aSpriteTexture, otherTexture });
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+
+		compoundSprite.update(1);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 2);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_ChangeThroughReference_RebuildsBatch, ReusableObjects)
+	{
+		sf::Texture otherTexture;
+		otherTexture.loadFromFile("Textures/testSprite.png");
+
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		sf::Sprite& addedSprite = compoundSprite.addComponent(0, sprite2);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+
+		addedSprite.setTexture(otherTexture);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 2);
+
+		// Changes through iterators are found too
+		for (auto& componentPair : compoundSprite)
+		{
+			componentPair.second->getDataAs<sf::Sprite>().setTexture(aSpriteTexture);
+		}
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_Draw_DrawsNonSpriteComponents, ReusableObjects)
+	{
+		int drawCount = 0;
+		CompoundSprite compoundSprite{};
+		compoundSprite.setBatchDrawingEnabled(true);
+		compoundSprite.addComponent(0, sprite);
+		compoundSprite.addComponent(0, MockDrawable_ForDrawCounts{ drawCount });
+		compoundSprite.addComponent(1, MockDrawable_ForDrawCounts{ drawCount });
+
+		sf::RenderTexture renderTexture;
+		renderTexture.create(10, 10);
+		renderTexture.draw(compoundSprite);
+
+		BOOST_CHECK(drawCount == 2);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_CopyCtr_CopiesEnabled, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{ 0, sprite };
+		compoundSprite.setBatchDrawingEnabled(true);
+		CompoundSprite compoundSprite2{ compoundSprite };
+
+		BOOST_CHECK(compoundSprite2.isBatchDrawingEnabled());
+		BOOST_CHECK(compoundSprite2.getBatchedDrawCount() == 1);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(BatchDrawing_MoveCtr_MovesEnabled, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{ 0, sprite };
+		compoundSprite.setBatchDrawingEnabled(true);
+		BOOST_CHECK(compoundSprite.getBatchedDrawCount() == 1);
+		CompoundSprite compoundSprite2{ std::move(compoundSprite) };
+
+		BOOST_CHECK(compoundSprite2.isBatchDrawingEnabled());
+		BOOST_CHECK(compoundSprite2.getBatchedDrawCount() == 1);
+	}
+
+BOOST_AUTO_TEST_SUITE_END() // BatchDrawing
+
+BOOST_AUTO_TEST_SUITE(CompoundSprite_DeferredTransforms)
+
+	// Checks that every component of both CompoundSprites ends up with the same transform
+	void checkSameComponentTransforms(CompoundSprite& expected, CompoundSprite& actual)
+	{
+		BOOST_REQUIRE(expected.getComponentCount() == actual.getComponentCount());
+		for (auto expectedIter = expected.begin(), actualIter = actual.begin(); expectedIter != expected.end(); ++expectedIter, ++actualIter)
+		{
+			const float* expectedMatrix = expectedIter->second->getTransform().getMatrix();
+			const float* actualMatrix = actualIter->second->getTransform().getMatrix();
+			for (int ii = 0; ii < 16; ++ii)
+			{
+				BOOST_CHECK_SMALL(expectedMatrix[ii] - actualMatrix[ii], 0.001f);
+			}
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(DeferredTransforms_DisabledByDefault)
+	{
+		CompoundSprite compoundSprite{};
+
+		BOOST_CHECK(compoundSprite.isDeferredTransformsEnabled() == false);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_Transform_DoesNotChangeComponentsUntilApplied, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setDeferredTransformsEnabled(true);
+		sf::Sprite& component = compoundSprite.addComponent(0, sprite);
+		const sf::Vector2f startingPosition = component.getPosition();
+
+		compoundSprite.move(5, 5);
+		BOOST_CHECK(component.getPosition() == startingPosition);
+
+		compoundSprite.applyDeferredTransforms();
+		BOOST_CHECK(component.getPosition() == startingPosition + sf::Vector2f(5, 5));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_Draw_AppliesTransform, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setDeferredTransformsEnabled(true);
+		sf::Sprite& component = compoundSprite.addComponent(0, sprite);
+		compoundSprite.rotate(30);
+
+		sf::RenderTexture renderTexture;
+		renderTexture.create(10, 10);
+		renderTexture.draw(compoundSprite);
+
+		BOOST_CHECK_CLOSE(component.getRotation(), 30.f, 0.001f);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_MatchesImmediateTransforms, ReusableObjects)
+	{
+		sprite.setRotation(10);
+		sprite2.setScale(2, 3);
+		CompoundSprite immediate{ 0, sprite, sprite2, animSpriteWithAnim1 };
+		CompoundSprite deferred{ 0, sprite, sprite2, animSpriteWithAnim1 };
+		deferred.setDeferredTransformsEnabled(true);
+
+		for (CompoundSprite* compoundSprite : { &immediate, &deferred })
+		{
+			compoundSprite->move(3, 4);
+			compoundSprite->rotate(15);
+			compoundSprite->scale(2, 0.5f);
+			compoundSprite->setOrigin(7, 8);
+			compoundSprite->setPosition(20, 30);
+			compoundSprite->rotate(5);
+			compoundSprite->scale(1.5f, 1.5f);
+		}
+
+		checkSameComponentTransforms(immediate, deferred);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_SetAfterRelative_MatchesImmediateTransforms, ReusableObjects)
+	{
+		sprite.setRotation(10);
+		CompoundSprite immediate{ 0, sprite, sprite2 };
+		CompoundSprite deferred{ 0, sprite, sprite2 };
+		deferred.setDeferredTransformsEnabled(true);
+
+		for (CompoundSprite* compoundSprite : { &immediate, &deferred })
+		{
+			compoundSprite->rotate(15);
+			compoundSprite->scale(2, 2);
+			compoundSprite->setRotation(40);
+			compoundSprite->setScale(3, 4);
+			compoundSprite->rotate(5);
+			compoundSprite->scale(0.5f, 0.5f);
+		}
+
+		checkSameComponentTransforms(immediate, deferred);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_AddComponent_NotAffectedByEarlierTransforms, ReusableObjects)
+	{
+		CompoundSprite immediate{};
+		CompoundSprite deferred{};
+		deferred.setDeferredTransformsEnabled(true);
+
+		for (CompoundSprite* compoundSprite : { &immediate, &deferred })
+		{
+			compoundSprite->addComponent(0, sprite);
+			compoundSprite->move(10, 10);
+			compoundSprite->rotate(45);
+			compoundSprite->addComponent(0, sprite2);
+			compoundSprite->move(-3, 2);
+		}
+
+		checkSameComponentTransforms(immediate, deferred);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_Disable_AppliesTransform, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{};
+		compoundSprite.setDeferredTransformsEnabled(true);
+		sf::Sprite& component = compoundSprite.addComponent(0, sprite);
+		const sf::Vector2f startingPosition = component.getPosition();
+		compoundSprite.move(5, 5);
+
+		compoundSprite.setDeferredTransformsEnabled(false);
+
+		BOOST_CHECK(component.getPosition() == startingPosition + sf::Vector2f(5, 5));
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_CopyCtr_CopiesAppliedTransform, ReusableObjects)
+	{
+		CompoundSprite compoundSprite{ 0, sprite };
+		compoundSprite.setDeferredTransformsEnabled(true);
+		compoundSprite.move(5, 5);
+
+		CompoundSprite compoundSprite2{ compoundSprite };
+
+		BOOST_CHECK(compoundSprite2.isDeferredTransformsEnabled());
+		BOOST_CHECK(compoundSprite2.getPosition() == compoundSprite.getPosition());
+		checkSameComponentTransforms(compoundSprite, compoundSprite2);
+	}
+
+	BOOST_FIXTURE_TEST_CASE(DeferredTransforms_MoveCtr_MovesPendingTransform, ReusableObjects)
+	{
+		CompoundSprite expected{ 0, sprite };
+		expected.move(5, 5);
+
+		CompoundSprite compoundSprite{ 0, sprite };
+		compoundSprite.setDeferredTransformsEnabled(true);
+		compoundSprite.move(5, 5);
+		CompoundSprite compoundSprite2{ std::move(compoundSprite) };
+
+		BOOST_CHECK(compoundSprite2.isDeferredTransformsEnabled());
+		checkSameComponentTransforms(expected, compoundSprite2);
+	}
+
+BOOST_AUTO_TEST_SUITE_END() // DeferredTransforms
+
 BOOST_AUTO_TEST_SUITE(CompoundSprite_SFINAETests)
 
 	// SFINAE types for checking if CompoundSprite can be constructed with given inputs
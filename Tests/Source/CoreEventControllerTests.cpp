@@ -1,11 +1,16 @@
 #include "stdafx.h"
 
 #include <GameBackbone/Core/CoreEventController.h>
+#include <GameBackbone/Core/TextureLoader.h>
 
 #include <SFML/Graphics.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -194,4 +199,467 @@ BOOST_AUTO_TEST_CASE(CoreEventController_SwapRegion) {
 	BOOST_CHECK_EQUAL(parentGameRegion.children[0]->m_updateCounter, 4);
 }
 
+/// <summary>
+/// GameRegion that records the updates and interpolation it receives.
+/// </summary>
+class FixedTimestepGRMock : public GB::GameRegion
+{
+public:
+	void update(sf::Int64 elapsedTime) override {
+		updateTimes.push_back(elapsedTime);
+	}
+
+	void interpolate(float alpha) override {
+		alphas.push_back(alpha);
+	}
+
+	std::vector<sf::Int64> updateTimes;
+	std::vector<float> alphas;
+};
+
+/// <summary>
+/// CoreEventController that runs single iterations of the main loop with chosen elapsed times.
+/// </summary>
+class FixedTimestepCECMock final : public CoreEventController
+{
+public:
+	explicit FixedTimestepCECMock(BasicGameRegion* activeRegion) {
+		setActiveRegion(activeRegion);
+	}
+
+	using CoreEventController::runLoopIteration;
+};
+
+BOOST_AUTO_TEST_SUITE(CoreEventController_FixedTimestep)
+
+// Tests that the fixed timestep is disabled by default
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_DisabledByDefault) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+
+	BOOST_CHECK(!testController.isFixedTimestepEnabled());
+	BOOST_CHECK(testController.getInterpolationAlpha() == 0.f);
+}
+
+// Tests that each frame updates once with the elapsed time when the fixed timestep is disabled
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_Disabled_UpdatesOncePerFrame) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+
+	testController.runLoopIteration(1234);
+	testController.runLoopIteration(10);
+
+	BOOST_CHECK((region.updateTimes == std::vector<sf::Int64>{ 1234, 10 }));
+	BOOST_CHECK(region.alphas.empty());
+}
+
+// Tests that the region is updated once per full timestep and interpolated by the remainder
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_AccumulatesTime) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	testController.setFixedTimestep(1000);
+
+	testController.runLoopIteration(250);
+	BOOST_CHECK(region.updateTimes.empty());
+	BOOST_CHECK_CLOSE(testController.getInterpolationAlpha(), 0.25f, 0.001f);
+
+	testController.runLoopIteration(2000);
+	BOOST_CHECK((region.updateTimes == std::vector<sf::Int64>{ 1000, 1000 }));
+	BOOST_CHECK_CLOSE(testController.getInterpolationAlpha(), 0.25f, 0.001f);
+
+	testController.runLoopIteration(750);
+	BOOST_CHECK(region.updateTimes.size() == 3);
+	BOOST_CHECK(testController.getInterpolationAlpha() == 0.f);
+
+	// The region is told the alpha before every draw
+	BOOST_CHECK(region.alphas.size() == 3);
+	BOOST_CHECK_CLOSE(region.alphas[1], 0.25f, 0.001f);
+}
+
+// Tests that a long frame does not run more than the max updates and drops the time it could not catch up
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_MaxUpdatesPerFrame) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	testController.setFixedTimestep(1000, 3);
+
+	testController.runLoopIteration(10500);
+	BOOST_CHECK(region.updateTimes.size() == 3);
+	BOOST_CHECK_CLOSE(testController.getInterpolationAlpha(), 0.5f, 0.001f);
+
+	// The dropped time is not caught up on the next frame
+	testController.runLoopIteration(500);
+	BOOST_CHECK(region.updateTimes.size() == 4);
+}
+
+// Tests that disabling the fixed timestep returns to one update per frame
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_Disable) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	testController.setFixedTimestep(1000);
+	testController.runLoopIteration(1500);
+
+	testController.disableFixedTimestep();
+	testController.runLoopIteration(10);
+
+	BOOST_CHECK(!testController.isFixedTimestepEnabled());
+	BOOST_CHECK((region.updateTimes == std::vector<sf::Int64>{ 1000, 10 }));
+	BOOST_CHECK(testController.getInterpolationAlpha() == 0.f);
+}
+
+// Tests that invalid fixed timesteps are rejected
+BOOST_AUTO_TEST_CASE(CoreEventController_FixedTimestep_Invalid_Throws) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+
+	BOOST_CHECK_THROW(testController.setFixedTimestep(0), std::invalid_argument);
+	BOOST_CHECK_THROW(testController.setFixedTimestep(1000, 0), std::invalid_argument);
+	BOOST_CHECK(!testController.isFixedTimestepEnabled());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CoreEventController_FixedTimestep
+
+/// <summary>
+/// GameRegion that draws only the state it published, like a region used with pipelined execution should.
+/// </summary>
+class PipelinedGRMock : public GB::GameRegion
+{
+public:
+	void update(sf::Int64 /*elapsedTime*/) override {
+		// Give the draw a chance to overlap with the update
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		++updateCount;
+		updateThreads.push_back(std::this_thread::get_id());
+	}
+
+	void publishRenderState() override {
+		publishedUpdateCount = updateCount;
+	}
+
+	mutable std::vector<sf::Int64> drawnUpdateCounts;
+	std::vector<std::thread::id> updateThreads;
+	int updateCount = 0;
+
+protected:
+	void draw(sf::RenderTarget& /*target*/, sf::RenderStates /*states*/) const override {
+		drawnUpdateCounts.push_back(publishedUpdateCount);
+	}
+
+private:
+	int publishedUpdateCount = 0;
+};
+
+/// <summary>
+/// CoreEventController that closes its window after a number of iterations.
+/// </summary>
+class PipelinedCECMock final : public CoreEventController
+{
+public:
+	PipelinedCECMock(BasicGameRegion* activeRegion, int iterationCount) : m_remainingIterations(iterationCount) {
+		setActiveRegion(activeRegion);
+		setPipelinedExecutionEnabled(true);
+	}
+
+	void draw() override {
+		CoreEventController::draw();
+		if (--m_remainingIterations == 0) {
+			getWindow().close();
+		}
+	}
+
+private:
+	int m_remainingIterations;
+};
+
+BOOST_AUTO_TEST_SUITE(CoreEventController_Pipelined)
+
+// Tests that pipelined execution is disabled by default
+BOOST_AUTO_TEST_CASE(CoreEventController_Pipelined_DisabledByDefault) {
+	OrderCECMock testController;
+	BOOST_CHECK(!testController.isPipelinedExecutionEnabled());
+}
+
+// Tests that each frame draws the state published after the previous update
+BOOST_AUTO_TEST_CASE(CoreEventController_Pipelined_DrawsPublishedState) {
+	PipelinedGRMock region;
+	PipelinedCECMock testController{ &region, 5 };
+
+	testController.runLoop();
+
+	BOOST_CHECK_EQUAL(region.updateCount, 5);
+	BOOST_CHECK((region.drawnUpdateCounts == std::vector<sf::Int64>{ 0, 1, 2, 3, 4 }));
+}
+
+// Tests that the region is updated off of the window thread
+BOOST_AUTO_TEST_CASE(CoreEventController_Pipelined_UpdatesOnOtherThread) {
+	PipelinedGRMock region;
+	PipelinedCECMock testController{ &region, 3 };
+
+	testController.runLoop();
+
+	BOOST_REQUIRE(!region.updateThreads.empty());
+	for (std::thread::id updateThread : region.updateThreads) {
+		BOOST_CHECK(updateThread != std::this_thread::get_id());
+	}
+}
+
+// Tests that the fixed timestep also works while pipelined
+BOOST_AUTO_TEST_CASE(CoreEventController_Pipelined_FixedTimestep) {
+	PipelinedGRMock region;
+	PipelinedCECMock testController{ &region, 3 };
+	testController.setFixedTimestep(1);
+
+	testController.runLoop();
+
+	// Every iteration takes at least a millisecond, so every iteration updates at least once
+	BOOST_CHECK(region.updateCount >= 3);
+	BOOST_CHECK(region.drawnUpdateCounts.size() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CoreEventController_Pipelined
+
+BOOST_AUTO_TEST_SUITE(CoreEventController_Profiling)
+
+// Tests that profiling is disabled by default
+BOOST_AUTO_TEST_CASE(CoreEventController_Profiling_DisabledByDefault) {
+	OrderCECMock testController;
+	BOOST_CHECK(!testController.isProfilingEnabled());
+	BOOST_CHECK(testController.getProfiler() == nullptr);
+}
+
+// Tests that every phase of each iteration is recorded
+BOOST_AUTO_TEST_CASE(CoreEventController_Profiling_RecordsEveryPhase) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	testController.setProfilingEnabled(true, 8);
+
+	testController.runLoopIteration(10);
+	testController.runLoopIteration(10);
+
+	const FrameProfiler* profiler = testController.getProfiler();
+	BOOST_REQUIRE(profiler != nullptr);
+	BOOST_CHECK_EQUAL(profiler->getCapacity(), 8u);
+	for (LoopPhase phase : { LoopPhase::HandleEvents, LoopPhase::Update, LoopPhase::Repaint, LoopPhase::SwapRegion, LoopPhase::Frame }) {
+		BOOST_CHECK_EQUAL(profiler->getStatistics(phase).sampleCount, 2u);
+	}
+
+	// Each phase runs within its frame
+	const PhaseSample frame = profiler->getSamples(LoopPhase::Frame)[1];
+	const PhaseSample repaint = profiler->getSamples(LoopPhase::Repaint)[1];
+	BOOST_CHECK_GE(repaint.start, frame.start);
+	BOOST_CHECK_LE(repaint.start + repaint.duration, frame.start + frame.duration);
+}
+
+// Tests that the update is recorded from the worker thread while pipelined
+BOOST_AUTO_TEST_CASE(CoreEventController_Profiling_Pipelined) {
+	PipelinedGRMock region;
+	PipelinedCECMock testController{ &region, 3 };
+	testController.setProfilingEnabled(true);
+
+	testController.runLoop();
+
+	const FrameProfiler* profiler = testController.getProfiler();
+	BOOST_CHECK_EQUAL(profiler->getStatistics(LoopPhase::Frame).sampleCount, 3u);
+	BOOST_CHECK_EQUAL(profiler->getStatistics(LoopPhase::Update).sampleCount, 3u);
+	// Each update sleeps for a millisecond
+	BOOST_CHECK_GE(profiler->getStatistics(LoopPhase::Update).min, 1000);
+}
+
+// Tests that disabling profiling discards the profiler
+BOOST_AUTO_TEST_CASE(CoreEventController_Profiling_Disable) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	testController.setProfilingEnabled(true);
+	BOOST_CHECK_EQUAL(testController.getProfiler()->getCapacity(), CoreEventController::DEFAULT_PROFILER_CAPACITY);
+
+	testController.setProfilingEnabled(false);
+	testController.runLoopIteration(10);
+
+	BOOST_CHECK(!testController.isProfilingEnabled());
+	BOOST_CHECK(testController.getProfiler() == nullptr);
+	BOOST_CHECK_THROW(testController.setProfilingEnabled(true, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CoreEventController_Profiling
+
+BOOST_AUTO_TEST_SUITE(CoreEventController_TextureLoading)
+
+// Tests that each iteration of the main loop uploads the textures requested by the region
+BOOST_AUTO_TEST_CASE(CoreEventController_TextureLoading_UploadsEachIteration) {
+	FixedTimestepGRMock region;
+	FixedTimestepCECMock testController{ &region };
+	TextureLoader loader{ 1 };
+	testController.setTextureLoader(&loader);
+	BOOST_CHECK(testController.getTextureLoader() == &loader);
+
+	const TextureHandle texture = loader.load("Textures/SmallArrow.png");
+	for (int ii = 0; ii < 1000 && texture.getState() == TextureLoadState::Loading; ++ii)
+	{
+		testController.runLoopIteration(10);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	BOOST_CHECK(texture.getState() == TextureLoadState::Loaded);
+	BOOST_CHECK_EQUAL(loader.getPendingCount(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CoreEventController_TextureLoading
+
+BOOST_AUTO_TEST_SUITE(CoreEventController_RegionLifecycle)
+
+/// <summary>
+/// GameRegion that records its lifecycle calls. Its preload can be held until the test releases it.
+/// </summary>
+class LifecycleGRMock : public GB::GameRegion
+{
+public:
+	void preload(PreloadProgress& progress) override {
+		++preloadCount;
+		progress.setProgress(0.5f);
+		while (isPreloadHeld)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		if (shouldPreloadThrow)
+		{
+			throw std::runtime_error("Preload failed");
+		}
+	}
+
+	void activate() override {
+		calls.push_back("activate");
+	}
+
+	void deactivate() override {
+		calls.push_back("deactivate");
+	}
+
+	void unload() override {
+		calls.push_back("unload");
+	}
+
+	void update(sf::Int64) override {
+		++updateCount;
+	}
+
+	std::atomic<int> preloadCount{ 0 };
+	std::atomic<bool> isPreloadHeld{ false };
+	bool shouldPreloadThrow = false;
+	std::vector<std::string> calls;
+	int updateCount = 0;
+};
+
+// Tests that changing to a region that was not preloaded preloads it during the change
+BOOST_AUTO_TEST_CASE(CoreEventController_RegionLifecycle_SwapWithoutPreload) {
+	LifecycleGRMock firstRegion;
+	LifecycleGRMock secondRegion;
+	FixedTimestepCECMock testController{ &firstRegion };
+	BOOST_CHECK(testController.getRegionState(firstRegion) == RegionState::Active);
+	BOOST_CHECK_EQUAL(firstRegion.preloadCount, 1);
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Unloaded);
+
+	firstRegion.setNextRegion(secondRegion);
+	testController.runLoopIteration(10);
+
+	BOOST_CHECK(testController.getActiveRegion() == &secondRegion);
+	BOOST_CHECK_EQUAL(secondRegion.preloadCount, 1);
+	BOOST_CHECK((firstRegion.calls == std::vector<std::string>{ "activate", "deactivate" }));
+	BOOST_CHECK((secondRegion.calls == std::vector<std::string>{ "activate" }));
+	BOOST_CHECK(testController.getRegionState(firstRegion) == RegionState::Ready);
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Active);
+}
+
+// Tests that the active region keeps running while the next region preloads in the background
+BOOST_AUTO_TEST_CASE(CoreEventController_RegionLifecycle_BackgroundPreload) {
+	LifecycleGRMock firstRegion;
+	LifecycleGRMock secondRegion;
+	FixedTimestepCECMock testController{ &firstRegion };
+
+	secondRegion.isPreloadHeld = true;
+	testController.preloadRegion(secondRegion);
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Preloading);
+
+	firstRegion.setNextRegion(secondRegion);
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		testController.runLoopIteration(10);
+	}
+	BOOST_CHECK(testController.getActiveRegion() == &firstRegion);
+	BOOST_CHECK_EQUAL(firstRegion.updateCount, 3);
+	while (secondRegion.preloadCount == 0)
+	{
+		std::this_thread::yield();
+	}
+	BOOST_CHECK_CLOSE(testController.getPreloadProgress(secondRegion), 0.5f, 0.001f);
+
+	secondRegion.isPreloadHeld = false;
+	for (int ii = 0; ii < 1000 && testController.getActiveRegion() != &secondRegion; ++ii)
+	{
+		testController.runLoopIteration(10);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	BOOST_CHECK(testController.getActiveRegion() == &secondRegion);
+	BOOST_CHECK_EQUAL(secondRegion.preloadCount, 1);
+	BOOST_CHECK(testController.getPreloadProgress(secondRegion) == 1.f);
+}
+
+// Tests that a failed preload is reported and leaves the region unloaded
+BOOST_AUTO_TEST_CASE(CoreEventController_RegionLifecycle_PreloadThrows) {
+	LifecycleGRMock firstRegion;
+	LifecycleGRMock secondRegion;
+	FixedTimestepCECMock testController{ &firstRegion };
+
+	secondRegion.shouldPreloadThrow = true;
+	testController.preloadRegion(secondRegion);
+	BOOST_CHECK_THROW(testController.waitForPreload(secondRegion), std::runtime_error);
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Unloaded);
+
+	secondRegion.shouldPreloadThrow = false;
+	testController.waitForPreload(secondRegion);
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Ready);
+	BOOST_CHECK_EQUAL(secondRegion.preloadCount, 2);
+}
+
+// Tests that unloading a region calls unload and that it is preloaded again before its next use
+BOOST_AUTO_TEST_CASE(CoreEventController_RegionLifecycle_Unload) {
+	LifecycleGRMock firstRegion;
+	LifecycleGRMock secondRegion;
+	FixedTimestepCECMock testController{ &firstRegion };
+	BOOST_CHECK_THROW(testController.unloadRegion(firstRegion), std::invalid_argument);
+
+	testController.waitForPreload(secondRegion);
+	testController.unloadRegion(secondRegion);
+	BOOST_CHECK((secondRegion.calls == std::vector<std::string>{ "unload" }));
+	BOOST_CHECK(testController.getRegionState(secondRegion) == RegionState::Unloaded);
+
+	firstRegion.setNextRegion(secondRegion);
+	testController.runLoopIteration(10);
+	BOOST_CHECK_EQUAL(secondRegion.preloadCount, 2);
+	BOOST_CHECK(testController.getActiveRegion() == &secondRegion);
+}
+
+// Tests that a region made where a destroyed Ready region used to be starts Unloaded and is preloaded
+BOOST_AUTO_TEST_CASE(CoreEventController_RegionLifecycle_DestroyedRegion) {
+	LifecycleGRMock firstRegion;
+	FixedTimestepCECMock testController{ &firstRegion };
+
+	// The optional reuses its storage, so the new region has the same address as the destroyed one
+	std::optional<LifecycleGRMock> secondRegion;
+	secondRegion.emplace();
+	const LifecycleGRMock* firstAddress = &*secondRegion;
+	testController.waitForPreload(*secondRegion);
+	BOOST_CHECK(testController.getRegionState(*secondRegion) == RegionState::Ready);
+
+	secondRegion.reset();
+	secondRegion.emplace();
+	BOOST_REQUIRE(&*secondRegion == firstAddress);
+	BOOST_CHECK(testController.getRegionState(*secondRegion) == RegionState::Unloaded);
+
+	firstRegion.setNextRegion(*secondRegion);
+	testController.runLoopIteration(10);
+	BOOST_CHECK(testController.getActiveRegion() == &*secondRegion);
+	BOOST_CHECK_EQUAL(secondRegion->preloadCount, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CoreEventController_RegionLifecycle
+
 BOOST_AUTO_TEST_SUITE_END() // end CoreEventController Tests
\ No newline at end of file
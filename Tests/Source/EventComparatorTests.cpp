@@ -3,6 +3,7 @@
 #include <GameBackbone/UserInput/EventComparator.h>
 
 #include <functional>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -115,4 +116,36 @@ BOOST_AUTO_TEST_SUITE(EventComparatorTests)
 		checkEventCompare(ButtonEventComparator{}, upReleased, { upReleased }, { upPressed, downPressed, mouseButton1Pressed, mouseButton1Released, joystickButton1Pressed, joystickButton1Released });
 	}
 
+	template <class EventComparatorType>
+	void checkEventKeysAgreeWithCompare(EventComparatorType compare, const std::vector<sf::Event>& events)
+	{
+		for (const sf::Event& lhs : events)
+		{
+			for (const sf::Event& rhs : events)
+			{
+				const std::optional<EventKey> lhsKey = compare.getEventKey(lhs);
+				const std::optional<EventKey> rhsKey = compare.getEventKey(rhs);
+				const bool keysEqual = lhsKey && rhsKey && *lhsKey == *rhsKey;
+				BOOST_TEST(keysEqual == std::invoke(compare, lhs, rhs));
+			}
+		}
+	}
+
+	BOOST_FIXTURE_TEST_CASE(EventKeysAgreeWithCompare, SFEventFixture)
+	{
+		sf::Event unknownPressed = upPressed;
+		unknownPressed.key.code = sf::Keyboard::Unknown;
+		const std::vector<sf::Event> events{ upPressed, downPressed, upReleased, downReleased, unknownPressed,
+			mouseButton1Pressed, mouseButton1Released, joystickButton1Pressed, joystickButton1Released };
+
+		static_assert(is_keyed_event_comparator_v<KeyEventComparator>);
+		static_assert(is_keyed_event_comparator_v<ButtonEventComparator>);
+		static_assert(!is_keyed_event_comparator_v<std::function<bool(const sf::Event&, const sf::Event&)>>);
+
+		checkEventKeysAgreeWithCompare(KeyEventComparator{}, events);
+		checkEventKeysAgreeWithCompare(JoystickButtonEventComparator{}, events);
+		checkEventKeysAgreeWithCompare(MouseButtonEventComparator{}, events);
+		checkEventKeysAgreeWithCompare(ButtonEventComparator{}, events);
+	}
+
 BOOST_AUTO_TEST_SUITE_END() // EventComparatorTests
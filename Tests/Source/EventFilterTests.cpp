@@ -140,4 +140,41 @@ BOOST_AUTO_TEST_SUITE(EventFilterTests)
 		checkEventFilter(AnyEventFilter{}, { upReleased, downReleased, mouseButton1Released, joystickButton1Released, upPressed, downPressed, mouseButton1Pressed, joystickButton1Pressed }, {} );
 	}
 
+	/// @brief Checks that a filter only accepts events whose type is in its declared event types, and that it accepts some event
+	///		of every type that it declares.
+	template <class Filter>
+	void checkEventTypes()
+	{
+		for (int type = 0; type < sf::Event::Count; ++type)
+		{
+			sf::Event event{};
+			event.type = static_cast<sf::Event::EventType>(type);
+			const bool isDeclared = ((Filter::eventTypes >> type) & 1) != 0;
+			BOOST_TEST(Filter{}(event) == isDeclared);
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(EventTypesMatchAcceptedEvents)
+	{
+		checkEventTypes<KeyDownEventFilter>();
+		checkEventTypes<KeyUpEventFilter>();
+		checkEventTypes<AnyKeyEventFilter>();
+		checkEventTypes<MouseButtonDownEventFilter>();
+		checkEventTypes<MouseButtonUpEventFilter>();
+		checkEventTypes<AnyMouseButtonEventFilter>();
+		checkEventTypes<JoystickButtonDownEventFilter>();
+		checkEventTypes<JoystickButtonUpEventFilter>();
+		checkEventTypes<AnyJoystickButtonEventFilter>();
+		checkEventTypes<AnyButtonDownEventFilter>();
+		checkEventTypes<AnyButtonUpEventFilter>();
+		checkEventTypes<AnyEventFilter>();
+	}
+
+	BOOST_AUTO_TEST_CASE(UndeclaredEventTypesAreAllEventTypes)
+	{
+		auto filter = [](const sf::Event&) { return true; };
+		static_assert(event_filter_event_types_v<decltype(filter)> == ALL_EVENT_TYPES);
+		static_assert(event_filter_event_types_v<KeyDownEventFilter> == makeEventTypeSet(sf::Event::KeyPressed));
+	}
+
 BOOST_AUTO_TEST_SUITE_END() // EventFilterTests
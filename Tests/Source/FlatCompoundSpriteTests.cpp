@@ -0,0 +1,299 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/AnimatedSprite.h>
+#include <GameBackbone/Core/CompoundSprite.h>
+#include <GameBackbone/Core/FlatCompoundSprite.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(FlatCompoundSpriteTests)
+
+using TestFlatCompoundSprite = FlatCompoundSprite<sf::Sprite, AnimatedSprite, sf::RectangleShape>;
+
+struct ReusableObjects
+{
+	ReusableObjects() {
+		aSpriteTexture.loadFromFile("Textures/testSprite.png");
+
+		sprite = sf::Sprite(aSpriteTexture);
+		sprite.setPosition(1, 1);
+
+		sprite2 = sf::Sprite(aSpriteTexture);
+		sprite2.setPosition(2, 2);
+
+		animatedSprite = AnimatedSprite(aSpriteTexture);
+		animatedSprite.setPosition(10, 10);
+
+		rectangle.setPosition(20, 20);
+	}
+
+	sf::Texture aSpriteTexture;
+	sf::Sprite sprite;
+	sf::Sprite sprite2;
+	AnimatedSprite animatedSprite;
+	sf::RectangleShape rectangle;
+};
+
+class MockDrawable_ForDrawOrder : public sf::Drawable, public sf::Transformable {
+public:
+	MockDrawable_ForDrawOrder(int id, std::vector<int>& drawnIds) : m_id(id), m_drawnIds(&drawnIds) {}
+
+protected:
+	void draw([[maybe_unused]] sf::RenderTarget& target, [[maybe_unused]] sf::RenderStates states) const override
+	{
+		m_drawnIds->push_back(m_id);
+	}
+
+private:
+	int m_id;
+	std::vector<int>* m_drawnIds;
+};
+
+class MockUpdatable_ForUpdateCounts : public sf::Drawable, public sf::Transformable, public Updatable {
+public:
+	void update(sf::Int64 elapsedTime) override
+	{
+		totalElapsedTime += elapsedTime;
+	}
+
+	sf::Int64 totalElapsedTime = 0;
+
+protected:
+	void draw([[maybe_unused]] sf::RenderTarget& target, [[maybe_unused]] sf::RenderStates states) const override {}
+};
+
+BOOST_AUTO_TEST_SUITE(FlatCompoundSprite_CTR)
+
+BOOST_AUTO_TEST_CASE(DefaultCtr_IsEmpty)
+{
+	TestFlatCompoundSprite compoundSprite{};
+
+	BOOST_CHECK(compoundSprite.isEmpty());
+	BOOST_CHECK(compoundSprite.getComponentCount() == 0);
+	BOOST_CHECK(compoundSprite.getPosition() == sf::Vector2f(0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(PositionCtr_SetsPosition)
+{
+	TestFlatCompoundSprite compoundSprite{ sf::Vector2f{ 5.0f, 6.0f } };
+
+	BOOST_CHECK(compoundSprite.isEmpty());
+	BOOST_CHECK(compoundSprite.getPosition() == sf::Vector2f(5.0f, 6.0f));
+}
+
+BOOST_FIXTURE_TEST_CASE(CopyCtr_CopiesComponents, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+	compoundSprite.addComponent(1, rectangle);
+
+	TestFlatCompoundSprite compoundSprite2{ compoundSprite };
+
+	BOOST_CHECK(compoundSprite2.getComponentCount() == 2);
+	BOOST_CHECK(compoundSprite2.getComponentCount(0) == 1);
+	BOOST_CHECK(compoundSprite2.getComponentCount(1) == 1);
+	BOOST_CHECK(&compoundSprite2.getComponent<sf::Sprite>(0) != &compoundSprite.getComponent<sf::Sprite>(0));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FlatCompoundSprite_CTR
+
+BOOST_AUTO_TEST_SUITE(FlatCompoundSprite_Components)
+
+BOOST_FIXTURE_TEST_CASE(AddComponent_StoresComponentsByType, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+	compoundSprite.addComponent(0, sprite2);
+	compoundSprite.addComponent(1, animatedSprite);
+	compoundSprite.addComponent(2, rectangle);
+
+	BOOST_CHECK(compoundSprite.isEmpty() == false);
+	BOOST_CHECK(compoundSprite.getComponentCount() == 4);
+	BOOST_CHECK(compoundSprite.getComponentCount(0) == 2);
+	BOOST_CHECK(compoundSprite.getComponentCount(1) == 1);
+	BOOST_CHECK(compoundSprite.getComponentCount(2) == 1);
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<sf::Sprite>() == 2);
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<AnimatedSprite>() == 1);
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<sf::RectangleShape>() == 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(AddComponent_ReturnsAddedComponent, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	sf::Sprite& addedSprite = compoundSprite.addComponent(0, sprite);
+
+	BOOST_CHECK(&addedSprite == &compoundSprite.getComponent<sf::Sprite>(0));
+	BOOST_CHECK(addedSprite.getTexture() == &aSpriteTexture);
+}
+
+BOOST_FIXTURE_TEST_CASE(AddComponent_KeepsScreenPosition, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{ sf::Vector2f{ 5.0f, 5.0f } };
+	CompoundSprite referenceCompoundSprite{ sf::Vector2f{ 5.0f, 5.0f } };
+
+	sf::Sprite& addedSprite = compoundSprite.addComponent(0, sprite);
+	sf::Sprite& referenceSprite = referenceCompoundSprite.addComponent(0, sprite);
+
+	BOOST_CHECK(addedSprite.getTransform() == sprite.getTransform());
+	BOOST_CHECK(addedSprite.getTransform() == referenceSprite.getTransform());
+}
+
+BOOST_FIXTURE_TEST_CASE(GetComponent_OutOfRange_Throws, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+
+	BOOST_CHECK_THROW(compoundSprite.getComponent<sf::Sprite>(1), std::out_of_range);
+	BOOST_CHECK_THROW(compoundSprite.getComponent<sf::RectangleShape>(0), std::out_of_range);
+}
+
+BOOST_FIXTURE_TEST_CASE(RemoveComponent_RemovesOnlyThatComponent, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+	compoundSprite.addComponent(1, sprite2);
+	compoundSprite.addComponent(1, rectangle);
+
+	compoundSprite.removeComponent(compoundSprite.getComponent<sf::Sprite>(0));
+
+	BOOST_CHECK(compoundSprite.getComponentCount() == 2);
+	BOOST_CHECK(compoundSprite.getComponentCount(0) == 0);
+	BOOST_CHECK(compoundSprite.getComponentCount(1) == 2);
+	BOOST_CHECK(compoundSprite.getComponent<sf::Sprite>(0).getTransform() == sprite2.getTransform());
+}
+
+BOOST_FIXTURE_TEST_CASE(RemoveComponent_NotOwned_DoesNothing, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+
+	compoundSprite.removeComponent(sprite);
+
+	BOOST_CHECK(compoundSprite.getComponentCount() == 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ClearComponents_RemovesAll, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+	compoundSprite.addComponent(1, animatedSprite);
+	compoundSprite.addComponent(2, rectangle);
+
+	compoundSprite.clearComponents();
+
+	BOOST_CHECK(compoundSprite.isEmpty());
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<sf::Sprite>() == 0);
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<AnimatedSprite>() == 0);
+	BOOST_CHECK(compoundSprite.getComponentCountOfType<sf::RectangleShape>() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FlatCompoundSprite_Components
+
+BOOST_AUTO_TEST_SUITE(FlatCompoundSprite_Transform)
+
+// Apply the same operations to a CompoundSprite and a FlatCompoundSprite and check that the components end up with the same transforms
+BOOST_FIXTURE_TEST_CASE(Transforms_MatchCompoundSprite, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{ sf::Vector2f{ 3.0f, 4.0f } };
+	CompoundSprite referenceCompoundSprite{ sf::Vector2f{ 3.0f, 4.0f } };
+
+	sf::Sprite& flatSprite = compoundSprite.addComponent(0, sprite);
+	sf::RectangleShape& flatRectangle = compoundSprite.addComponent(1, rectangle);
+	sf::Sprite& referenceSprite = referenceCompoundSprite.addComponent(0, sprite);
+	sf::RectangleShape& referenceRectangle = referenceCompoundSprite.addComponent(1, rectangle);
+
+	compoundSprite.setOrigin(2.0f, 2.0f);
+	compoundSprite.move(10.0f, -5.0f);
+	compoundSprite.rotate(30.0f);
+	compoundSprite.scale(2.0f, 0.5f);
+	compoundSprite.setPosition(7.0f, 8.0f);
+	compoundSprite.setRotation(45.0f);
+	compoundSprite.setScale(1.5f, 1.5f);
+
+	referenceCompoundSprite.setOrigin(2.0f, 2.0f);
+	referenceCompoundSprite.move(10.0f, -5.0f);
+	referenceCompoundSprite.rotate(30.0f);
+	referenceCompoundSprite.scale(2.0f, 0.5f);
+	referenceCompoundSprite.setPosition(7.0f, 8.0f);
+	referenceCompoundSprite.setRotation(45.0f);
+	referenceCompoundSprite.setScale(1.5f, 1.5f);
+
+	BOOST_CHECK(compoundSprite.getTransform() == referenceCompoundSprite.getTransform());
+	BOOST_CHECK(flatSprite.getTransform() == referenceSprite.getTransform());
+	BOOST_CHECK(flatRectangle.getTransform() == referenceRectangle.getTransform());
+}
+
+BOOST_FIXTURE_TEST_CASE(Move_MovesAllComponents, ReusableObjects)
+{
+	TestFlatCompoundSprite compoundSprite{};
+	compoundSprite.addComponent(0, sprite);
+	compoundSprite.addComponent(0, animatedSprite);
+
+	compoundSprite.move(5.0f, 5.0f);
+
+	BOOST_CHECK(compoundSprite.getPosition() == sf::Vector2f(5.0f, 5.0f));
+	BOOST_CHECK(compoundSprite.getComponent<sf::Sprite>(0).getPosition() == sf::Vector2f(5.0f, 5.0f));
+	BOOST_CHECK(compoundSprite.getComponent<AnimatedSprite>(0).getPosition() == sf::Vector2f(5.0f, 5.0f));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FlatCompoundSprite_Transform
+
+BOOST_AUTO_TEST_SUITE(FlatCompoundSprite_UpdateAndDraw)
+
+BOOST_AUTO_TEST_CASE(Update_ForwardsToUpdatableComponents)
+{
+	FlatCompoundSprite<MockUpdatable_ForUpdateCounts, sf::RectangleShape> compoundSprite{};
+	compoundSprite.addComponent(0, MockUpdatable_ForUpdateCounts{});
+	compoundSprite.addComponent(0, MockUpdatable_ForUpdateCounts{});
+	compoundSprite.addComponent(0, sf::RectangleShape{});
+
+	compoundSprite.update(10);
+	compoundSprite.update(5);
+
+	BOOST_CHECK(compoundSprite.getComponent<MockUpdatable_ForUpdateCounts>(0).totalElapsedTime == 15);
+	BOOST_CHECK(compoundSprite.getComponent<MockUpdatable_ForUpdateCounts>(1).totalElapsedTime == 15);
+}
+
+BOOST_AUTO_TEST_CASE(Draw_DrawsInPriorityThenInsertionOrder)
+{
+	std::vector<int> drawnIds;
+	FlatCompoundSprite<MockDrawable_ForDrawOrder, sf::RectangleShape> compoundSprite{};
+	compoundSprite.addComponent(2, MockDrawable_ForDrawOrder{ 4, drawnIds });
+	compoundSprite.addComponent(0, MockDrawable_ForDrawOrder{ 0, drawnIds });
+	compoundSprite.addComponent(1, sf::RectangleShape{});
+	compoundSprite.addComponent(1, MockDrawable_ForDrawOrder{ 2, drawnIds });
+	compoundSprite.addComponent(1, MockDrawable_ForDrawOrder{ 3, drawnIds });
+	compoundSprite.addComponent(0, MockDrawable_ForDrawOrder{ 1, drawnIds });
+
+	sf::RenderTexture renderTexture;
+	renderTexture.create(10, 10);
+	renderTexture.draw(compoundSprite);
+
+	BOOST_CHECK(drawnIds == std::vector<int>({ 0, 1, 2, 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(Draw_AfterRemove_DrawsRemaining)
+{
+	std::vector<int> drawnIds;
+	FlatCompoundSprite<MockDrawable_ForDrawOrder> compoundSprite{};
+	compoundSprite.addComponent(0, MockDrawable_ForDrawOrder{ 0, drawnIds });
+	compoundSprite.addComponent(1, MockDrawable_ForDrawOrder{ 1, drawnIds });
+	compoundSprite.addComponent(0, MockDrawable_ForDrawOrder{ 2, drawnIds });
+
+	compoundSprite.removeComponent(compoundSprite.getComponent<MockDrawable_ForDrawOrder>(0));
+
+	sf::RenderTexture renderTexture;
+	renderTexture.create(10, 10);
+	renderTexture.draw(compoundSprite);
+
+	BOOST_CHECK(drawnIds == std::vector<int>({ 2, 1 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FlatCompoundSprite_UpdateAndDraw
+
+BOOST_AUTO_TEST_SUITE_END() // FlatCompoundSpriteTests
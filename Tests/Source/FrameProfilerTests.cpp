@@ -0,0 +1,185 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/FrameProfiler.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(FrameProfilerTests)
+
+	BOOST_AUTO_TEST_SUITE(FrameProfiler_CTRs)
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_CTR_Empty)
+		{
+			FrameProfiler profiler{ 16 };
+			BOOST_CHECK_EQUAL(profiler.getCapacity(), 16u);
+			for (std::size_t phaseIndex = 0; phaseIndex < FrameProfiler::PHASE_COUNT; ++phaseIndex)
+			{
+				BOOST_CHECK(profiler.getSamples(static_cast<LoopPhase>(phaseIndex)).empty());
+				BOOST_CHECK_EQUAL(profiler.getStatistics(static_cast<LoopPhase>(phaseIndex)).sampleCount, 0u);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_CTR_ZeroCapacity_Throws)
+		{
+			BOOST_CHECK_THROW(FrameProfiler{ 0 }, std::invalid_argument);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end FrameProfiler_CTRs
+
+	BOOST_AUTO_TEST_SUITE(FrameProfiler_Record)
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Record_KeepsPhasesSeparate)
+		{
+			FrameProfiler profiler{ 16 };
+			profiler.record(LoopPhase::Update, 10, 5);
+			profiler.record(LoopPhase::Update, 20, 6);
+			profiler.record(LoopPhase::Repaint, 30, 7);
+
+			const std::vector<PhaseSample> updateSamples = profiler.getSamples(LoopPhase::Update);
+			BOOST_REQUIRE_EQUAL(updateSamples.size(), 2u);
+			BOOST_CHECK(updateSamples[0].phase == LoopPhase::Update);
+			BOOST_CHECK_EQUAL(updateSamples[0].start, 10);
+			BOOST_CHECK_EQUAL(updateSamples[0].duration, 5);
+			BOOST_CHECK_EQUAL(updateSamples[1].start, 20);
+			BOOST_CHECK_EQUAL(updateSamples[1].duration, 6);
+
+			BOOST_CHECK_EQUAL(profiler.getSamples(LoopPhase::Repaint).size(), 1u);
+			BOOST_CHECK(profiler.getSamples(LoopPhase::HandleEvents).empty());
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Record_OverwritesOldest)
+		{
+			FrameProfiler profiler{ 4 };
+			for (sf::Int64 ii = 0; ii < 10; ++ii)
+			{
+				profiler.record(LoopPhase::Frame, ii, ii);
+			}
+
+			const std::vector<PhaseSample> samples = profiler.getSamples(LoopPhase::Frame);
+			BOOST_REQUIRE_EQUAL(samples.size(), 4u);
+			for (std::size_t ii = 0; ii < samples.size(); ++ii)
+			{
+				BOOST_CHECK_EQUAL(samples[ii].start, static_cast<sf::Int64>(6 + ii));
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Record_Clear)
+		{
+			FrameProfiler profiler{ 4 };
+			profiler.record(LoopPhase::Frame, 0, 1);
+			profiler.clear();
+			BOOST_CHECK(profiler.getSamples(LoopPhase::Frame).empty());
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Record_ScopedTimer)
+		{
+			FrameProfiler profiler{ 4 };
+			{
+				FrameProfiler::ScopedTimer timer(&profiler, LoopPhase::SwapRegion);
+			}
+			{
+				// Does nothing without a profiler
+				FrameProfiler::ScopedTimer timer(nullptr, LoopPhase::SwapRegion);
+			}
+
+			const std::vector<PhaseSample> samples = profiler.getSamples(LoopPhase::SwapRegion);
+			BOOST_REQUIRE_EQUAL(samples.size(), 1u);
+			BOOST_CHECK_GE(samples[0].start, 0);
+			BOOST_CHECK_GE(samples[0].duration, 0);
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Record_ReadWhileRecording)
+		{
+			FrameProfiler profiler{ 8 };
+			std::thread recorder([&profiler]() {
+				for (sf::Int64 ii = 0; ii < 10000; ++ii)
+				{
+					profiler.record(LoopPhase::Update, ii, ii);
+				}
+			});
+
+			// Every sample that is read must be whole and in order
+			for (int ii = 0; ii < 1000; ++ii)
+			{
+				const std::vector<PhaseSample> samples = profiler.getSamples(LoopPhase::Update);
+				BOOST_REQUIRE_LE(samples.size(), 8u);
+				for (std::size_t jj = 0; jj < samples.size(); ++jj)
+				{
+					BOOST_REQUIRE_EQUAL(samples[jj].start, samples[jj].duration);
+					if (jj > 0)
+					{
+						BOOST_REQUIRE_EQUAL(samples[jj].start, samples[jj - 1].start + 1);
+					}
+				}
+			}
+			recorder.join();
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end FrameProfiler_Record
+
+	BOOST_AUTO_TEST_SUITE(FrameProfiler_Statistics)
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Statistics_MinMaxAverage)
+		{
+			FrameProfiler profiler{ 16 };
+			profiler.record(LoopPhase::Update, 0, 4);
+			profiler.record(LoopPhase::Update, 0, 2);
+			profiler.record(LoopPhase::Update, 0, 9);
+
+			const PhaseStatistics statistics = profiler.getStatistics(LoopPhase::Update);
+			BOOST_CHECK_EQUAL(statistics.sampleCount, 3u);
+			BOOST_CHECK_EQUAL(statistics.min, 2);
+			BOOST_CHECK_EQUAL(statistics.max, 9);
+			BOOST_CHECK_CLOSE(statistics.average, 5.0, 0.001);
+			BOOST_CHECK_EQUAL(statistics.p99, 9);
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Statistics_P99)
+		{
+			FrameProfiler profiler{ 200 };
+			for (sf::Int64 ii = 1; ii <= 200; ++ii)
+			{
+				profiler.record(LoopPhase::Frame, 0, ii);
+			}
+
+			// Nearest rank of the 99th percentile of 200 samples is the 198th
+			BOOST_CHECK_EQUAL(profiler.getStatistics(LoopPhase::Frame).p99, 198);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end FrameProfiler_Statistics
+
+	BOOST_AUTO_TEST_SUITE(FrameProfiler_Output)
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Output_Csv)
+		{
+			FrameProfiler profiler{ 4 };
+			profiler.record(LoopPhase::HandleEvents, 1, 2);
+			profiler.record(LoopPhase::Repaint, 3, 4);
+
+			std::ostringstream out;
+			profiler.writeCsv(out);
+			BOOST_CHECK_EQUAL(out.str(), "phase,start_us,duration_us\nHandleEvents,1,2\nRepaint,3,4\n");
+		}
+
+		BOOST_AUTO_TEST_CASE(FrameProfiler_Output_ChromeTrace)
+		{
+			FrameProfiler profiler{ 4 };
+			profiler.record(LoopPhase::Update, 10, 20);
+
+			std::ostringstream out;
+			profiler.writeChromeTrace(out);
+			const std::string trace = out.str();
+			BOOST_CHECK_EQUAL(trace.rfind("{\"traceEvents\":[", 0), 0u);
+			BOOST_CHECK(trace.find("{\"name\":\"Update\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":10,\"dur\":20}") != std::string::npos);
+			BOOST_CHECK(trace.find("\"args\":{\"name\":\"Frame\"}") != std::string::npos);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end FrameProfiler_Output
+
+BOOST_AUTO_TEST_SUITE_END() // end FrameProfilerTests
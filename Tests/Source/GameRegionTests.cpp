@@ -4,6 +4,8 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -26,6 +28,17 @@ BOOST_AUTO_TEST_SUITE(GameRegion_Tests)
 		std::vector<const sf::Drawable*>& drawnVector;
 	};
 
+	class MockBoundedDrawable : public MockDrawable {
+	public:
+		MockBoundedDrawable(std::vector<const sf::Drawable*>& newDrawnVector, sf::FloatRect bounds) : MockDrawable(newDrawnVector), globalBounds(bounds) {};
+
+		sf::FloatRect getGlobalBounds() const {
+			return globalBounds;
+		}
+
+		sf::FloatRect globalBounds;
+	};
+
 	/// This is used to expose the protected member functions from GameRegion
 	class GameRegionChild : public GameRegion
 	{
@@ -34,6 +47,10 @@ BOOST_AUTO_TEST_SUITE(GameRegion_Tests)
 		using GameRegion::addDrawable;
 		using GameRegion::removeDrawable;
 		using GameRegion::clearDrawables;
+		using GameRegion::markDrawableMoved;
+		using GameRegion::updateDrawableBounds;
+		using GameRegion::updateSpatialIndex;
+		using GameRegion::rebuildSpatialIndex;
 	};
 
 	BOOST_AUTO_TEST_SUITE(GameRegion_CTRs)
@@ -245,6 +262,353 @@ BOOST_AUTO_TEST_SUITE(GameRegion_Tests)
 			}
 		}
 
+		// Tests that re-adding a Drawable moves it to the end of its new priority
+		BOOST_AUTO_TEST_CASE(GameRegion_readdDrawable_drawOrder) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			GameRegionChild gameRegion;
+
+			std::vector<const sf::Drawable*> drawnVector;
+			std::vector<MockDrawable> drawableVector(4, MockDrawable{ drawnVector });
+
+			gameRegion.addDrawable(0, drawableVector[0]);
+			gameRegion.addDrawable(0, drawableVector[1]);
+			gameRegion.addDrawable(1, drawableVector[2]);
+			window.draw(gameRegion);
+			drawnVector.clear();
+
+			gameRegion.addDrawable(1, drawableVector[0]);
+			gameRegion.addDrawable(0, drawableVector[3]);
+			window.draw(gameRegion);
+
+			std::vector<const sf::Drawable*> expectedOrder{ &drawableVector[1], &drawableVector[3], &drawableVector[2], &drawableVector[0] };
+			BOOST_CHECK(drawnVector == expectedOrder);
+		}
+
+		// Tests that removed Drawables are not drawn, whether or not they have been drawn before
+		BOOST_AUTO_TEST_CASE(GameRegion_removeDrawable_notDrawn) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			GameRegionChild gameRegion;
+
+			std::vector<const sf::Drawable*> drawnVector;
+			std::vector<MockDrawable> drawableVector(4, MockDrawable{ drawnVector });
+
+			gameRegion.addDrawable(0, drawableVector[0]);
+			gameRegion.addDrawable(0, drawableVector[1]);
+			window.draw(gameRegion);
+			drawnVector.clear();
+
+			gameRegion.addDrawable(0, drawableVector[2]);
+			gameRegion.addDrawable(0, drawableVector[3]);
+			gameRegion.removeDrawable(drawableVector[0]);
+			gameRegion.removeDrawable(drawableVector[3]);
+			window.draw(gameRegion);
+
+			std::vector<const sf::Drawable*> expectedOrder{ &drawableVector[1], &drawableVector[2] };
+			BOOST_CHECK(drawnVector == expectedOrder);
+			BOOST_CHECK(gameRegion.getDrawableCount() == 2);
+		}
+
+		// Tests that the draw order matches a multimap through many adds and removes
+		BOOST_AUTO_TEST_CASE(GameRegion_manyAddAndRemove_drawOrder) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			GameRegionChild gameRegion;
+
+			std::vector<const sf::Drawable*> drawnVector;
+			std::vector<MockDrawable> drawableVector(100, MockDrawable{ drawnVector });
+			std::multimap<int, const sf::Drawable*> expectedDrawables;
+
+			for (int round = 0; round < 5; ++round) {
+				for (int ii = 0; ii < static_cast<int>(drawableVector.size()); ++ii) {
+					// Remove some drawables and move the others to a different priority
+					if ((ii + round) % 3 == 0) {
+						gameRegion.removeDrawable(drawableVector[ii]);
+						auto it = std::find_if(expectedDrawables.begin(), expectedDrawables.end(),
+							[&](const auto& entry) { return entry.second == &drawableVector[ii]; });
+						if (it != expectedDrawables.end()) {
+							expectedDrawables.erase(it);
+						}
+					}
+					else {
+						const int priority = (ii * 7 + round) % 5;
+						gameRegion.addDrawable(priority, drawableVector[ii]);
+						auto it = std::find_if(expectedDrawables.begin(), expectedDrawables.end(),
+							[&](const auto& entry) { return entry.second == &drawableVector[ii]; });
+						if (it != expectedDrawables.end()) {
+							expectedDrawables.erase(it);
+						}
+						expectedDrawables.emplace(priority, &drawableVector[ii]);
+					}
+				}
+
+				drawnVector.clear();
+				window.draw(gameRegion);
+
+				std::vector<const sf::Drawable*> expectedOrder;
+				for (const auto& entry : expectedDrawables) {
+					expectedOrder.push_back(entry.second);
+				}
+				BOOST_CHECK(drawnVector == expectedOrder);
+				BOOST_CHECK(gameRegion.getDrawableCount() == expectedDrawables.size());
+				BOOST_CHECK(gameRegion.getDrawableCount(0) == expectedDrawables.count(0));
+			}
+		}
+
 	BOOST_AUTO_TEST_SUITE_END() // end GameRegion_priority_drawing_tests
 
+	BOOST_AUTO_TEST_SUITE(GameRegion_culling_tests)
+
+		// Tests that culling is off by default
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_disabledByDefault) {
+			GameRegion gameRegion{};
+			BOOST_CHECK(gameRegion.isCullingEnabled() == false);
+		}
+
+		// Tests that drawables outside of the view are not drawn while culling is enabled
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_skipsDrawablesOutsideView) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+			GameRegionChild gameRegion;
+			gameRegion.setCullingEnabled(true);
+
+			std::vector<const sf::Drawable*> drawnVector;
+			MockBoundedDrawable inside{ drawnVector, sf::FloatRect{ 10, 10, 10, 10 } };
+			MockBoundedDrawable overlapping{ drawnVector, sf::FloatRect{ 95, 95, 10, 10 } };
+			MockBoundedDrawable outside{ drawnVector, sf::FloatRect{ 200, 200, 10, 10 } };
+			gameRegion.addDrawable(0, inside);
+			gameRegion.addDrawable(0, overlapping);
+			gameRegion.addDrawable(0, outside);
+
+			window.draw(gameRegion);
+
+			std::vector<const sf::Drawable*> expectedOrder{ &inside, &overlapping };
+			BOOST_CHECK(drawnVector == expectedOrder);
+			BOOST_CHECK(gameRegion.getLastDrawnCount() == 2);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 1);
+		}
+
+		// Tests that every drawable is drawn while culling is disabled
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_disabled_drawsEverything) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+			GameRegionChild gameRegion;
+
+			std::vector<const sf::Drawable*> drawnVector;
+			MockBoundedDrawable outside{ drawnVector, sf::FloatRect{ 200, 200, 10, 10 } };
+			gameRegion.addDrawable(0, outside);
+
+			window.draw(gameRegion);
+
+			BOOST_CHECK(drawnVector.size() == 1);
+			BOOST_CHECK(gameRegion.getLastDrawnCount() == 1);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 0);
+		}
+
+		// Tests that drawables without bounds are never culled
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_unboundedDrawablesDrawn) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+			GameRegionChild gameRegion;
+			gameRegion.setCullingEnabled(true);
+
+			std::vector<const sf::Drawable*> drawnVector;
+			MockDrawable unbounded{ drawnVector };
+			gameRegion.addDrawable(0, unbounded);
+
+			window.draw(gameRegion);
+
+			BOOST_CHECK(drawnVector.size() == 1);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 0);
+		}
+
+		// Tests culling with a user supplied bounds function
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_boundsFunction) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+			GameRegionChild gameRegion;
+			gameRegion.setCullingEnabled(true);
+
+			std::vector<const sf::Drawable*> drawnVector;
+			MockDrawable drawable{ drawnVector };
+			gameRegion.addDrawable(0, drawable, [](const sf::Drawable&) { return sf::FloatRect{ -50, -50, 10, 10 }; });
+
+			window.draw(gameRegion);
+
+			BOOST_CHECK(drawnVector.empty());
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 1);
+		}
+
+		// Tests that the view is moved before culling
+		BOOST_AUTO_TEST_CASE(GameRegion_culling_followsView) {
+			sf::RenderWindow window(sf::VideoMode(1, 1), "windowName");
+			GameRegionChild gameRegion;
+			gameRegion.setCullingEnabled(true);
+
+			std::vector<const sf::Drawable*> drawnVector;
+			MockBoundedDrawable drawable{ drawnVector, sf::FloatRect{ 200, 200, 10, 10 } };
+			gameRegion.addDrawable(0, drawable);
+
+			window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+			window.draw(gameRegion);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 1);
+
+			window.setView(sf::View{ sf::FloatRect{ 150, 150, 100, 100 } });
+			window.draw(gameRegion);
+			BOOST_CHECK(gameRegion.getLastDrawnCount() == 1);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 0);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end GameRegion_culling_tests
+
+	BOOST_AUTO_TEST_SUITE(GameRegion_spatialIndex_tests)
+
+		struct SpatialIndexFixture {
+			SpatialIndexFixture() :
+				inside{ drawnVector, sf::FloatRect{ 10, 10, 10, 10 } },
+				outside{ drawnVector, sf::FloatRect{ 200, 200, 10, 10 } },
+				secondInside{ drawnVector, sf::FloatRect{ 50, 50, 10, 10 } },
+				unbounded{ drawnVector } {
+				window.setView(sf::View{ sf::FloatRect{ 0, 0, 100, 100 } });
+				gameRegion.addDrawable(1, inside);
+				gameRegion.addDrawable(0, outside);
+				gameRegion.addDrawable(0, secondInside);
+				gameRegion.addDrawable(2, unbounded);
+			}
+
+			std::vector<const sf::Drawable*> sorted(std::vector<const sf::Drawable*> results) {
+				std::sort(results.begin(), results.end());
+				return results;
+			}
+
+			sf::RenderWindow window{ sf::VideoMode(1, 1), "windowName" };
+			GameRegionChild gameRegion;
+			std::vector<const sf::Drawable*> drawnVector;
+			MockBoundedDrawable inside;
+			MockBoundedDrawable outside;
+			MockBoundedDrawable secondInside;
+			MockDrawable unbounded;
+		};
+
+		// Tests that the spatial index is off by default
+		BOOST_AUTO_TEST_CASE(GameRegion_spatialIndex_disabledByDefault) {
+			GameRegion gameRegion{};
+			BOOST_CHECK(gameRegion.isSpatialIndexEnabled() == false);
+		}
+
+		// Tests that culling with the spatial index draws the same drawables in the same order
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_culling_drawOrder, SpatialIndexFixture) {
+			gameRegion.setCullingEnabled(true);
+			window.draw(gameRegion);
+			const std::vector<const sf::Drawable*> expectedOrder = drawnVector;
+
+			drawnVector.clear();
+			gameRegion.enableSpatialIndex(25.f);
+			window.draw(gameRegion);
+
+			BOOST_CHECK(gameRegion.isSpatialIndexEnabled());
+			BOOST_CHECK(drawnVector == expectedOrder);
+			BOOST_CHECK((drawnVector == std::vector<const sf::Drawable*>{ &secondInside, &inside, &unbounded }));
+			BOOST_CHECK(gameRegion.getLastDrawnCount() == 3);
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 1);
+		}
+
+		// Tests that drawables added and removed after enabling the index are tracked
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_addAndRemove, SpatialIndexFixture) {
+			gameRegion.setCullingEnabled(true);
+			gameRegion.enableSpatialIndex(25.f);
+
+			MockBoundedDrawable added{ drawnVector, sf::FloatRect{ 80, 80, 5, 5 } };
+			gameRegion.addDrawable(0, added);
+			gameRegion.removeDrawable(inside);
+			gameRegion.removeDrawable(unbounded);
+			window.draw(gameRegion);
+
+			BOOST_CHECK((drawnVector == std::vector<const sf::Drawable*>{ &secondInside, &added }));
+		}
+
+		// Tests the drawable queries with and without the spatial index
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_queries, SpatialIndexFixture) {
+			for (bool isIndexed : { false, true }) {
+				if (isIndexed) {
+					gameRegion.enableSpatialIndex(25.f);
+				}
+
+				std::vector<const sf::Drawable*> results;
+				gameRegion.getDrawablesInArea(sf::FloatRect{ 0, 0, 100, 100 }, results);
+				BOOST_CHECK(sorted(results) == sorted({ &inside, &secondInside }));
+
+				results.clear();
+				gameRegion.getDrawablesAtPoint(sf::Vector2f{ 205, 205 }, results);
+				BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &outside });
+
+				results.clear();
+				gameRegion.getDrawablesInRadius(sf::Vector2f{ 30, 15 }, 15.f, results);
+				BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &inside });
+			}
+		}
+
+		// Tests that moved drawables are found at their new position once their bounds are updated
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_updateDrawableBounds, SpatialIndexFixture) {
+			gameRegion.enableSpatialIndex(25.f);
+			outside.globalBounds = sf::FloatRect{ 30, 30, 10, 10 };
+			gameRegion.updateDrawableBounds(outside);
+
+			std::vector<const sf::Drawable*> results;
+			gameRegion.getDrawablesAtPoint(sf::Vector2f{ 35, 35 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &outside });
+		}
+
+		// Tests that drawables marked as moved are found at their new position by the next query and draw
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_markDrawableMoved, SpatialIndexFixture) {
+			gameRegion.enableSpatialIndex(25.f);
+			gameRegion.setCullingEnabled(true);
+
+			outside.globalBounds = sf::FloatRect{ 30, 30, 10, 10 };
+			gameRegion.markDrawableMoved(outside);
+			std::vector<const sf::Drawable*> results;
+			gameRegion.getDrawablesAtPoint(sf::Vector2f{ 35, 35 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &outside });
+
+			inside.globalBounds = sf::FloatRect{ 300, 300, 10, 10 };
+			gameRegion.markDrawableMoved(inside);
+			gameRegion.markDrawableMoved(inside);
+			window.draw(gameRegion);
+			BOOST_CHECK((drawnVector == std::vector<const sf::Drawable*>{ &outside, &secondInside, &unbounded }));
+			BOOST_CHECK(gameRegion.getLastCulledCount() == 1);
+		}
+
+		// Tests that a drawable removed after being marked as moved is not touched by the next query
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_markDrawableMoved_thenRemoved, SpatialIndexFixture) {
+			gameRegion.enableSpatialIndex(25.f);
+			{
+				MockBoundedDrawable temporary{ drawnVector, sf::FloatRect{ 30, 30, 10, 10 } };
+				gameRegion.addDrawable(0, temporary);
+				gameRegion.markDrawableMoved(temporary);
+				gameRegion.removeDrawable(temporary);
+			}
+
+			std::vector<const sf::Drawable*> results;
+			gameRegion.getDrawablesAtPoint(sf::Vector2f{ 35, 35 }, results);
+			BOOST_CHECK(results.empty());
+		}
+
+		// Tests that updating and rebuilding the index finds every moved drawable
+		BOOST_FIXTURE_TEST_CASE(GameRegion_spatialIndex_updateAndRebuild, SpatialIndexFixture) {
+			gameRegion.enableSpatialIndex(25.f);
+			gameRegion.setCullingEnabled(true);
+
+			inside.globalBounds = sf::FloatRect{ 300, 300, 10, 10 };
+			outside.globalBounds = sf::FloatRect{ 30, 30, 10, 10 };
+			gameRegion.updateSpatialIndex();
+			window.draw(gameRegion);
+			BOOST_CHECK((drawnVector == std::vector<const sf::Drawable*>{ &outside, &secondInside, &unbounded }));
+
+			inside.globalBounds = sf::FloatRect{ 10, 10, 10, 10 };
+			gameRegion.rebuildSpatialIndex();
+			drawnVector.clear();
+			window.draw(gameRegion);
+			BOOST_CHECK((drawnVector == std::vector<const sf::Drawable*>{ &outside, &secondInside, &inside, &unbounded }));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end GameRegion_spatialIndex_tests
+
 BOOST_AUTO_TEST_SUITE_END() // end GameRegion_tests
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include "stdafx.h"
+
+#include <GameBackbone/UserInput/ButtonGestureHandler.h>
+#include <GameBackbone/UserInput/EventComparator.h>
+#include <GameBackbone/UserInput/GestureMatchSignaler.h>
+#include <GameBackbone/UserInput/GestureTrieHandler.h>
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(GestureTrieHandlerTests)
+
+	struct GestureTrieHandlerFixture
+	{
+		using TestMatchSignaler = GestureMatchSignaler<KeyEventComparator, AnyEventFilter>;
+
+		static sf::Event makeKeyEvent(sf::Event::EventType type, sf::Keyboard::Key key)
+		{
+			sf::Event event{};
+			event.type = type;
+			event.key = sf::Event::KeyEvent{ key, false, false, false, false };
+			return event;
+		}
+
+		sf::Event aPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::A);
+		sf::Event bPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::B);
+		sf::Event cPressed = makeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::C);
+		sf::Event aReleased = makeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::A);
+
+		GestureTrieHandler<TestMatchSignaler> handler;
+	};
+
+	BOOST_AUTO_TEST_SUITE(HandleEventResults)
+
+		BOOST_FIXTURE_TEST_CASE(HandleEventFalseWhenNoGesturesAreBound, GestureTrieHandlerFixture)
+		{
+			BOOST_TEST(!handler.handleEvent(0, aPressed));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(HandleEventReturnsTrueWhenEventMatchesGesture, GestureTrieHandlerFixture)
+		{
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, []() {}));
+			BOOST_TEST(handler.handleEvent(0, aPressed));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(HandleEventReturnsFalseWhenEventDoesNotMatchGesture, GestureTrieHandlerFixture)
+		{
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, []() {}));
+			BOOST_TEST(!handler.handleEvent(0, bPressed));
+			BOOST_TEST(!handler.handleEvent(0, aReleased));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(CompletingGestureFiresAction, GestureTrieHandlerFixture)
+		{
+			int fireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, [&fireCount]() { ++fireCount; }));
+
+			handler.handleEvent(0, aPressed);
+			BOOST_TEST(fireCount == 0);
+			handler.handleEvent(0, bPressed);
+			BOOST_TEST(fireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(GesturesWithSharedPrefixFireIndependently, GestureTrieHandlerFixture)
+		{
+			int abFireCount = 0;
+			int acFireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, [&abFireCount]() { ++abFireCount; }));
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, cPressed }, [&acFireCount]() { ++acFireCount; }));
+
+			handler.handleEvent(0, aPressed);
+			handler.handleEvent(0, cPressed);
+			BOOST_TEST(abFireCount == 0);
+			BOOST_TEST(acFireCount == 1);
+
+			handler.handleEvent(0, aPressed);
+			handler.handleEvent(0, bPressed);
+			BOOST_TEST(abFireCount == 1);
+			BOOST_TEST(acFireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SlowInputDoesNotMatch, GestureTrieHandlerFixture)
+		{
+			int fireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, [&fireCount]() { ++fireCount; },
+				TestMatchSignaler::MatchBehavior::Block, 10));
+
+			handler.handleEvent(0, aPressed);
+			BOOST_TEST(!handler.handleEvent(10, bPressed));
+			BOOST_TEST(fireCount == 0);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(ActionsFireInTheOrderTheyWereAdded, GestureTrieHandlerFixture)
+		{
+			std::vector<int> firedActions;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, aPressed }, [&firedActions]() { firedActions.push_back(0); }));
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed }, [&firedActions]() { firedActions.push_back(1); },
+				TestMatchSignaler::MatchBehavior::Reset));
+
+			handler.handleEvent(0, aPressed);
+			handler.handleEvent(0, aPressed);
+			BOOST_TEST(firedActions == std::vector<int>({ 1, 0, 1 }));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // HandleEventResults
+
+	BOOST_AUTO_TEST_SUITE(GestureAccess)
+
+		BOOST_FIXTURE_TEST_CASE(AddMatchSignalerIncreasesCount, GestureTrieHandlerFixture)
+		{
+			const TestMatchSignaler& added = handler.addMatchSignaler(TestMatchSignaler({ aPressed }, []() {}));
+			BOOST_TEST(handler.getMatchSignalerCount() == 1);
+			BOOST_TEST(added.getGesture().size() == 1);
+			BOOST_TEST(&handler.getMatchSignaler(0) == &added);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(GesturesShareNodesForSharedPrefixes, GestureTrieHandlerFixture)
+		{
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed, cPressed }, []() {}));
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed, aPressed }, []() {}));
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, []() {}));
+
+			// The root, a, ab, abc, and aba
+			BOOST_TEST(handler.getNodeCount() == 5);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(RemoveMatchSignalerStopsItFromFiring, GestureTrieHandlerFixture)
+		{
+			int firstFireCount = 0;
+			int secondFireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed }, [&firstFireCount]() { ++firstFireCount; }));
+			handler.addMatchSignaler(TestMatchSignaler({ bPressed }, [&secondFireCount]() { ++secondFireCount; }));
+
+			handler.removeMatchSignaler(0);
+			BOOST_TEST(handler.getMatchSignalerCount() == 1);
+			BOOST_TEST(handler.getNodeCount() == 2);
+
+			BOOST_TEST(!handler.handleEvent(0, aPressed));
+			BOOST_TEST(handler.handleEvent(0, bPressed));
+			BOOST_TEST(firstFireCount == 0);
+			BOOST_TEST(secondFireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(RemoveMatchSignalerThrowsOutOfRange, GestureTrieHandlerFixture)
+		{
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed }, []() {}));
+			BOOST_CHECK_THROW(handler.removeMatchSignaler(1), std::out_of_range);
+			BOOST_CHECK_THROW(handler.getMatchSignaler(1), std::out_of_range);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(CopiedHandlerMatchesIndependently, GestureTrieHandlerFixture)
+		{
+			int fireCount = 0;
+			handler.addMatchSignaler(TestMatchSignaler({ aPressed, bPressed }, [&fireCount]() { ++fireCount; }));
+			handler.handleEvent(0, aPressed);
+
+			GestureTrieHandler<TestMatchSignaler> copy = handler;
+			copy.reset();
+			BOOST_TEST(!copy.handleEvent(0, bPressed));
+			BOOST_TEST(handler.handleEvent(0, bPressed));
+			BOOST_TEST(fireCount == 1);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // GestureAccess
+
+	BOOST_AUTO_TEST_SUITE(MatchesButtonGestureHandler)
+
+		/// @brief Feeds the same random events to a GB::ButtonGestureHandler and a GB::GestureTrieHandler holding the same random
+		///		gestures and checks that they consume the same events and fire the same actions in the same order.
+		template <class Signaler>
+		void checkMatchesButtonGestureHandler(unsigned int seed, sf::Event::EventType gestureEventType)
+		{
+			const std::vector<sf::Event::EventType> eventTypes{ sf::Event::KeyPressed, sf::Event::KeyReleased, sf::Event::MouseButtonPressed };
+			const std::vector<sf::Keyboard::Key> keys{ sf::Keyboard::A, sf::Keyboard::B, sf::Keyboard::C, sf::Keyboard::Unknown };
+			const std::vector<typename Signaler::MatchBehavior> behaviors{
+				Signaler::MatchBehavior::Block, Signaler::MatchBehavior::Reset, Signaler::MatchBehavior::Penultimate };
+
+			std::mt19937 generator{ seed };
+			auto pick = [&generator](const auto& choices) {
+				return choices[std::uniform_int_distribution<std::size_t>{ 0, choices.size() - 1 }(generator)];
+			};
+			auto makeEvent = [&](sf::Event::EventType type) {
+				sf::Event event{};
+				event.type = type;
+				if (type == sf::Event::MouseButtonPressed)
+				{
+					event.mouseButton.button = sf::Mouse::Left;
+				}
+				else
+				{
+					event.key = sf::Event::KeyEvent{ pick(keys), false, false, false, false };
+				}
+				return event;
+			};
+
+			std::vector<std::size_t> expectedActions;
+			std::vector<std::size_t> actualActions;
+			ButtonGestureHandler<Signaler> expectedHandler;
+			GestureTrieHandler<Signaler> actualHandler;
+			for (std::size_t ii = 0; ii < 40; ++ii)
+			{
+				std::vector<sf::Event> gesture;
+				const std::size_t gestureLength = std::uniform_int_distribution<std::size_t>{ 0, 4 }(generator);
+				for (std::size_t jj = 0; jj < gestureLength; ++jj)
+				{
+					gesture.push_back(makeEvent(gestureEventType));
+				}
+				const auto behavior = pick(behaviors);
+				const sf::Int64 maxTimeBetweenInputs = std::uniform_int_distribution<sf::Int64>{ 0, 12 }(generator);
+
+				expectedHandler.addMatchSignaler(Signaler(gesture, [&expectedActions, ii]() { expectedActions.push_back(ii); },
+					behavior, maxTimeBetweenInputs));
+				actualHandler.addMatchSignaler(Signaler(gesture, [&actualActions, ii]() { actualActions.push_back(ii); },
+					behavior, maxTimeBetweenInputs));
+			}
+
+			for (std::size_t ii = 0; ii < 5000; ++ii)
+			{
+				// Mostly matchable events with the occasional other event
+				const sf::Event::EventType type = std::uniform_int_distribution<int>{ 0, 9 }(generator) == 0 ? pick(eventTypes) : gestureEventType;
+				const sf::Event event = makeEvent(type);
+				const sf::Int64 elapsedTime = std::uniform_int_distribution<sf::Int64>{ 0, 12 }(generator);
+
+				const bool expectedConsumed = expectedHandler.handleEvent(elapsedTime, event);
+				const bool actualConsumed = actualHandler.handleEvent(elapsedTime, event);
+				BOOST_REQUIRE(expectedConsumed == actualConsumed);
+				BOOST_REQUIRE(expectedActions == actualActions);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(MatchesWithAnyEventFilter)
+		{
+			for (unsigned int seed = 0; seed < 20; ++seed)
+			{
+				checkMatchesButtonGestureHandler<GestureMatchSignaler<KeyEventComparator, AnyEventFilter>>(seed, sf::Event::KeyPressed);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(MatchesWithKeyDownEventFilter)
+		{
+			for (unsigned int seed = 0; seed < 20; ++seed)
+			{
+				checkMatchesButtonGestureHandler<KeyDownMatchSignaler>(seed, sf::Event::KeyPressed);
+			}
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // MatchesButtonGestureHandler
+
+BOOST_AUTO_TEST_SUITE_END() // GestureTrieHandlerTests
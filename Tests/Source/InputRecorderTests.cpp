@@ -119,6 +119,32 @@ BOOST_AUTO_TEST_SUITE(InputRecorderTests)
 			BOOST_TEST(CompareBinds(bindToCompare, testBind));
 		}
 
+		BOOST_FIXTURE_TEST_CASE(CompletedBindWithFunctionPointerAction, InputHandlerConsumeEventFixture)
+		{
+			static int fireCount = 0;
+			inputRecorder.handleEvent(0, upPressed);
+			auto testBind = inputRecorder.getCompletedBind<void(*)()>([]() { ++fireCount; });
+
+			static_assert(std::is_same_v<decltype(testBind)::ActionType, void(*)()>);
+			BOOST_TEST(testBind.getGesture().size() == 1);
+			testBind.processEvent(0, upPressed);
+			BOOST_TEST(fireCount == 1);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(CompletedBindWithCompactGesture, InputHandlerConsumeEventFixture)
+		{
+			int fireCount = 0;
+			inputRecorder.handleEvent(0, upPressed);
+			inputRecorder.handleEvent(0, downPressed);
+			auto testBind = inputRecorder.getCompletedBind<std::function<void()>, CompactGesture<>>([&fireCount]() { ++fireCount; });
+
+			BOOST_TEST(testBind.getGesture().size() == 2);
+			BOOST_TEST((testBind.getGesture()[0] == *KeyEventComparator{}.getEventKey(upPressed)));
+			testBind.processEvent(0, upPressed);
+			testBind.processEvent(0, downPressed);
+			BOOST_TEST(fireCount == 1);
+		}
+
 	BOOST_AUTO_TEST_SUITE_END() // ValidCases
 	
 BOOST_AUTO_TEST_SUITE_END() // InputRecorderTests
@@ -328,5 +328,145 @@ BOOST_AUTO_TEST_CASE(InputRouterCanStoreDifferentTypesOfInputHandlers)
 }
 
 
+/// @brief A TestInputHandler that only takes key presses.
+class KeyPressedInputHandler : public TestInputHandler
+{
+public:
+	static constexpr EventTypeSet handledEventTypes = makeEventTypeSet(sf::Event::KeyPressed);
+
+	using TestInputHandler::TestInputHandler;
+};
+
+BOOST_AUTO_TEST_CASE(InputRouterOnlyOffersEventsToHandlersThatTakeTheirType)
+{
+	std::array inputCount{ 0, 0 };
+
+	InputRouter router
+	{
+		KeyPressedInputHandler
+		{
+			[&](sf::Int64, const sf::Event&)
+			{
+				++inputCount[0];
+				return false;
+			}
+		},
+		TestInputHandler
+		{
+			[&](sf::Int64, const sf::Event&)
+			{
+				++inputCount[1];
+				return false;
+			}
+		}
+	};
+
+	sf::Event mouseMoved{};
+	mouseMoved.type = sf::Event::MouseMoved;
+	router.handleEvent(0, mouseMoved);
+	BOOST_CHECK(inputCount[0] == 0);
+	BOOST_CHECK(inputCount[1] == 1);
+
+	sf::Event keyPressed{};
+	keyPressed.type = sf::Event::KeyPressed;
+	router.handleEvent(0, keyPressed);
+	BOOST_CHECK(inputCount[0] == 1);
+	BOOST_CHECK(inputCount[1] == 2);
+
+	// Types past sf::Event::Count only reach handlers that take every type
+	sf::Event unknownEvent{};
+	unknownEvent.type = sf::Event::Count;
+	router.handleEvent(0, unknownEvent);
+	BOOST_CHECK(inputCount[0] == 1);
+	BOOST_CHECK(inputCount[1] == 3);
+}
+
+BOOST_AUTO_TEST_CASE(InputRouterKeepsTrackOfTimeForSkippedHandlers)
+{
+	sf::Int64 elapsedTime = 0;
+
+	InputRouter router
+	{
+		KeyPressedInputHandler
+		{
+			[&](sf::Int64 handlerElapsedTime, const sf::Event&)
+			{
+				elapsedTime = handlerElapsedTime;
+				return true;
+			}
+		}
+	};
+
+	sf::Event mouseMoved{};
+	mouseMoved.type = sf::Event::MouseMoved;
+	sf::Event keyPressed{};
+	keyPressed.type = sf::Event::KeyPressed;
+
+	router.handleEvent(1, keyPressed);
+	BOOST_CHECK(elapsedTime == 1);
+
+	// Skipped events still count toward the time since the handler was last called
+	router.handleEvent(2, mouseMoved);
+	router.handleEvent(3, mouseMoved);
+	router.handleEvent(4, keyPressed);
+	BOOST_CHECK(elapsedTime == 9);
+}
+
+BOOST_AUTO_TEST_CASE(FilteredInputHandlerOnlyHandlesEventsThatPassTheFilter)
+{
+	int inputCount = 0;
+	sf::Int64 elapsedTime = 0;
+	FilteredInputHandler<KeyDownEventFilter, TestInputHandler> filteredHandler
+	{
+		TestInputHandler
+		{
+			[&](sf::Int64 handlerElapsedTime, const sf::Event&)
+			{
+				elapsedTime = handlerElapsedTime;
+				++inputCount;
+				return true;
+			}
+		}
+	};
+	static_assert(handled_event_types_v<decltype(filteredHandler)> == KeyDownEventFilter::eventTypes);
+
+	sf::Event keyReleased{};
+	keyReleased.type = sf::Event::KeyReleased;
+	sf::Event keyPressed{};
+	keyPressed.type = sf::Event::KeyPressed;
+
+	BOOST_TEST(!filteredHandler.handleEvent(2, keyReleased));
+	BOOST_TEST(inputCount == 0);
+
+	// The time of the filtered event is passed along with the next event
+	BOOST_TEST(filteredHandler.handleEvent(3, keyPressed));
+	BOOST_TEST(inputCount == 1);
+	BOOST_TEST(elapsedTime == 5);
+}
+
+BOOST_AUTO_TEST_CASE(FilteredGestureHandlerKeepsGestureThroughOtherEvents)
+{
+	int fireCount = 0;
+	KeyboardGestureHandler keyboardHandler;
+	sf::Event aPressed{};
+	aPressed.type = sf::Event::KeyPressed;
+	aPressed.key.code = sf::Keyboard::A;
+	sf::Event bPressed = aPressed;
+	bPressed.key.code = sf::Keyboard::B;
+	keyboardHandler.addMatchSignaler(KeyDownMatchSignaler{ { aPressed, bPressed }, [&fireCount]() { ++fireCount; } });
+
+	InputRouter router
+	{
+		FilteredInputHandler<KeyDownEventFilter, KeyboardGestureHandler>{ std::move(keyboardHandler) }
+	};
+
+	sf::Event mouseMoved{};
+	mouseMoved.type = sf::Event::MouseMoved;
+	router.handleEvent(0, aPressed);
+	router.handleEvent(0, mouseMoved);
+	router.handleEvent(0, bPressed);
+	BOOST_TEST(fireCount == 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // InputRouterTests
 
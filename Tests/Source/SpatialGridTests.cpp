@@ -0,0 +1,253 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/SpatialGrid.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(SpatialGridTests)
+
+	struct SpatialGridFixture
+	{
+		SpatialGridFixture() : drawables(4), grid(10.f)
+		{
+			grid.insert(drawables[0], sf::FloatRect{ 1, 1, 5, 5 });
+			grid.insert(drawables[1], sf::FloatRect{ 25, 25, 5, 5 });
+			// Spans several cells
+			grid.insert(drawables[2], sf::FloatRect{ 5, 5, 30, 3 });
+			grid.insert(drawables[3], sf::FloatRect{ -40, -40, 5, 5 });
+		}
+
+		// Sorts the results so that they can be compared regardless of order
+		std::vector<const sf::Drawable*> sorted(std::vector<const sf::Drawable*> results)
+		{
+			std::sort(results.begin(), results.end());
+			return results;
+		}
+
+		std::vector<sf::Sprite> drawables;
+		SpatialGrid grid;
+	};
+
+	BOOST_AUTO_TEST_SUITE(SpatialGrid_CTRs)
+
+		BOOST_AUTO_TEST_CASE(SpatialGrid_CTR_Empty)
+		{
+			SpatialGrid grid{ 32.f };
+
+			BOOST_CHECK(grid.getDrawableCount() == 0);
+			BOOST_CHECK(grid.getCellSize() == 32.f);
+		}
+
+		BOOST_AUTO_TEST_CASE(SpatialGrid_CTR_NonPositiveCellSize_Throws)
+		{
+			BOOST_CHECK_THROW(SpatialGrid{ 0.f }, std::invalid_argument);
+			BOOST_CHECK_THROW(SpatialGrid{ -1.f }, std::invalid_argument);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end SpatialGrid_CTRs
+
+	BOOST_AUTO_TEST_SUITE(SpatialGrid_Modify)
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_Contains, SpatialGridFixture)
+		{
+			BOOST_CHECK(grid.getDrawableCount() == 4);
+			for (const sf::Sprite& drawable : drawables)
+			{
+				BOOST_CHECK(grid.contains(drawable));
+			}
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_Existing_UpdatesBounds, SpatialGridFixture)
+		{
+			grid.insert(drawables[0], sf::FloatRect{ 101, 101, 5, 5 });
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryPoint(sf::Vector2f{ 3, 3 }, results);
+			BOOST_CHECK(results.empty());
+
+			grid.queryPoint(sf::Vector2f{ 103, 103 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &drawables[0] });
+			BOOST_CHECK(grid.getDrawableCount() == 4);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Remove, SpatialGridFixture)
+		{
+			grid.remove(drawables[0]);
+			grid.remove(drawables[2]);
+
+			BOOST_CHECK(grid.getDrawableCount() == 2);
+			BOOST_CHECK(!grid.contains(drawables[0]));
+			BOOST_CHECK(grid.contains(drawables[3]));
+
+			// The remaining drawables are still found after being moved within the grid
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ -100, -100, 200, 200 }, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[1], &drawables[3] }));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Remove_NotInGrid_DoesNothing, SpatialGridFixture)
+		{
+			sf::Sprite other;
+			grid.remove(other);
+
+			BOOST_CHECK(grid.getDrawableCount() == 4);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Clear, SpatialGridFixture)
+		{
+			grid.clear();
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ -100, -100, 200, 200 }, results);
+			BOOST_CHECK(grid.getDrawableCount() == 0);
+			BOOST_CHECK(results.empty());
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end SpatialGrid_Modify
+
+	BOOST_AUTO_TEST_SUITE(SpatialGrid_Query)
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_QueryArea, SpatialGridFixture)
+		{
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ 0, 0, 20, 20 }, results);
+
+			// Drawables that span several queried cells are only found once
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[2] }));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_QueryArea_LargeArea, SpatialGridFixture)
+		{
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ -10000, -10000, 20000, 20000 }, results);
+
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[1], &drawables[2], &drawables[3] }));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_QueryPoint, SpatialGridFixture)
+		{
+			std::vector<const sf::Drawable*> results;
+			grid.queryPoint(sf::Vector2f{ 5.5f, 5.5f }, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[2] }));
+
+			results.clear();
+			grid.queryPoint(sf::Vector2f{ 50, 50 }, results);
+			BOOST_CHECK(results.empty());
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_QueryRadius, SpatialGridFixture)
+		{
+			std::vector<const sf::Drawable*> results;
+			grid.queryRadius(sf::Vector2f{ 32, 20 }, 6.f, results);
+
+			// drawables[1] is 5 away and drawables[2] is 12 away
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &drawables[1] });
+		}
+
+		BOOST_AUTO_TEST_CASE(SpatialGrid_IsWithinRadius)
+		{
+			const sf::FloatRect bounds{ 0, 0, 10, 10 };
+
+			BOOST_CHECK(SpatialGrid::isWithinRadius(bounds, sf::Vector2f{ 5, 5 }, 0.f));
+			BOOST_CHECK(SpatialGrid::isWithinRadius(bounds, sf::Vector2f{ 13, 14 }, 5.f));
+			BOOST_CHECK(!SpatialGrid::isWithinRadius(bounds, sf::Vector2f{ 14, 14 }, 5.f));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end SpatialGrid_Query
+
+	BOOST_AUTO_TEST_SUITE(SpatialGrid_OversizedBounds)
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_HugeBounds_FoundByEveryQuery, SpatialGridFixture)
+		{
+			sf::Sprite hugeDrawable;
+			grid.insert(hugeDrawable, sf::FloatRect{ -1e30f, -1e30f, 2e30f, 2e30f });
+			BOOST_CHECK(grid.contains(hugeDrawable));
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ 0, 0, 20, 20 }, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[2], &hugeDrawable }));
+
+			results.clear();
+			grid.queryPoint(sf::Vector2f{ 50, 50 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &hugeDrawable });
+
+			results.clear();
+			grid.queryRadius(sf::Vector2f{ 32, 20 }, 6.f, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[1], &hugeDrawable }));
+
+			grid.remove(hugeDrawable);
+			results.clear();
+			grid.queryPoint(sf::Vector2f{ 50, 50 }, results);
+			BOOST_CHECK(results.empty());
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_InfiniteBounds_FoundByEveryQuery, SpatialGridFixture)
+		{
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+			sf::Sprite infiniteDrawable;
+			grid.insert(infiniteDrawable, sf::FloatRect{ 0, 0, infinity, infinity });
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryPoint(sf::Vector2f{ 1e20f, 50 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &infiniteDrawable });
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_NaNBounds_NeverFound, SpatialGridFixture)
+		{
+			constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+			sf::Sprite nanDrawable;
+			grid.insert(nanDrawable, sf::FloatRect{ nan, 0, 10, 10 });
+			BOOST_CHECK(grid.contains(nanDrawable));
+			BOOST_CHECK(grid.getDrawableCount() == 5);
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryArea(sf::FloatRect{ 0, 0, 20, 20 }, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[2] }));
+
+			grid.remove(nanDrawable);
+			BOOST_CHECK(!grid.contains(nanDrawable));
+			BOOST_CHECK(grid.getDrawableCount() == 4);
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Insert_Existing_OversizedToSmall_MovesIntoCells, SpatialGridFixture)
+		{
+			grid.insert(drawables[0], sf::FloatRect{ -1e30f, -1e30f, 2e30f, 2e30f });
+			grid.insert(drawables[0], sf::FloatRect{ 41, 41, 5, 5 });
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryPoint(sf::Vector2f{ 2, 2 }, results);
+			BOOST_CHECK(results.empty());
+
+			grid.queryPoint(sf::Vector2f{ 42, 42 }, results);
+			BOOST_CHECK(results == std::vector<const sf::Drawable*>{ &drawables[0] });
+		}
+
+		BOOST_FIXTURE_TEST_CASE(SpatialGrid_Query_NonFiniteArea, SpatialGridFixture)
+		{
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+			constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+			std::vector<const sf::Drawable*> results;
+			grid.queryRadius(sf::Vector2f{ 0, 0 }, infinity, results);
+			BOOST_CHECK(sorted(results) == sorted({ &drawables[0], &drawables[1], &drawables[2], &drawables[3] }));
+
+			// An area that is not a number looks at every drawable instead of computing its cells
+			results.clear();
+			grid.queryArea(sf::FloatRect{ nan, nan, nan, nan }, results);
+			BOOST_CHECK(results.size() <= 4);
+
+			results.clear();
+			grid.queryPoint(sf::Vector2f{ nan, 5 }, results);
+			BOOST_CHECK(results.empty());
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end SpatialGrid_OversizedBounds
+
+BOOST_AUTO_TEST_SUITE_END() // end SpatialGridTests
@@ -0,0 +1,154 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/AnimationSet.h>
+#include <GameBackbone/Core/TextureAtlas.h>
+#include <GameBackbone/Core/UniformAnimationSet.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(TextureAtlasTests)
+
+	/// @brief Returns an image of size filled with color.
+	sf::Image makeImage(unsigned int width, unsigned int height, sf::Color color)
+	{
+		sf::Image image;
+		image.create(width, height, color);
+		return image;
+	}
+
+	/// @brief True if the two rects share any pixel.
+	bool isOverlapping(const sf::IntRect& left, const sf::IntRect& right)
+	{
+		return left.left < right.left + right.width && right.left < left.left + left.width &&
+			left.top < right.top + right.height && right.top < left.top + left.height;
+	}
+
+	BOOST_AUTO_TEST_SUITE(TextureAtlas_Packing)
+
+		BOOST_AUTO_TEST_CASE(TextureAtlas_Build_PacksImagesWithoutOverlap)
+		{
+			TextureAtlasBuilder builder{ 128, 1 };
+			std::vector<std::string> names;
+			for (unsigned int ii = 0; ii < 12; ++ii)
+			{
+				names.push_back("image" + std::to_string(ii));
+				builder.addImage(names.back(), makeImage(8 + ii * 3, 40 - ii * 2, sf::Color::Red));
+			}
+			BOOST_CHECK_EQUAL(builder.getImageCount(), 12u);
+
+			const TextureAtlas atlas = builder.build();
+			BOOST_CHECK_EQUAL(atlas.getPageCount(), 1u);
+			BOOST_CHECK_EQUAL(builder.getImageCount(), 0u);
+
+			const sf::Vector2u pageSize = atlas.getTexture(0).getSize();
+			for (std::size_t ii = 0; ii < names.size(); ++ii)
+			{
+				const TextureAtlas::Region& region = atlas.getRegion(names[ii]);
+				BOOST_CHECK_EQUAL(region.page, 0u);
+				BOOST_CHECK_EQUAL(region.bounds.width, static_cast<int>(8 + ii * 3));
+				BOOST_CHECK(region.bounds.left + region.bounds.width <= static_cast<int>(pageSize.x));
+				BOOST_CHECK(region.bounds.top + region.bounds.height <= static_cast<int>(pageSize.y));
+				for (std::size_t jj = ii + 1; jj < names.size(); ++jj)
+				{
+					BOOST_CHECK(!isOverlapping(region.bounds, atlas.getRegion(names[jj]).bounds));
+				}
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureAtlas_Build_StartsNewPageWhenFull)
+		{
+			TextureAtlasBuilder builder{ 64, 0 };
+			builder.addImage("first", makeImage(64, 40, sf::Color::Red));
+			builder.addImage("second", makeImage(64, 40, sf::Color::Green));
+			builder.addImage("third", makeImage(32, 24, sf::Color::Blue));
+
+			const TextureAtlas atlas = builder.build();
+			BOOST_CHECK_EQUAL(atlas.getPageCount(), 2u);
+			BOOST_CHECK(atlas.getRegion("first").page != atlas.getRegion("second").page);
+			// The small image fits under the first tall image
+			BOOST_CHECK_EQUAL(atlas.getRegion("third").page, atlas.getRegion("first").page);
+			BOOST_CHECK(&atlas.getTexture("third") == &atlas.getTexture(atlas.getRegion("first").page));
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureAtlas_Build_CopiesPixels)
+		{
+			TextureAtlasBuilder builder{ 64, 1 };
+			builder.addImage("red", makeImage(4, 4, sf::Color::Red));
+			builder.addImage("blue", makeImage(2, 2, sf::Color::Blue));
+			const TextureAtlas atlas = builder.build();
+
+			const sf::Image& page = atlas.getPageImage(0);
+			const sf::IntRect& blue = atlas.getRegion("blue").bounds;
+			const sf::IntRect& red = atlas.getRegion("red").bounds;
+			BOOST_CHECK(page.getPixel(static_cast<unsigned int>(blue.left + 1), static_cast<unsigned int>(blue.top + 1)) == sf::Color::Blue);
+			BOOST_CHECK(page.getPixel(static_cast<unsigned int>(red.left + 3), static_cast<unsigned int>(red.top + 3)) == sf::Color::Red);
+
+			TextureAtlas releasedAtlas = TextureAtlasBuilder{ 64, 1 }.build();
+			releasedAtlas.releasePageImages();
+			BOOST_CHECK_THROW(static_cast<void>(releasedAtlas.getPageImage(0)), std::out_of_range);
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureAtlas_AddImage_Invalid_Throws)
+		{
+			TextureAtlasBuilder builder{ 32, 1 };
+			builder.addImage("image", makeImage(4, 4, sf::Color::Red));
+
+			BOOST_CHECK_THROW(builder.addImage("image", makeImage(4, 4, sf::Color::Red)), std::invalid_argument);
+			BOOST_CHECK_THROW(builder.addImage("large", makeImage(33, 4, sf::Color::Red)), std::invalid_argument);
+			BOOST_CHECK_THROW(builder.addImage("empty", sf::Image{}), std::invalid_argument);
+			BOOST_CHECK_THROW(builder.addImageFromFile("missing", "Textures/missing.png"), std::runtime_error);
+			BOOST_CHECK_EQUAL(builder.getImageCount(), 1u);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end TextureAtlas_Packing
+
+	BOOST_AUTO_TEST_SUITE(TextureAtlas_Animations)
+
+		struct AtlasFixture
+		{
+			AtlasFixture()
+			{
+				TextureAtlasBuilder builder{ 256, 2 };
+				builder.addImage("tall", makeImage(16, 64, sf::Color::Red));
+				builder.addImage("sheet", makeImage(32, 16, sf::Color::Green));
+				atlas = builder.build();
+				sheet = atlas.getRegion("sheet").bounds;
+			}
+
+			TextureAtlas atlas;
+			sf::IntRect sheet;
+		};
+
+		BOOST_FIXTURE_TEST_CASE(TextureAtlas_MakeAnimationSet_OffsetsFrames, AtlasFixture)
+		{
+			const AnimationSet local{ { Animation{ { 0, 0, 16, 16 }, { 16, 0, 16, 16 } } } };
+			AnimationSet::Ptr animations = atlas.makeAnimationSet("sheet", local);
+
+			BOOST_CHECK(animations->at(0).at(1) == sf::IntRect(sheet.left + 16, sheet.top, 16, 16));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(TextureAtlas_MakeUniformAnimationSet_OffsetsFrames, AtlasFixture)
+		{
+			UniformAnimationSet::Ptr animations = atlas.makeUniformAnimationSet("sheet", { 16, 16 }, { { { 0, 0 }, { 1, 0 } } });
+
+			BOOST_CHECK(animations->getDefaultFrameSize() == sf::Vector2i(16, 16));
+			BOOST_CHECK(animations->at(0).at(0) == sf::IntRect(sheet.left, sheet.top, 16, 16));
+			BOOST_CHECK(animations->at(0).at(1) == sf::IntRect(sheet.left + 16, sheet.top, 16, 16));
+		}
+
+		BOOST_FIXTURE_TEST_CASE(TextureAtlas_MakeAnimationSet_FrameOutsideImage_Throws, AtlasFixture)
+		{
+			BOOST_CHECK_THROW(atlas.makeUniformAnimationSet("sheet", { 16, 16 }, { { { 2, 0 } } }), std::out_of_range);
+			BOOST_CHECK_THROW(atlas.makeAnimationSet("sheet", AnimationSet{ { Animation{ { 0, 8, 16, 16 } } } }), std::out_of_range);
+			BOOST_CHECK_THROW(atlas.makeAnimationSet("unknown", AnimationSet{}), std::out_of_range);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end TextureAtlas_Animations
+
+BOOST_AUTO_TEST_SUITE_END() // end TextureAtlasTests
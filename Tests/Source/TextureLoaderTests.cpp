@@ -0,0 +1,262 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/LoadingSprite.h>
+#include <GameBackbone/Core/TextureLoader.h>
+
+#include <SFML/Graphics.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(TextureLoaderTests)
+
+	const std::string ARROW_PATH = "Textures/SmallArrow.png";
+	const std::string SPRITE_PATH = "Textures/testSprite.png";
+
+	/// @brief Returns the size of the image at path, loaded synchronously.
+	sf::Vector2u getImageSize(const std::string& path)
+	{
+		sf::Image image;
+		BOOST_REQUIRE(image.loadFromFile(path));
+		return image.getSize();
+	}
+
+	BOOST_AUTO_TEST_SUITE(TextureLoader_Load)
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_Load_ShowsPlaceholderUntilLoaded)
+		{
+			sf::Image placeholder;
+			placeholder.create(2, 3, sf::Color::Magenta);
+			TextureLoader loader{ 2, placeholder };
+			BOOST_CHECK_EQUAL(loader.getWorkerCount(), 2u);
+
+			std::vector<TextureLoadState> callbackStates;
+			const TextureHandle texture = loader.load(ARROW_PATH, [&callbackStates](const TextureHandle& loaded) {
+				callbackStates.push_back(loaded.getState());
+			});
+			// Nothing is uploaded until the loader is told to
+			BOOST_CHECK(texture.getState() == TextureLoadState::Loading);
+			BOOST_CHECK(texture.getTexture().getSize() == sf::Vector2u(2, 3));
+			BOOST_CHECK_EQUAL(loader.getPendingCount(), 1u);
+			BOOST_CHECK_EQUAL(texture.getPath(), ARROW_PATH);
+
+			// Sprites that use the texture before it loads see the real texture afterward
+			const sf::Texture* textureAddress = &texture.getTexture();
+			loader.finishLoading();
+
+			BOOST_CHECK(texture.getState() == TextureLoadState::Loaded);
+			BOOST_CHECK(&texture.getTexture() == textureAddress);
+			BOOST_CHECK(texture.getTexture().getSize() == getImageSize(ARROW_PATH));
+			BOOST_CHECK((callbackStates == std::vector<TextureLoadState>{ TextureLoadState::Loaded }));
+			BOOST_CHECK_EQUAL(loader.getPendingCount(), 0u);
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_Load_SamePath_SharesTexture)
+		{
+			TextureLoader loader{ 1 };
+			const TextureHandle first = loader.load(ARROW_PATH);
+			const TextureHandle second = loader.load(ARROW_PATH);
+			BOOST_CHECK(&first.getTexture() == &second.getTexture());
+			BOOST_CHECK_EQUAL(loader.getPendingCount(), 1u);
+
+			loader.finishLoading();
+
+			// The callback runs immediately once the texture has loaded
+			bool isCalled = false;
+			const TextureHandle third = loader.load(ARROW_PATH, [&isCalled](const TextureHandle&) { isCalled = true; });
+			BOOST_CHECK(isCalled);
+			BOOST_CHECK(&third.getTexture() == &first.getTexture());
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_Load_MissingFile_Fails)
+		{
+			TextureLoader loader{ 1 };
+			bool isCalled = false;
+			const TextureHandle texture = loader.load("Textures/missing.png", [&isCalled](const TextureHandle&) { isCalled = true; });
+
+			loader.finishLoading();
+
+			BOOST_CHECK(isCalled);
+			BOOST_CHECK(texture.getState() == TextureLoadState::Failed);
+			// The placeholder stays
+			BOOST_CHECK(texture.getTexture().getSize() == sf::Vector2u(1, 1));
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_Load_SpriteKeepsPlaceholderRectUntilReset)
+		{
+			TextureLoader loader{ 1 };
+			sf::Sprite earlySprite;
+			sf::Sprite resetSprite;
+			const TextureHandle texture = loader.load(ARROW_PATH, [&resetSprite](const TextureHandle& loaded) {
+				resetSprite.setTexture(loaded.getTexture(), true);
+			});
+			earlySprite.setTexture(texture.getTexture());
+			resetSprite.setTexture(texture.getTexture());
+			BOOST_CHECK(earlySprite.getTextureRect() == sf::IntRect(0, 0, 1, 1));
+
+			loader.finishLoading();
+
+			// Replacing the texture in place does not change the rect of a sprite that already uses it
+			const sf::Vector2u size = getImageSize(ARROW_PATH);
+			BOOST_CHECK(earlySprite.getTexture() == &texture.getTexture());
+			BOOST_CHECK(earlySprite.getTextureRect() == sf::IntRect(0, 0, 1, 1));
+			BOOST_CHECK(resetSprite.getTextureRect() == sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)));
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_Load_ManyTextures)
+		{
+			TextureLoader loader{ 3 };
+			std::vector<TextureHandle> textures;
+			for (int ii = 0; ii < 20; ++ii)
+			{
+				textures.push_back(loader.load(ii % 2 == 0 ? ARROW_PATH : SPRITE_PATH));
+			}
+			BOOST_CHECK_EQUAL(loader.getPendingCount(), 2u);
+
+			loader.finishLoading();
+
+			for (const TextureHandle& texture : textures)
+			{
+				BOOST_CHECK(texture.getState() == TextureLoadState::Loaded);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureHandle_Empty_Throws)
+		{
+			const TextureHandle texture;
+			BOOST_CHECK(!texture);
+			BOOST_CHECK_THROW(static_cast<void>(texture.getTexture()), std::runtime_error);
+			BOOST_CHECK_THROW(static_cast<void>(texture.getState()), std::runtime_error);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end TextureLoader_Load
+
+	BOOST_AUTO_TEST_SUITE(TextureLoader_UploadPending)
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_UploadPending_SpreadsUploadAcrossCalls)
+		{
+			const sf::Vector2u size = getImageSize(SPRITE_PATH);
+			const std::size_t rowBytes = std::size_t{ size.x } * 4;
+			BOOST_REQUIRE_GT(size.y, 4u);
+
+			TextureLoader loader{ 1 };
+			const TextureHandle texture = loader.load(SPRITE_PATH);
+
+			// Two rows per call
+			std::size_t uploadCount = 0;
+			for (int ii = 0; ii < 10000 && texture.getState() == TextureLoadState::Loading; ++ii)
+			{
+				const std::size_t uploadedBytes = loader.uploadPending(2 * rowBytes);
+				BOOST_CHECK_LE(uploadedBytes, 2 * rowBytes);
+				if (uploadedBytes > 0)
+				{
+					++uploadCount;
+				}
+				else
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+
+			BOOST_CHECK(texture.getState() == TextureLoadState::Loaded);
+			BOOST_CHECK_EQUAL(uploadCount, (size.y + 1) / 2);
+		}
+
+		BOOST_AUTO_TEST_CASE(TextureLoader_UploadPending_ZeroBudget_StillProgresses)
+		{
+			TextureLoader loader{ 1 };
+			const TextureHandle texture = loader.load(ARROW_PATH);
+
+			for (int ii = 0; ii < 10000 && texture.getState() == TextureLoadState::Loading; ++ii)
+			{
+				if (loader.uploadPending(0) == 0)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+			BOOST_CHECK(texture.getState() == TextureLoadState::Loaded);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end TextureLoader_UploadPending
+
+	BOOST_AUTO_TEST_SUITE(LoadingSprite_Load)
+
+		/// @brief Returns a rect covering the whole image at path.
+		sf::IntRect getImageRect(const std::string& path)
+		{
+			const sf::Vector2u size = getImageSize(path);
+			return sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+		}
+
+		BOOST_AUTO_TEST_CASE(LoadingSprite_ResizesRectOnceLoaded)
+		{
+			TextureLoader loader{ 1 };
+			const LoadingSprite sprite{ loader.load(ARROW_PATH) };
+			BOOST_CHECK(sprite.getTexture() == &sprite.getTextureHandle().getTexture());
+			BOOST_CHECK(sprite.getTextureRect() == sf::IntRect(0, 0, 1, 1));
+
+			loader.finishLoading();
+
+			BOOST_CHECK(sprite.getTextureRect() == getImageRect(ARROW_PATH));
+		}
+
+		BOOST_AUTO_TEST_CASE(LoadingSprite_AlreadyLoaded_RectIsImageSize)
+		{
+			TextureLoader loader{ 1 };
+			const TextureHandle texture = loader.load(ARROW_PATH);
+			loader.finishLoading();
+
+			const LoadingSprite sprite{ texture };
+			BOOST_CHECK(sprite.getTextureRect() == getImageRect(ARROW_PATH));
+		}
+
+		BOOST_AUTO_TEST_CASE(LoadingSprite_ExplicitRect_Kept)
+		{
+			sf::Image placeholder;
+			placeholder.create(2, 3, sf::Color::Magenta);
+			TextureLoader loader{ 1, placeholder };
+			LoadingSprite sprite{ loader.load(ARROW_PATH) };
+			sprite.setTextureRect(sf::IntRect(1, 1, 1, 1));
+
+			loader.finishLoading();
+
+			BOOST_CHECK(sprite.getTextureRect() == sf::IntRect(1, 1, 1, 1));
+		}
+
+		BOOST_AUTO_TEST_CASE(LoadingSprite_CopiedMovedAndDestroyed_WhileLoading)
+		{
+			TextureLoader loader{ 1 };
+			LoadingSprite original{ loader.load(ARROW_PATH) };
+			const LoadingSprite copy{ original };
+			const LoadingSprite moved{ std::move(original) };
+			{
+				// Destroyed before the texture loads
+				const LoadingSprite destroyed{ moved };
+			}
+
+			loader.finishLoading();
+
+			BOOST_CHECK(copy.getTextureRect() == getImageRect(ARROW_PATH));
+			BOOST_CHECK(moved.getTextureRect() == getImageRect(ARROW_PATH));
+		}
+
+		BOOST_AUTO_TEST_CASE(LoadingSprite_FailedLoad_KeepsPlaceholderRect)
+		{
+			TextureLoader loader{ 1 };
+			const LoadingSprite sprite{ loader.load("Textures/missing.png") };
+
+			loader.finishLoading();
+
+			BOOST_CHECK(sprite.getTextureRect() == sf::IntRect(0, 0, 1, 1));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end LoadingSprite_Load
+
+BOOST_AUTO_TEST_SUITE_END() // end TextureLoaderTests
@@ -0,0 +1,66 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/UniformAnimationSet.h>
+#include <GameBackbone/Core/UniformAnimationTable.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(UniformAnimationTableTests)
+
+	using TestSheet = UniformSpriteSheet<32, 16, 4, 2>;
+
+	// Built while compiling. A frame outside of the sheet here would not compile.
+	constexpr auto testTable = TestSheet::makeAnimationTable({ { 0, 0 }, { 1, 0 }, { 3, 1 } }, { { 2, 1 } });
+
+	// Everything about the table can be checked while compiling
+	static_assert(testTable.getAnimationCount() == 2);
+	static_assert(testTable.getFrameCount() == 4);
+	static_assert(testTable.getAnimationSize(0) == 3);
+	static_assert(testTable.getAnimationSize(1) == 1);
+	static_assert(testTable.getFrame(0, 2) == FrameRect{ 96, 16, 32, 16 });
+	static_assert(testTable.getFrame(1, 0) == FrameRect{ 64, 16, 32, 16 });
+	static_assert(TestSheet::contains({ 3, 1 }) && !TestSheet::contains({ 4, 0 }) && !TestSheet::contains({ 0, -1 }));
+
+	BOOST_AUTO_TEST_SUITE(UniformAnimationTable_makeAnimationSet)
+
+		// Ensure that the table builds the same frames as UniformAnimationSet
+		BOOST_AUTO_TEST_CASE(UniformAnimationTable_matches_UniformAnimationSet)
+		{
+			const UniformAnimationSet expected({ 32, 16 }, std::vector<UniformAnimation>{
+				{ { 0, 0 }, { 1, 0 }, { 3, 1 } },
+				{ { 2, 1 } }
+			});
+
+			UniformAnimationSet::Ptr animationSet = testTable.makeAnimationSet();
+
+			BOOST_CHECK(animationSet->getDefaultFrameSize() == expected.getDefaultFrameSize());
+			BOOST_REQUIRE_EQUAL(animationSet->getSize(), expected.getSize());
+			BOOST_CHECK(animationSet->at(0) == expected.at(0));
+			BOOST_CHECK(animationSet->at(1) == expected.at(1));
+			BOOST_CHECK_EQUAL(animationSet->getFrameCount(), testTable.getFrameCount());
+		}
+
+		// Ensure that frames outside of the sheet throw when the table is built while running
+		BOOST_AUTO_TEST_CASE(UniformAnimationTable_out_of_sheet_throws_at_runtime)
+		{
+			int column = 4;
+			BOOST_CHECK_THROW(TestSheet::getFrame({ column, 0 }), std::out_of_range);
+			BOOST_CHECK_THROW(static_cast<void>(TestSheet::makeAnimationTable({ { 0, 0 }, { column, 0 } })), std::out_of_range);
+		}
+
+		// Ensure that FrameRect converts to the matching sf::IntRect
+		BOOST_AUTO_TEST_CASE(UniformAnimationTable_FrameRect_converts_to_IntRect)
+		{
+			const sf::IntRect frame = testTable.getFrame(0, 1);
+			BOOST_CHECK(frame == sf::IntRect(32, 0, 32, 16));
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end UniformAnimationTable_makeAnimationSet
+
+BOOST_AUTO_TEST_SUITE_END() // end UniformAnimationTableTests
@@ -0,0 +1,198 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Core/UpdateScheduler.h>
+#include <GameBackbone/Core/Updatable.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(UpdateSchedulerTests)
+
+	/// @brief Updatable that counts its updates.
+	class CountingUpdatable : public Updatable
+	{
+	public:
+		void update(sf::Int64 elapsedTime) override
+		{
+			++updateCount;
+			lastElapsedTime = elapsedTime;
+			if (finishedCount != nullptr)
+			{
+				++*finishedCount;
+			}
+		}
+
+		int updateCount = 0;
+		sf::Int64 lastElapsedTime = 0;
+		std::atomic<int>* finishedCount = nullptr;
+	};
+
+	/// @brief Updatable that records how many Updatables of an earlier phase had finished when it was updated.
+	class DependentUpdatable : public Updatable
+	{
+	public:
+		explicit DependentUpdatable(const std::atomic<int>& counter) : dependencyCount(counter) {}
+
+		void update(sf::Int64) override
+		{
+			observedCount = dependencyCount.load();
+		}
+
+		const std::atomic<int>& dependencyCount;
+		int observedCount = -1;
+	};
+
+	/// @brief Updatable that throws on every update.
+	class ThrowingUpdatable : public Updatable
+	{
+	public:
+		void update(sf::Int64) override
+		{
+			throw std::runtime_error("Update failed");
+		}
+	};
+
+	BOOST_AUTO_TEST_SUITE(UpdateScheduler_Update)
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_Update_UpdatesEveryUpdatableOnce)
+		{
+			UpdateScheduler scheduler{ 4 };
+			scheduler.setChunkSize(3);
+			BOOST_CHECK_EQUAL(scheduler.getThreadCount(), 4u);
+
+			std::vector<CountingUpdatable> updatables(1000);
+			for (CountingUpdatable& updatable : updatables)
+			{
+				scheduler.addUpdatable(updatable);
+			}
+			BOOST_CHECK_EQUAL(scheduler.getUpdatableCount(), 1000u);
+
+			for (int ii = 0; ii < 20; ++ii)
+			{
+				scheduler.update(100 + ii);
+			}
+
+			for (const CountingUpdatable& updatable : updatables)
+			{
+				BOOST_CHECK_EQUAL(updatable.updateCount, 20);
+				BOOST_CHECK_EQUAL(updatable.lastElapsedTime, 119);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_Update_SingleThread)
+		{
+			UpdateScheduler scheduler{ 1 };
+			std::vector<CountingUpdatable> updatables(200);
+			for (CountingUpdatable& updatable : updatables)
+			{
+				scheduler.addUpdatable(updatable);
+			}
+
+			scheduler.update(5);
+
+			for (const CountingUpdatable& updatable : updatables)
+			{
+				BOOST_CHECK_EQUAL(updatable.updateCount, 1);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_Update_PhasesRunInOrder)
+		{
+			UpdateScheduler scheduler{ 4 };
+			scheduler.setChunkSize(2);
+			const std::size_t secondPhase = scheduler.addPhase();
+			BOOST_CHECK_EQUAL(secondPhase, 1u);
+			BOOST_CHECK_EQUAL(scheduler.getPhaseCount(), 2u);
+
+			std::atomic<int> finishedCount{ 0 };
+			std::vector<CountingUpdatable> dependencies(100);
+			for (CountingUpdatable& dependency : dependencies)
+			{
+				dependency.finishedCount = &finishedCount;
+				scheduler.addUpdatable(dependency);
+			}
+			std::vector<DependentUpdatable> dependents(100, DependentUpdatable{ finishedCount });
+			for (DependentUpdatable& dependent : dependents)
+			{
+				scheduler.addUpdatable(dependent, secondPhase);
+			}
+
+			scheduler.update(1);
+
+			for (const DependentUpdatable& dependent : dependents)
+			{
+				BOOST_CHECK_EQUAL(dependent.observedCount, 100);
+			}
+		}
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_Update_Throws_StopsLaterPhases)
+		{
+			UpdateScheduler scheduler{ 3 };
+			scheduler.setChunkSize(1);
+			scheduler.addPhase();
+
+			std::vector<CountingUpdatable> updatables(10);
+			ThrowingUpdatable throwingUpdatable;
+			CountingUpdatable laterUpdatable;
+			for (CountingUpdatable& updatable : updatables)
+			{
+				scheduler.addUpdatable(updatable);
+			}
+			scheduler.addUpdatable(throwingUpdatable);
+			scheduler.addUpdatable(laterUpdatable, 1);
+
+			BOOST_CHECK_THROW(scheduler.update(1), std::runtime_error);
+
+			// The rest of the phase still ran
+			for (const CountingUpdatable& updatable : updatables)
+			{
+				BOOST_CHECK_EQUAL(updatable.updateCount, 1);
+			}
+			BOOST_CHECK_EQUAL(laterUpdatable.updateCount, 0);
+
+			// The error does not carry over to the next update
+			scheduler.removeUpdatable(throwingUpdatable);
+			scheduler.update(1);
+			BOOST_CHECK_EQUAL(laterUpdatable.updateCount, 1);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end UpdateScheduler_Update
+
+	BOOST_AUTO_TEST_SUITE(UpdateScheduler_Updatables)
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_RemoveUpdatable)
+		{
+			UpdateScheduler scheduler{ 2 };
+			CountingUpdatable first;
+			CountingUpdatable second;
+			scheduler.addPhase();
+			scheduler.addUpdatable(first);
+			scheduler.addUpdatable(second, 1);
+
+			scheduler.removeUpdatable(first);
+			scheduler.update(1);
+			BOOST_CHECK_EQUAL(first.updateCount, 0);
+			BOOST_CHECK_EQUAL(second.updateCount, 1);
+
+			scheduler.clearUpdatables();
+			BOOST_CHECK_EQUAL(scheduler.getUpdatableCount(), 0u);
+			BOOST_CHECK_EQUAL(scheduler.getPhaseCount(), 2u);
+		}
+
+		BOOST_AUTO_TEST_CASE(UpdateScheduler_InvalidArguments_Throw)
+		{
+			UpdateScheduler scheduler{ 2 };
+			CountingUpdatable updatable;
+
+			BOOST_CHECK_THROW(scheduler.addUpdatable(updatable, 1), std::out_of_range);
+			BOOST_CHECK_THROW(scheduler.setChunkSize(0), std::invalid_argument);
+			BOOST_CHECK_EQUAL(scheduler.getChunkSize(), UpdateScheduler::DEFAULT_CHUNK_SIZE);
+		}
+
+	BOOST_AUTO_TEST_SUITE_END() // end UpdateScheduler_Updatables
+
+BOOST_AUTO_TEST_SUITE_END() // end UpdateSchedulerTests
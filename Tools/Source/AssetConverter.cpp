@@ -0,0 +1,76 @@
+#include <GameBackbone/Core/AnimationAsset.h>
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace GB;
+
+namespace
+{
+	void printUsage()
+	{
+		std::cerr << "Usage: GameBackboneAssetConverter INPUT OUTPUT\n"
+			<< "  Converts a text animation asset to the binary format, or a binary animation asset back to text.\n"
+			<< "  The direction is chosen from the contents of INPUT.\n";
+	}
+
+	/// @brief True if the file starts like a binary animation asset.
+	bool isBinaryAsset(const std::string& path)
+	{
+		std::ifstream input(path, std::ios::binary);
+		char magic[4] = {};
+		input.read(magic, sizeof(magic));
+		return input && std::memcmp(magic, "GBAN", sizeof(magic)) == 0;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	if (argc != 3)
+	{
+		printUsage();
+		return 1;
+	}
+	const std::string inputPath = argv[1];
+	const std::string outputPath = argv[2];
+
+	try
+	{
+		if (isBinaryAsset(inputPath))
+		{
+			const AnimationAssetBuilder builder{ AnimationAsset::loadFromFile(inputPath) };
+			std::ofstream output(outputPath);
+			builder.writeText(output);
+			if (!output)
+			{
+				std::cerr << "Could not write " << outputPath << '\n';
+				return 1;
+			}
+		}
+		else
+		{
+			std::ifstream input(inputPath);
+			if (!input)
+			{
+				std::cerr << "Could not open " << inputPath << '\n';
+				return 1;
+			}
+			const AnimationAssetBuilder builder = AnimationAssetBuilder::readText(input);
+			std::ofstream output(outputPath, std::ios::binary);
+			builder.writeBinary(output);
+			if (!output)
+			{
+				std::cerr << "Could not write " << outputPath << '\n';
+				return 1;
+			}
+		}
+	}
+	catch (const std::exception& error)
+	{
+		std::cerr << inputPath << ": " << error.what() << '\n';
+		return 1;
+	}
+	return 0;
+}